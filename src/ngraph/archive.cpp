@@ -0,0 +1,358 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+#include <stdexcept>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "ngraph/archive.hpp"
+#include "ngraph/parallel.hpp"
+#include "ngraph/util.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+static const char s_magic[8] = {'N', 'G', 'R', 'A', 'P', 'H', 'A', 'R'};
+static const uint32_t s_version = 1;
+static const uint32_t s_checksum_flag = 1;
+static const size_t s_header_size = 64;
+
+static void put_u32(vector<char>& buffer, uint32_t value)
+{
+    for (size_t i = 0; i < 4; i++)
+    {
+        buffer.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+static void put_u64(vector<char>& buffer, uint64_t value)
+{
+    for (size_t i = 0; i < 8; i++)
+    {
+        buffer.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+static uint64_t get_u64(const char* p)
+{
+    uint64_t rc = 0;
+    for (size_t i = 0; i < 8; i++)
+    {
+        rc |= static_cast<uint64_t>(static_cast<uint8_t>(p[i])) << (8 * i);
+    }
+    return rc;
+}
+
+static uint32_t get_u32(const char* p)
+{
+    uint32_t rc = 0;
+    for (size_t i = 0; i < 4; i++)
+    {
+        rc |= static_cast<uint32_t>(static_cast<uint8_t>(p[i])) << (8 * i);
+    }
+    return rc;
+}
+
+static uint64_t hash_name(const string& name)
+{
+    return hash_bytes(name.data(), name.size());
+}
+
+static void write_zeros(ostream& stream, size_t count)
+{
+    static const char zeros[64] = {};
+    while (count > 0)
+    {
+        size_t n = std::min(count, sizeof(zeros));
+        stream.write(zeros, n);
+        count -= n;
+    }
+}
+
+archive::Writer::Writer(ostream& out, size_t alignment, bool checksums)
+    : m_stream(&out)
+    , m_alignment(alignment)
+    , m_checksums(checksums)
+{
+    if (m_alignment == 0 || (m_alignment & (m_alignment - 1)) != 0)
+    {
+        throw invalid_argument("archive alignment must be a power of 2");
+    }
+}
+
+archive::Writer::Writer(const string& filename, size_t alignment, bool checksums)
+    : Writer(m_my_stream, alignment, checksums)
+{
+    m_my_stream.open(filename, ios_base::binary | ios_base::out);
+}
+
+archive::Writer::~Writer()
+{
+    close();
+}
+
+void archive::Writer::add(const string& name, const void* data, uint64_t size_in_bytes)
+{
+    if (m_stream == nullptr)
+    {
+        throw runtime_error("archive writer is closed");
+    }
+    m_records.push_back(PendingRecord{name, data, size_in_bytes});
+}
+
+void archive::Writer::close()
+{
+    if (m_stream == nullptr)
+    {
+        return;
+    }
+
+    size_t bucket_count = 1;
+    while (bucket_count < 2 * m_records.size())
+    {
+        bucket_count *= 2;
+    }
+    vector<uint64_t> buckets(bucket_count, 0);
+    for (size_t i = 0; i < m_records.size(); i++)
+    {
+        size_t bucket = hash_name(m_records[i].name) & (bucket_count - 1);
+        while (buckets[bucket] != 0)
+        {
+            bucket = (bucket + 1) & (bucket_count - 1);
+        }
+        buckets[bucket] = i + 1;
+    }
+
+    size_t index_size = bucket_count * sizeof(uint64_t);
+    for (const PendingRecord& record : m_records)
+    {
+        index_size += round_up(3 * sizeof(uint64_t) + sizeof(uint32_t) + record.name.size(), 8);
+    }
+
+    vector<char> index;
+    index.reserve(s_header_size + index_size);
+    index.insert(index.end(), s_magic, s_magic + sizeof(s_magic));
+    put_u32(index, s_version);
+    put_u32(index, m_checksums ? s_checksum_flag : 0);
+    put_u64(index, m_records.size());
+    put_u64(index, bucket_count);
+    put_u64(index, m_alignment);
+    put_u64(index, index_size);
+    index.resize(s_header_size, 0);
+    for (uint64_t bucket : buckets)
+    {
+        put_u64(index, bucket);
+    }
+    uint64_t offset = round_up(s_header_size + index_size, m_alignment);
+    for (const PendingRecord& record : m_records)
+    {
+        put_u64(index, offset);
+        put_u64(index, record.size);
+        put_u64(index, m_checksums ? hash_bytes(record.data, record.size) : 0);
+        put_u32(index, static_cast<uint32_t>(record.name.size()));
+        index.insert(index.end(), record.name.begin(), record.name.end());
+        index.resize(round_up(index.size(), 8), 0);
+        offset = round_up(offset + record.size, m_alignment);
+    }
+    m_stream->write(index.data(), index.size());
+
+    uint64_t position = index.size();
+    for (const PendingRecord& record : m_records)
+    {
+        uint64_t aligned = round_up(position, m_alignment);
+        write_zeros(*m_stream, aligned - position);
+        m_stream->write(static_cast<const char*>(record.data), record.size);
+        position = aligned + record.size;
+    }
+    m_stream->flush();
+
+    m_records.clear();
+    if (m_my_stream.is_open())
+    {
+        m_my_stream.close();
+    }
+    m_stream = nullptr;
+}
+
+archive::Reader::Reader(istream& in)
+    : m_stream(&in)
+{
+    open();
+}
+
+archive::Reader::Reader(const string& filename)
+    : m_stream(&m_my_stream)
+    , m_filename(filename)
+{
+    m_my_stream.open(filename, ios_base::binary | ios_base::in);
+    open();
+}
+
+void archive::Reader::open()
+{
+    char header[s_header_size];
+    m_stream->seekg(0, ios_base::beg);
+    m_stream->read(header, s_header_size);
+    if (!*m_stream || memcmp(header, s_magic, sizeof(s_magic)) != 0)
+    {
+        throw runtime_error("Not an nGraph archive");
+    }
+    if (get_u32(header + 8) != s_version)
+    {
+        throw runtime_error("Unsupported nGraph archive version");
+    }
+    m_checksums = (get_u32(header + 12) & s_checksum_flag) != 0;
+    uint64_t record_count = get_u64(header + 16);
+    uint64_t bucket_count = get_u64(header + 24);
+    m_alignment = get_u64(header + 32);
+    uint64_t index_size = get_u64(header + 40);
+
+    vector<char> index(index_size);
+    m_stream->read(index.data(), index_size);
+    if (!*m_stream || (bucket_count & (bucket_count - 1)) != 0 ||
+        bucket_count * sizeof(uint64_t) > index_size)
+    {
+        throw runtime_error("Truncated nGraph archive index");
+    }
+
+    const char* p = index.data();
+    const char* end = p + index_size;
+    m_buckets.resize(bucket_count);
+    for (uint64_t i = 0; i < bucket_count; i++, p += sizeof(uint64_t))
+    {
+        m_buckets[i] = get_u64(p);
+    }
+    m_records.reserve(record_count);
+    for (uint64_t i = 0; i < record_count; i++)
+    {
+        const size_t fixed_size = 3 * sizeof(uint64_t) + sizeof(uint32_t);
+        if (end - p < static_cast<ptrdiff_t>(fixed_size))
+        {
+            throw runtime_error("Truncated nGraph archive index");
+        }
+        uint32_t name_size = get_u32(p + 24);
+        if (end - p < static_cast<ptrdiff_t>(fixed_size + name_size))
+        {
+            throw runtime_error("Truncated nGraph archive index");
+        }
+        m_records.emplace_back(
+            string(p + fixed_size, name_size), get_u64(p + 8), get_u64(p), get_u64(p + 16));
+        p += round_up(fixed_size + name_size, 8);
+    }
+}
+
+const archive::Record* archive::Reader::find(const string& name) const
+{
+    const Record* rc = nullptr;
+    if (!m_buckets.empty())
+    {
+        size_t mask = m_buckets.size() - 1;
+        size_t bucket = hash_name(name) & mask;
+        for (size_t probe = 0; probe < m_buckets.size() && m_buckets[bucket] != 0; probe++)
+        {
+            const Record& record = m_records.at(m_buckets[bucket] - 1);
+            if (record.get_name() == name)
+            {
+                rc = &record;
+                break;
+            }
+            bucket = (bucket + 1) & mask;
+        }
+    }
+    return rc;
+}
+
+void archive::Reader::read(const Record& record, void* data)
+{
+    m_stream->seekg(record.get_offset(), ios_base::beg);
+    m_stream->read(static_cast<char*>(data), record.get_size());
+    if (!*m_stream)
+    {
+        throw runtime_error("Truncated nGraph archive record " + record.get_name());
+    }
+    verify(record, data);
+}
+
+void archive::Reader::read(const vector<const Record*>& records, const vector<void*>& data)
+{
+#ifndef _WIN32
+    int fd = m_filename.empty() ? -1 : ::open(m_filename.c_str(), O_RDONLY);
+    if (fd != -1)
+    {
+        try
+        {
+            parallel_for(0, records.size(), [&](size_t i) {
+                char* p = static_cast<char*>(data[i]);
+                uint64_t offset = records[i]->get_offset();
+                uint64_t remaining = records[i]->get_size();
+                while (remaining > 0)
+                {
+                    ssize_t n = pread(fd, p, remaining, offset);
+                    if (n <= 0)
+                    {
+                        throw runtime_error("Truncated nGraph archive record " +
+                                            records[i]->get_name());
+                    }
+                    p += n;
+                    offset += n;
+                    remaining -= n;
+                }
+                verify(*records[i], data[i]);
+            });
+        }
+        catch (...)
+        {
+            ::close(fd);
+            throw;
+        }
+        ::close(fd);
+        return;
+    }
+#endif
+    for (size_t i = 0; i < records.size(); i++)
+    {
+        read(*records[i], data[i]);
+    }
+}
+
+void archive::Reader::verify(const Record& record, const void* data) const
+{
+    if (m_checksums && hash_bytes(data, record.get_size()) != record.get_checksum())
+    {
+        throw runtime_error("Checksum mismatch in nGraph archive record " + record.get_name());
+    }
+}
+
+bool archive::is_archive(const string& path)
+{
+    ifstream in(path, ios_base::binary | ios_base::in);
+    return is_archive(in);
+}
+
+bool archive::is_archive(istream& in)
+{
+    size_t offset = in.tellg();
+    in.seekg(0, ios_base::beg);
+    char magic[sizeof(s_magic)] = {};
+    in.read(magic, sizeof(magic));
+    bool rc = in && memcmp(magic, s_magic, sizeof(s_magic)) == 0;
+    in.clear();
+    in.seekg(offset, ios_base::beg);
+    return rc;
+}
@@ -0,0 +1,144 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// A container for serialized models with 64 bit record sizes, an up-front hash index of
+// record names and aligned record data.
+//
+// All values are little endian.
+//
+// Header, 64 bytes
+//     char     magic[8]       "NGRAPHAR"
+//     uint32_t version        1
+//     uint32_t flags          bit 0 set if records carry checksums
+//     uint64_t record_count
+//     uint64_t bucket_count   size of the hash table, a power of 2
+//     uint64_t alignment      alignment of record data from the start of the archive
+//     uint64_t index_size     size in bytes of the index following the header
+//     padding to 64 bytes
+// Index
+//     uint64_t buckets[bucket_count]  record number + 1 of the record hashed to a bucket,
+//                                     0 for an empty bucket, probed linearly
+//     records, each 8 byte aligned
+//         uint64_t offset     offset of the record data from the start of the archive
+//         uint64_t size       size of the record data in bytes
+//         uint64_t checksum   hash_bytes of the record data, 0 without checksums
+//         uint32_t name_size
+//         char     name[name_size]
+// Record data, each record aligned
+
+namespace ngraph
+{
+    namespace archive
+    {
+        class Record;
+        class Writer;
+        class Reader;
+
+        bool is_archive(const std::string&);
+        bool is_archive(std::istream&);
+    }
+}
+
+class ngraph::archive::Record
+{
+public:
+    Record(const std::string& name, uint64_t size, uint64_t offset, uint64_t checksum)
+        : m_name(name)
+        , m_size(size)
+        , m_offset(offset)
+        , m_checksum(checksum)
+    {
+    }
+    const std::string& get_name() const { return m_name; }
+    uint64_t get_size() const { return m_size; }
+    uint64_t get_offset() const { return m_offset; }
+    uint64_t get_checksum() const { return m_checksum; }
+private:
+    std::string m_name;
+    uint64_t m_size;
+    uint64_t m_offset;
+    uint64_t m_checksum;
+};
+
+/// \brief Writes an archive. Because the index precedes the data, records are collected by
+///        add() and written by close(). Record data must remain valid until then.
+class ngraph::archive::Writer
+{
+public:
+    /// \param alignment Alignment of record data, a power of 2.
+    /// \param checksums Store a checksum of each record, verified when reading.
+    Writer(std::ostream& out, size_t alignment = 64, bool checksums = false);
+    Writer(const std::string& filename, size_t alignment = 64, bool checksums = false);
+    ~Writer();
+
+    void add(const std::string& name, const void* data, uint64_t size_in_bytes);
+    void close();
+
+private:
+    Writer(const Writer&) = delete;
+    Writer& operator=(const Writer&) = delete;
+
+    struct PendingRecord
+    {
+        std::string name;
+        const void* data;
+        uint64_t size;
+    };
+
+    std::ostream* m_stream;
+    std::ofstream m_my_stream;
+    size_t m_alignment;
+    bool m_checksums;
+    std::vector<PendingRecord> m_records;
+};
+
+class ngraph::archive::Reader
+{
+public:
+    Reader(std::istream& in);
+    Reader(const std::string& filename);
+
+    const std::vector<Record>& get_records() const { return m_records; }
+    /// \return The record named name or nullptr. Lookup uses the archive's hash index.
+    const Record* find(const std::string& name) const;
+    /// \brief Reads a record's data, verifying its checksum if the archive has them.
+    void read(const Record& record, void* data);
+    /// \brief Reads the data of several records. Archives opened by filename are read with
+    ///        positioned reads on parallel threads, archives opened from a stream sequentially.
+    void read(const std::vector<const Record*>& records, const std::vector<void*>& data);
+    bool has_checksums() const { return m_checksums; }
+    size_t get_alignment() const { return m_alignment; }
+private:
+    void open();
+
+    void verify(const Record& record, const void* data) const;
+
+    std::istream* m_stream;
+    std::ifstream m_my_stream;
+    std::string m_filename;
+    bool m_checksums;
+    size_t m_alignment;
+    std::vector<uint64_t> m_buckets;
+    std::vector<Record> m_records;
+};
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <iostream>
+#include <mutex>
 
 #include <clang/Basic/DiagnosticOptions.h>
 #include <clang/Basic/TargetInfo.h>
@@ -34,6 +35,7 @@
 #include <clang/Lex/PreprocessorOptions.h>
 #include <llvm/ADT/Statistic.h>
 #include <llvm/ExecutionEngine/MCJIT.h> // forces JIT to link in
+#include <llvm/IR/LLVMContext.h>
 #include <llvm/IR/Module.h>
 #include <llvm/LinkAllPasses.h>
 #include <llvm/Option/Arg.h>
@@ -48,6 +50,7 @@
 
 #include "header_resource.hpp"
 #include "ngraph/codegen/compiler.hpp"
+#include "ngraph/codegen/object_cache.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/util.hpp"
@@ -76,10 +79,13 @@ class CompilerInfo
 {
 public:
     string pch_file;
-    shared_ptr<codegen::CompilerCore> compiler;
+    // A CompilerCore compiles one source at a time, concurrent compiles against the same
+    // precompiled header each take an idle one from here or create a new one
+    vector<shared_ptr<codegen::CompilerCore>> compilers;
 };
 
 static unordered_map<string, CompilerInfo> s_compiler_info;
+static mutex s_compiler_info_mutex;
 
 static class StaticHandler
 {
@@ -117,6 +123,12 @@ codegen::Compiler::~Compiler()
 {
     m_compiler_action = nullptr;
     m_compiler_core = nullptr;
+    m_cached_module_context = nullptr;
+}
+
+bool codegen::Compiler::is_cache_enabled()
+{
+    return ObjectCache::is_enabled();
 }
 
 void codegen::Compiler::set_precompiled_header_source(const std::string& source)
@@ -131,18 +143,58 @@ void codegen::Compiler::add_header_search_path(const std::string& path)
 
 std::unique_ptr<codegen::Module> codegen::Compiler::compile(const std::string& source)
 {
-    // lock_guard<mutex> lock(m_mutex);
-    CompilerInfo& compiler_info = s_compiler_info[m_precompiled_header_source];
-    if (!compiler_info.compiler)
+    string cache_key;
+    if (ObjectCache::is_enabled())
     {
-        compiler_info.compiler = make_shared<CompilerCore>();
-        for (const string& path : m_header_search_paths)
+        vector<string> inputs{source, m_precompiled_header_source};
+        inputs.insert(inputs.end(), m_header_search_paths.begin(), m_header_search_paths.end());
+        const char* debuginfo = std::getenv("NGRAPH_COMPILER_DEBUGINFO_ENABLE");
+        inputs.push_back(debuginfo ? debuginfo : "");
+        cache_key = ObjectCache::get_key(inputs);
+
+        // A cached module skips clang entirely
+        if (!m_cached_module_context)
         {
-            compiler_info.compiler->add_header_search_path(path);
+            m_cached_module_context.reset(new llvm::LLVMContext());
+        }
+        unique_ptr<llvm::Module> module =
+            ObjectCache::load_module(cache_key, *m_cached_module_context);
+        if (module)
+        {
+            return unique_ptr<codegen::Module>(new codegen::Module(move(module)));
         }
-        compiler_info.compiler->set_precompiled_header_source(m_precompiled_header_source);
     }
-    auto rc = compiler_info.compiler->compile(m_compiler_action, source);
+
+    shared_ptr<CompilerCore> compiler;
+    {
+        lock_guard<mutex> lock(s_compiler_info_mutex);
+        CompilerInfo& compiler_info = s_compiler_info[m_precompiled_header_source];
+        if (compiler_info.compilers.empty())
+        {
+            compiler = make_shared<CompilerCore>();
+            for (const string& path : m_header_search_paths)
+            {
+                compiler->add_header_search_path(path);
+            }
+            compiler->set_precompiled_header_source(m_precompiled_header_source);
+        }
+        else
+        {
+            compiler = compiler_info.compilers.back();
+            compiler_info.compilers.pop_back();
+        }
+    }
+    auto rc = compiler->compile(m_compiler_action, source);
+    {
+        lock_guard<mutex> lock(s_compiler_info_mutex);
+        s_compiler_info[m_precompiled_header_source].compilers.push_back(compiler);
+    }
+    if (rc && !cache_key.empty())
+    {
+        unique_ptr<llvm::Module> module = rc->take_module();
+        ObjectCache::save_module(cache_key, *module);
+        rc.reset(new codegen::Module(move(module)));
+    }
     return rc;
 }
 
@@ -316,15 +368,21 @@ std::unique_ptr<codegen::Module>
 
     preprocessor_options.RetainRemappedFileBuffers = true;
 
-    CompilerInfo& compiler_info = s_compiler_info[m_precompiled_header_source];
-    if (!m_precompiled_header_source.empty() && compiler_info.pch_file.empty())
+    string pch_file;
     {
-        compiler_info.pch_file = generate_pch(m_precompiled_header_source);
+        // The first compile generates the precompiled header, others wait for it
+        lock_guard<mutex> lock(s_compiler_info_mutex);
+        CompilerInfo& compiler_info = s_compiler_info[m_precompiled_header_source];
+        if (!m_precompiled_header_source.empty() && compiler_info.pch_file.empty())
+        {
+            compiler_info.pch_file = generate_pch(m_precompiled_header_source);
+        }
+        pch_file = compiler_info.pch_file;
     }
-    if (!compiler_info.pch_file.empty())
+    if (!pch_file.empty())
     {
         // Preprocessor options
-        preprocessor_options.ImplicitPCHInclude = compiler_info.pch_file;
+        preprocessor_options.ImplicitPCHInclude = pch_file;
         preprocessor_options.DisablePCHValidation = 0;
     }
 
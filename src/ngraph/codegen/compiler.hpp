@@ -38,6 +38,7 @@ namespace clang
 
 namespace llvm
 {
+    class LLVMContext;
     class Module;
 }
 
@@ -57,12 +58,17 @@ class ngraph::codegen::Compiler
 public:
     Compiler();
     ~Compiler();
+    /// \brief Returns true if compiled code is cached on disk, in which case the source should
+    ///        not depend on anything that changes between processes
+    static bool is_cache_enabled();
     void set_precompiled_header_source(const std::string& source);
     void add_header_search_path(const std::string& path);
     std::unique_ptr<ngraph::codegen::Module> compile(const std::string& source);
     std::unique_ptr<clang::CodeGenAction>& get_compiler_action() { return m_compiler_action; }
 private:
     std::unique_ptr<clang::CodeGenAction> m_compiler_action;
+    // Owns modules loaded from the object cache
+    std::unique_ptr<llvm::LLVMContext> m_cached_module_context;
     std::shared_ptr<CompilerCore> m_compiler_core;
     std::string m_precompiled_header_source;
     std::vector<std::string> m_header_search_paths;
@@ -17,6 +17,7 @@
 #include <llvm/ExecutionEngine/ExecutionEngine.h>
 
 #include "ngraph/codegen/execution_engine.hpp"
+#include "ngraph/codegen/object_cache.hpp"
 
 using namespace ngraph;
 
@@ -51,6 +52,17 @@ bool codegen::ExecutionEngine::add_module(std::unique_ptr<ngraph::codegen::Modul
             {
                 return false;
             }
+
+            if (ObjectCache::is_enabled())
+            {
+                m_object_cache.reset(new ObjectCache());
+                m_execution_engine->setObjectCache(m_object_cache.get());
+            }
+        }
+        else
+        {
+            // Symbols are resolved across all modules when the engine is finalized
+            m_execution_engine->addModule(module->take_module());
         }
     }
     else
@@ -26,6 +26,7 @@ namespace ngraph
     namespace codegen
     {
         class ExecutionEngine;
+        class ObjectCache;
     }
 }
 
@@ -51,6 +52,7 @@ public:
     }
 
 private:
+    std::unique_ptr<ObjectCache> m_object_cache;
     std::unique_ptr<llvm::ExecutionEngine> m_execution_engine;
     std::string m_jit_error;
 
@@ -0,0 +1,174 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <thread>
+#include <unistd.h>
+
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/Config/llvm-config.h>
+#include <llvm/Support/Host.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include "ngraph/codegen/object_cache.hpp"
+#include "ngraph/file_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Modules whose objects are cached are named with this prefix followed by their key
+static const string s_module_prefix = "ngraph_cached_module_";
+
+static string get_cache_path(const string& key, const string& extension)
+{
+    return file_util::path_join(getenv("NGRAPH_CODEGEN_CACHE_DIR"), key + extension);
+}
+
+// Entries are written to a temporary file and renamed so that processes sharing the cache
+// never read a partial entry
+static void write_entry(const string& path, const char* data, size_t size)
+{
+    stringstream tmp_path;
+    tmp_path << path << "." << getpid() << "." << hash<thread::id>()(this_thread::get_id())
+             << ".tmp";
+    bool written;
+    {
+        ofstream out(tmp_path.str(), ios_base::binary | ios_base::out);
+        out.write(data, size);
+        written = static_cast<bool>(out);
+    }
+    if (!written || rename(tmp_path.str().c_str(), path.c_str()) != 0)
+    {
+        NGRAPH_WARN << "Unable to write codegen cache entry " << path;
+        remove(tmp_path.str().c_str());
+    }
+}
+
+bool codegen::ObjectCache::is_enabled()
+{
+    return getenv("NGRAPH_CODEGEN_CACHE_DIR") != nullptr;
+}
+
+string codegen::ObjectCache::get_key(const vector<string>& inputs)
+{
+    // Code is specific to the host CPU and to the compiler that built it
+    vector<string> key_inputs{NGRAPH_VERSION, LLVM_VERSION_STRING, llvm::sys::getHostCPUName()};
+    llvm::StringMap<bool> features;
+    if (llvm::sys::getHostCPUFeatures(features))
+    {
+        map<string, bool> sorted_features;
+        for (const auto& feature : features)
+        {
+            sorted_features[feature.getKey().str()] = feature.getValue();
+        }
+        stringstream ss;
+        for (const auto& feature : sorted_features)
+        {
+            ss << feature.first << ":" << feature.second << ";";
+        }
+        key_inputs.push_back(ss.str());
+    }
+    key_inputs.insert(key_inputs.end(), inputs.begin(), inputs.end());
+
+    vector<size_t> hashes;
+    for (const string& input : key_inputs)
+    {
+        hashes.push_back(hash_bytes(input.data(), input.size()));
+    }
+    stringstream ss;
+    ss << hex << setw(16) << setfill('0') << hash_combine(hashes);
+    return ss.str();
+}
+
+unique_ptr<llvm::Module> codegen::ObjectCache::load_module(const string& key,
+                                                           llvm::LLVMContext& context)
+{
+    unique_ptr<llvm::Module> rc;
+    auto buffer = llvm::MemoryBuffer::getFile(get_cache_path(key, ".bc"));
+    if (buffer)
+    {
+        auto module = llvm::parseBitcodeFile((*buffer)->getMemBufferRef(), context);
+        if (module)
+        {
+            rc = move(*module);
+            rc->setModuleIdentifier(s_module_prefix + key);
+        }
+        else
+        {
+            NGRAPH_WARN << "Ignoring invalid codegen cache entry " << key << ": "
+                        << llvm::toString(module.takeError());
+        }
+    }
+    return rc;
+}
+
+void codegen::ObjectCache::save_module(const string& key, llvm::Module& module)
+{
+    module.setModuleIdentifier(s_module_prefix + key);
+    string bitcode;
+    {
+        llvm::raw_string_ostream out(bitcode);
+        llvm::WriteBitcodeToFile(&module, out);
+    }
+    write_entry(get_cache_path(key, ".bc"), bitcode.data(), bitcode.size());
+}
+
+// Returns the key of a module named by save_module or load_module, or an empty string
+static string get_module_key(const llvm::Module* module)
+{
+    const string& id = module->getModuleIdentifier();
+    string rc;
+    if (id.compare(0, s_module_prefix.size(), s_module_prefix) == 0)
+    {
+        rc = id.substr(s_module_prefix.size());
+    }
+    return rc;
+}
+
+void codegen::ObjectCache::notifyObjectCompiled(const llvm::Module* module,
+                                                llvm::MemoryBufferRef object)
+{
+    string key = get_module_key(module);
+    if (!key.empty())
+    {
+        write_entry(get_cache_path(key, ".o"), object.getBufferStart(), object.getBufferSize());
+    }
+}
+
+unique_ptr<llvm::MemoryBuffer> codegen::ObjectCache::getObject(const llvm::Module* module)
+{
+    unique_ptr<llvm::MemoryBuffer> rc;
+    string key = get_module_key(module);
+    if (!key.empty())
+    {
+        auto buffer = llvm::MemoryBuffer::getFile(get_cache_path(key, ".o"));
+        if (buffer)
+        {
+            rc = move(*buffer);
+        }
+    }
+    return rc;
+}
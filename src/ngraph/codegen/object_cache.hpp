@@ -0,0 +1,58 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <llvm/ExecutionEngine/ObjectCache.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+
+namespace ngraph
+{
+    namespace codegen
+    {
+        class ObjectCache;
+    }
+}
+
+/// \brief A persistent cache of the code the JIT compiles, enabled by setting
+///        NGRAPH_CODEGEN_CACHE_DIR to a directory. Entries are keyed by the hash of the
+///        generated source and everything else that affects its compilation. The optimized
+///        module is stored so that a later compile skips clang, and the object MCJIT builds
+///        from it is stored so that the JIT also skips code generation.
+class ngraph::codegen::ObjectCache : public llvm::ObjectCache
+{
+public:
+    static bool is_enabled();
+
+    /// \brief Returns the key of the code compiled from these inputs
+    static std::string get_key(const std::vector<std::string>& inputs);
+
+    /// \brief Returns the module stored under key, or nullptr
+    static std::unique_ptr<llvm::Module> load_module(const std::string& key,
+                                                     llvm::LLVMContext& context);
+
+    /// \brief Stores the module under key. Its identifier is set to mark its object for
+    ///        the cache.
+    static void save_module(const std::string& key, llvm::Module& module);
+
+    void notifyObjectCompiled(const llvm::Module* module, llvm::MemoryBufferRef object) override;
+    std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* module) override;
+};
@@ -0,0 +1,182 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+
+#include "ngraph/constant_store.hpp"
+#include "ngraph/function.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/util.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+ConstantStore& ConstantStore::get_instance()
+{
+    static ConstantStore s_store;
+    return s_store;
+}
+
+shared_ptr<void> ConstantStore::intern(const void* data,
+                                       size_t size,
+                                       const function<shared_ptr<void>()>& make_buffer)
+{
+    uint64_t key = hash_bytes(data, size);
+    lock_guard<mutex> lock(m_mutex);
+    auto range = m_buffers.equal_range(key);
+    for (auto it = range.first; it != range.second;)
+    {
+        shared_ptr<void> existing = it->second.buffer.lock();
+        if (!existing)
+        {
+            it = m_buffers.erase(it);
+            continue;
+        }
+        if (it->second.size == size &&
+            (existing.get() == data || memcmp(existing.get(), data, size) == 0))
+        {
+            return existing;
+        }
+        ++it;
+    }
+    shared_ptr<void> rc = make_buffer();
+    m_buffers.insert({key, Entry{rc, size}});
+    return rc;
+}
+
+shared_ptr<void> ConstantStore::intern(const void* data, size_t size)
+{
+    return intern(data, size, [&]() {
+        shared_ptr<void> buffer(ngraph::aligned_alloc(64, size), ngraph::aligned_free);
+        memcpy(buffer.get(), data, size);
+        return buffer;
+    });
+}
+
+shared_ptr<void> ConstantStore::intern(const shared_ptr<void>& data, size_t size)
+{
+    return intern(data.get(), size, [&]() { return data; });
+}
+
+void ConstantStore::intern(op::Constant& constant)
+{
+    if (constant.get_data_buffer())
+    {
+        constant.set_data_buffer(intern(constant.get_data_buffer(), constant.get_data_size()));
+    }
+}
+
+void ConstantStore::intern(const shared_ptr<Function>& func)
+{
+    traverse_functions(func, [&](shared_ptr<Function> f) {
+        traverse_nodes(f.get(),
+                       [&](shared_ptr<Node> node) {
+                           if (auto c = dynamic_pointer_cast<op::Constant>(node))
+                           {
+                               intern(*c);
+                           }
+                       },
+                       true);
+    });
+}
+
+shared_ptr<void> ConstantStore::get_transformed(const shared_ptr<void>& source,
+                                                const string& layout,
+                                                size_t size,
+                                                const function<void(const void*, void*)>& transform)
+{
+    // Source buffers are interned, so their address identifies their contents for as long as
+    // the source is alive.
+    string key = to_string(reinterpret_cast<uintptr_t>(source.get())) + ":" + layout;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        auto it = m_transformed.find(key);
+        if (it != m_transformed.end())
+        {
+            shared_ptr<void> existing_source = it->second.source.lock();
+            shared_ptr<void> existing = it->second.buffer.lock();
+            if (existing_source == source && existing && it->second.size == size)
+            {
+                return existing;
+            }
+        }
+    }
+
+    shared_ptr<void> rc(ngraph::aligned_alloc(64, size), ngraph::aligned_free);
+    transform(source.get(), rc.get());
+
+    lock_guard<mutex> lock(m_mutex);
+    auto it = m_transformed.find(key);
+    if (it != m_transformed.end())
+    {
+        // Another thread may have produced the same transformation in the meantime
+        shared_ptr<void> existing_source = it->second.source.lock();
+        shared_ptr<void> existing = it->second.buffer.lock();
+        if (existing_source == source && existing && it->second.size == size)
+        {
+            return existing;
+        }
+    }
+    m_transformed[key] = TransformedEntry{source, rc, size};
+    prune();
+    return rc;
+}
+
+void ConstantStore::prune()
+{
+    for (auto it = m_transformed.begin(); it != m_transformed.end();)
+    {
+        if (it->second.source.expired() || it->second.buffer.expired())
+        {
+            it = m_transformed.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+size_t ConstantStore::size()
+{
+    lock_guard<mutex> lock(m_mutex);
+    size_t rc = 0;
+    for (auto& p : m_buffers)
+    {
+        rc += p.second.buffer.expired() ? 0 : 1;
+    }
+    for (auto& p : m_transformed)
+    {
+        rc += p.second.buffer.expired() ? 0 : 1;
+    }
+    return rc;
+}
+
+size_t ConstantStore::get_resident_size()
+{
+    lock_guard<mutex> lock(m_mutex);
+    size_t rc = 0;
+    for (auto& p : m_buffers)
+    {
+        rc += p.second.buffer.expired() ? 0 : p.second.size;
+    }
+    for (auto& p : m_transformed)
+    {
+        rc += p.second.buffer.expired() ? 0 : p.second.size;
+    }
+    return rc;
+}
@@ -0,0 +1,115 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace ngraph
+{
+    class Function;
+    class ConstantStore;
+
+    namespace op
+    {
+        class Constant;
+    }
+}
+
+/// \brief A process-wide, content-addressed store for constant data.
+///
+/// Constant buffers are hashed and deduplicated so that functions, clones and backends that
+/// load the same weights share a single copy. Backends may also cache a transformed version
+/// of a constant (for example weights reordered into a backend-specific layout) so that the
+/// transformation is performed once per layout rather than once per compile.
+///
+/// The store only holds weak references; a buffer is released as soon as the last constant or
+/// compiled function using it goes away.
+class ngraph::ConstantStore
+{
+public:
+    static ConstantStore& get_instance();
+
+    /// \brief Returns a shared buffer with the same contents as data. If an identical buffer is
+    ///        already in the store it is returned, otherwise a copy of data is added.
+    /// \param data The constant data.
+    /// \param size The size of data in bytes.
+    std::shared_ptr<void> intern(const void* data, size_t size);
+
+    /// \brief Returns a shared buffer with the same contents as data. If an identical buffer is
+    ///        already in the store it is returned, otherwise data itself is added, without copy.
+    /// \param data The constant data.
+    /// \param size The size of data in bytes.
+    std::shared_ptr<void> intern(const std::shared_ptr<void>& data, size_t size);
+
+    /// \brief Rebinds constant to the stored buffer with the same contents, adding the
+    ///        constant's buffer to the store if none exists.
+    void intern(op::Constant& constant);
+
+    /// \brief Interns every constant in func and in the functions it calls.
+    void intern(const std::shared_ptr<Function>& func);
+
+    /// \brief Returns a transformed version of source, computing it only if no live buffer for
+    ///        the same source and layout exists.
+    /// \param source A buffer obtained from intern().
+    /// \param layout A key identifying the transformation, for example a serialized layout
+    ///     descriptor.
+    /// \param size The size in bytes of the transformed buffer.
+    /// \param transform Called with the source data and a size byte destination buffer to
+    ///     produce the transformed data.
+    std::shared_ptr<void>
+        get_transformed(const std::shared_ptr<void>& source,
+                        const std::string& layout,
+                        size_t size,
+                        const std::function<void(const void*, void*)>& transform);
+
+    /// \return The number of live buffers in the store, including transformed buffers.
+    size_t size();
+
+    /// \return The total size in bytes of the live buffers in the store.
+    size_t get_resident_size();
+
+private:
+    ConstantStore() {}
+    ConstantStore(const ConstantStore&) = delete;
+    ConstantStore& operator=(const ConstantStore&) = delete;
+
+    struct Entry
+    {
+        std::weak_ptr<void> buffer;
+        size_t size;
+    };
+
+    struct TransformedEntry
+    {
+        std::weak_ptr<void> source;
+        std::weak_ptr<void> buffer;
+        size_t size;
+    };
+
+    std::shared_ptr<void> intern(const void* data,
+                                 size_t size,
+                                 const std::function<std::shared_ptr<void>()>& make_buffer);
+    void prune();
+
+    std::mutex m_mutex;
+    std::unordered_multimap<uint64_t, Entry> m_buffers;
+    std::unordered_map<std::string, TransformedEntry> m_transformed;
+};
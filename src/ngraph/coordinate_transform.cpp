@@ -168,6 +168,8 @@ CoordinateTransform::CoordinateTransform(const Shape& source_shape,
                                               source_start_corner[source_axis_order[axis]],
                                           source_strides[source_axis_order[axis]]));
     }
+
+    m_source_row_strides = row_major_strides(source_shape);
 }
 
 Strides CoordinateTransform::default_strides(size_t n_axes)
@@ -289,10 +291,55 @@ size_t CoordinateTransform::index_source(const Coordinate& c) const
     return index;
 }
 
-// Compute the index of a target-space coordinate in thebuffer.
+// Compute the index of a target-space coordinate in the buffer. This is the same mapping as
+// `index_source(to_source_coordinate(c))` without building the intermediate coordinate.
 size_t CoordinateTransform::index(const Coordinate& c) const
 {
-    return index_source(to_source_coordinate(c));
+    if (c.size() != m_n_axes)
+    {
+        throw std::domain_error(
+            "Target coordinate rank does not match the coordinate transform rank");
+    }
+
+    size_t index = 0;
+
+    for (size_t target_axis = 0; target_axis < m_n_axes; target_axis++)
+    {
+        size_t source_axis = m_source_axis_order[target_axis];
+
+        size_t pos = c[target_axis] * m_source_strides[source_axis] +
+                     m_source_start_corner[source_axis] - m_target_padding_below[target_axis];
+        if (m_target_dilation_strides[target_axis] != 1)
+        {
+            pos /= m_target_dilation_strides[target_axis];
+        }
+        index += pos * m_source_row_strides[source_axis];
+    }
+
+    return index;
+}
+
+IndexWalker CoordinateTransform::source_index_walker() const
+{
+    Strides steps(m_n_axes);
+    size_t offset = 0;
+
+    for (size_t target_axis = 0; target_axis < m_n_axes; target_axis++)
+    {
+        if (m_target_padding_below[target_axis] != 0 ||
+            m_target_padding_above[target_axis] != 0 ||
+            m_target_dilation_strides[target_axis] != 1)
+        {
+            throw std::domain_error(
+                "Source index walking is not supported for padded or dilated transforms");
+        }
+
+        size_t source_axis = m_source_axis_order[target_axis];
+        steps[target_axis] = m_source_strides[source_axis] * m_source_row_strides[source_axis];
+        offset += m_source_start_corner[source_axis] * m_source_row_strides[source_axis];
+    }
+
+    return IndexWalker(m_target_shape, steps, offset);
 }
 
 // Convert a target-space coordinate to a source-space coordinate.
@@ -439,9 +486,33 @@ CoordinateTransform::Iterator CoordinateTransform::Iterator::operator++(int)
 
 void CoordinateTransform::Iterator::operator+=(size_t n)
 {
-    for (size_t i = 0; i < n; i++)
+    if (m_oob)
     {
-        ++(*this);
+        for (size_t i = 0; i < n; i++)
+        {
+            ++(*this);
+        }
+        return;
+    }
+
+    // Add n to the target coordinate as a mixed-radix number, least significant axis last.
+    for (size_t axis = m_target_shape.size(); axis-- > 0 && n > 0;)
+    {
+        size_t pos = m_coordinate[axis] + n % m_target_shape[axis];
+        n /= m_target_shape[axis];
+        if (pos >= m_target_shape[axis])
+        {
+            pos -= m_target_shape[axis];
+            n++;
+        }
+        m_coordinate[axis] = pos;
+    }
+
+    // Carry-out from the most significant axis puts us out of bounds.
+    if (n > 0)
+    {
+        std::fill(m_coordinate.begin(), m_coordinate.end(), 0);
+        m_oob = true;
     }
 }
 
@@ -19,6 +19,7 @@
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate.hpp"
 #include "ngraph/coordinate_diff.hpp"
+#include "ngraph/index_walker.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/strides.hpp"
 
@@ -62,6 +63,9 @@ namespace ngraph
         CoordinateTransform(const Shape& source_shape);
 
         size_t index(const Coordinate& c) const;
+        /// \brief Returns a walker over the target space that yields source buffer indices.
+        ///        Only valid for transforms without padding or dilation.
+        IndexWalker source_index_walker() const;
         bool has_source_coordinate(const Coordinate& c) const;
         Coordinate to_source_coordinate(const Coordinate& c) const;
         const Shape& get_target_shape() const;
@@ -112,6 +116,7 @@ namespace ngraph
 
         Shape m_target_shape;
         size_t m_n_axes;
+        Strides m_source_row_strides;
         Iterator m_end_iterator;
     };
 }
@@ -14,6 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <limits>
+
 #include "ngraph/cpio.hpp"
 #include "ngraph/log.hpp"
 
@@ -115,26 +118,39 @@ cpio::Header cpio::Header::read(istream& stream)
     return rc;
 }
 
-void cpio::Header::write(ostream& stream, const string& name, uint32_t size)
+size_t cpio::Header::write(ostream& stream, const string& name, uint32_t size, size_t name_padding)
 {
     // namesize includes the null string terminator so + 1
-    uint16_t namesize = static_cast<uint16_t>(name.size()) + 1;
-    write_u16(stream, 0x71C7);   // magic
-    write_u16(stream, 0);        // dev
-    write_u16(stream, 0);        // ino
-    write_u16(stream, 0);        // mode
-    write_u16(stream, 0);        // uid
-    write_u16(stream, 0);        // gid
-    write_u16(stream, 0);        // nlink
-    write_u16(stream, 0);        // rdev
-    write_u32(stream, 0);        // mtime
-    write_u16(stream, namesize); // namesize
-    write_u32(stream, size);     // filesize
-    stream.write(name.c_str(), namesize + (namesize % 2));
+    size_t namesize = name.size() + 1 + name_padding;
+    if (namesize > numeric_limits<uint16_t>::max())
+    {
+        throw runtime_error("CPIO record name too long");
+    }
+    write_u16(stream, 0x71C7);                          // magic
+    write_u16(stream, 0);                               // dev
+    write_u16(stream, 0);                               // ino
+    write_u16(stream, 0);                               // mode
+    write_u16(stream, 0);                               // uid
+    write_u16(stream, 0);                               // gid
+    write_u16(stream, 0);                               // nlink
+    write_u16(stream, 0);                               // rdev
+    write_u32(stream, 0);                               // mtime
+    write_u16(stream, static_cast<uint16_t>(namesize)); // namesize
+    write_u32(stream, size);                            // filesize
+    stream.write(name.c_str(), name.size());
+    // null terminator, name padding and the pad byte keeping the record even sized
+    size_t pad = namesize - name.size() + (namesize % 2);
+    for (size_t i = 0; i < pad; i++)
+    {
+        stream.put(0);
+    }
+    return s_size + namesize + (namesize % 2);
 }
 
 cpio::Writer::Writer()
     : m_stream(nullptr)
+    , m_alignment(0)
+    , m_offset(0)
 {
 }
 
@@ -162,24 +178,45 @@ cpio::Writer::~Writer()
 void cpio::Writer::open(ostream& out)
 {
     m_stream = &out;
+    m_offset = 0;
 }
 
 void cpio::Writer::open(const string& filename)
 {
     m_stream = &m_my_stream;
     m_my_stream.open(filename, ios_base::binary | ios_base::out);
+    m_offset = 0;
+}
+
+void cpio::Writer::set_alignment(size_t alignment)
+{
+    if (alignment % 2)
+    {
+        throw runtime_error("CPIO alignment must be even");
+    }
+    m_alignment = alignment;
 }
 
 void cpio::Writer::write(const string& record_name, const void* data, uint32_t size_in_bytes)
 {
     if (m_stream)
     {
-        Header::write(*m_stream, record_name, size_in_bytes);
+        size_t name_padding = 0;
+        if (m_alignment > 1 && size_in_bytes > 0)
+        {
+            // Records are always even sized so the padding keeps the name's pad byte unchanged
+            size_t namesize = record_name.size() + 1;
+            size_t data_offset = m_offset + Header::s_size + namesize + (namesize % 2);
+            name_padding = (m_alignment - data_offset % m_alignment) % m_alignment;
+        }
+        m_offset += Header::write(*m_stream, record_name, size_in_bytes, name_padding);
         m_stream->write(static_cast<const char*>(data), size_in_bytes);
+        m_offset += size_in_bytes;
         if (size_in_bytes % 2)
         {
             char ch = 0;
             m_stream->write(&ch, 1);
+            m_offset++;
         }
     }
     else
@@ -239,8 +276,8 @@ const vector<cpio::FileInfo>& cpio::Reader::get_file_info()
 
             auto buffer = new char[header.namesize];
             m_stream->read(buffer, header.namesize);
-            // namesize includes the null string terminator so -1
-            string file_name = string(buffer, header.namesize - 1);
+            // namesize includes the null string terminator and any alignment padding
+            string file_name = string(buffer, find(buffer, buffer + header.namesize, 0) - buffer);
             delete[] buffer;
             // skip any pad characters
             if (header.namesize % 2)
@@ -53,8 +53,17 @@ public:
     uint16_t namesize;
     uint32_t filesize;
 
+    /// \brief The size in bytes of a binary header
+    static constexpr size_t s_size = 26;
+
     static Header read(std::istream&);
-    static void write(std::ostream&, const std::string& name, uint32_t size);
+    /// \brief Writes a header followed by the record name
+    /// \param name_padding Number of additional NUL characters written after the name
+    /// \return The number of bytes written
+    static size_t write(std::ostream&,
+                        const std::string& name,
+                        uint32_t size,
+                        size_t name_padding = 0);
 
 private:
 };
@@ -90,9 +99,16 @@ public:
     void open(const std::string& filename);
     void write(const std::string& file_name, const void* data, uint32_t size_in_bytes);
 
+    /// \brief Aligns the data of subsequent records to alignment bytes from the start of the
+    ///        archive by padding their names with NUL characters. The archive remains a
+    ///        valid CPIO file. An alignment of 0 disables padding.
+    void set_alignment(size_t alignment);
+
 private:
     std::ostream* m_stream;
     std::ofstream m_my_stream;
+    size_t m_alignment;
+    size_t m_offset;
 };
 
 class ngraph::cpio::Reader
@@ -14,21 +14,48 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+
 #include "ngraph/descriptor/input.hpp"
 #include "ngraph/descriptor/output.hpp"
 #include "ngraph/node.hpp"
 #include "ngraph/type/element_type.hpp"
 
+using namespace std;
 using namespace ngraph;
 using namespace descriptor;
 
+static thread_local DeferredConnections* s_deferred_connections = nullptr;
+
 Input::Input(Node* node, size_t index, Output& output)
     : m_node(node)
     , m_index(index)
     , m_output(&output)
 {
     m_src_node = std::shared_ptr<Node>(output.get_node());
-    output.add_input(this);
+    if (s_deferred_connections)
+    {
+        s_deferred_connections->m_inputs.push_back(this);
+    }
+    else
+    {
+        output.add_input(this);
+    }
+}
+
+void Input::connect()
+{
+    m_output->add_input(this);
+}
+
+void Input::disconnect()
+{
+    if (s_deferred_connections)
+    {
+        vector<Input*>& pending = s_deferred_connections->m_inputs;
+        pending.erase(remove(pending.begin(), pending.end(), this), pending.end());
+    }
+    m_output->remove_input(this);
 }
 
 void Input::replace_output(Output& new_output)
@@ -37,6 +64,7 @@ void Input::replace_output(Output& new_output)
     new_output.add_input(this);
     m_output = &new_output;
     m_src_node = std::shared_ptr<Node>(new_output.get_node());
+    m_node->increment_graph_version();
 
     static const auto nerc = std::getenv("NGRAPH_ENABLE_REPLACE_CHECK");
 
@@ -93,3 +121,25 @@ const element::Type& Input::get_element_type() const
 {
     return m_output->get_element_type();
 }
+
+DeferredConnections::DeferredConnections()
+    : m_enclosing(s_deferred_connections)
+{
+    s_deferred_connections = this;
+}
+
+DeferredConnections::~DeferredConnections()
+{
+    s_deferred_connections = m_enclosing;
+    for (Input* input : m_inputs)
+    {
+        input->connect();
+    }
+}
+
+vector<Input*> DeferredConnections::release()
+{
+    vector<Input*> inputs;
+    inputs.swap(m_inputs);
+    return inputs;
+}
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "ngraph/descriptor/tensor.hpp"
 
@@ -58,6 +59,15 @@ namespace ngraph
 
             void replace_output(std::shared_ptr<Node> node, size_t i);
             void replace_output(Output& output);
+            /// Adds this input to the users of its output.
+            void connect();
+            /// Removes this input from the users of its output, or from the pending inputs
+            /// of the current DeferredConnections scope.
+            void disconnect();
+
+            // Movable so that Node can keep its inputs in a vector, which Node reserves up
+            // front so that registered inputs never move.
+            Input(Input&&) = default;
 
         protected:
             /// \return the tensor for the connected output
@@ -85,8 +95,30 @@ namespace ngraph
 
         private:
             Input(const Input&) = delete;
-            Input(Input&&) = delete;
             Input& operator=(const Input&) = delete;
         };
+
+        /// \brief While an instance is alive, inputs constructed on the current thread are not
+        ///        added to the users of their outputs. Nodes that share arguments can then be
+        ///        constructed on several threads, each in its own scope, and connected by one
+        ///        thread afterwards.
+        class DeferredConnections
+        {
+        public:
+            DeferredConnections();
+            /// Connects the inputs that are still pending.
+            ~DeferredConnections();
+            DeferredConnections(const DeferredConnections&) = delete;
+            DeferredConnections& operator=(const DeferredConnections&) = delete;
+
+            /// \return the pending inputs, which the caller must connect
+            std::vector<Input*> release();
+
+        private:
+            friend class Input;
+
+            std::vector<Input*> m_inputs;
+            DeferredConnections* m_enclosing;
+        };
     }
 }
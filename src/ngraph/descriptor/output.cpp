@@ -32,6 +32,7 @@ descriptor::Output::Output(Node* node, size_t index, const shared_ptr<Tensor>& t
 void descriptor::Output::add_input(Input* input)
 {
     m_inputs.insert(input);
+    Node::connect_graphs(*m_node, *input->get_raw_pointer_node());
 }
 
 void descriptor::Output::remove_input(Input* input)
@@ -44,22 +45,32 @@ shared_ptr<Node> descriptor::Output::get_node() const
     return m_node->shared_from_this();
 }
 
+shared_ptr<descriptor::Tensor> descriptor::Output::get_tensor_ptr() const
+{
+    m_node->validate_if_deferred();
+    return m_tensor;
+}
+
 descriptor::Tensor& descriptor::Output::get_tensor() const
 {
+    m_node->validate_if_deferred();
     return *m_tensor;
 }
 
 const Shape& descriptor::Output::get_shape() const
 {
+    m_node->validate_if_deferred();
     return m_tensor->get_shape();
 }
 
 const PartialShape& descriptor::Output::get_partial_shape() const
 {
+    m_node->validate_if_deferred();
     return m_tensor->get_partial_shape();
 }
 
 const element::Type& descriptor::Output::get_element_type() const
 {
+    m_node->validate_if_deferred();
     return m_tensor->get_element_type();
 }
@@ -24,7 +24,7 @@
 
 namespace ngraph
 {
-    // The forward declaration of Node is needed here because Node has a deque of
+    // The forward declaration of Node is needed here because Node has a vector of
     // Outputs, and Output is an incomplete type at this point. STL containers of
     // incomplete type have undefined behavior according to the C++11 standard, and
     // in practice including node.hpp here was causing compilation errors on some
@@ -43,12 +43,15 @@ namespace ngraph
             Output(Node* node, size_t index, const std::shared_ptr<Tensor>& tensor);
 
             std::shared_ptr<Node> get_node() const;
+            /// \return the raw pointer to the node that owns this output
+            Node* get_raw_pointer_node() const { return m_node; }
             size_t get_index() const { return m_index; }
-            std::shared_ptr<Tensor> get_tensor_ptr() const { return m_tensor; }
+            std::shared_ptr<Tensor> get_tensor_ptr() const;
             void set_tensor_ptr(const std::shared_ptr<Tensor>& tensor) { m_tensor = tensor; }
             void add_input(Input* input);
             void remove_input(Input* input);
             const std::set<Input*>& get_inputs() const { return m_inputs; }
+            /// The tensor accessors run validation deferred on the owning node first
             Tensor& get_tensor() const;
 
             /// \return the shape of the output
@@ -60,6 +63,10 @@ namespace ngraph
             /// \return the element type of the output
             const element::Type& get_element_type() const;
 
+            // Movable so that Node can keep its outputs in a vector. Node only grows that
+            // vector while no Input refers to the outputs.
+            Output(Output&&) = default;
+
         protected:
             Node* m_node;
             size_t m_index;
@@ -68,7 +75,6 @@ namespace ngraph
 
         private:
             Output(const Output&) = delete;
-            Output(Output&&) = delete;
             Output& operator=(const Output&) = delete;
         };
     }
@@ -31,6 +31,31 @@ descriptor::Tensor::Tensor(const element::Type& element_type,
 {
 }
 
+descriptor::Tensor::Tensor(const element::Type& element_type,
+                           const PartialShape& pshape,
+                           Node* node,
+                           size_t node_output_number)
+    : m_element_type(element_type)
+    , m_shape(pshape.is_static() ? pshape.to_shape() : Shape{})
+    , m_partial_shape(pshape)
+    , m_node_type(&node->description())
+    , m_node_instance_id(node->get_instance_id())
+    , m_node_output_number(node_output_number)
+{
+}
+
+const std::string& descriptor::Tensor::get_name() const
+{
+    if (m_node_type)
+    {
+        call_once(m_name_once, [this]() {
+            m_name = *m_node_type + "_" + to_string(m_node_instance_id) + "_" +
+                     to_string(m_node_output_number);
+        });
+    }
+    return m_name;
+}
+
 void descriptor::Tensor::set_tensor_type(const element::Type& element_type,
                                          const PartialShape& pshape)
 {
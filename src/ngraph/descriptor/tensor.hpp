@@ -17,6 +17,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include "ngraph/descriptor/tensor.hpp"
@@ -45,8 +46,14 @@ namespace ngraph
             Tensor(const element::Type& element_type,
                    const PartialShape& pshape,
                    const std::string& name);
+            /// The name of an output tensor of node is generated from the node's name on first
+            /// use.
+            Tensor(const element::Type& element_type,
+                   const PartialShape& pshape,
+                   Node* node,
+                   size_t node_output_number);
 
-            const std::string& get_name() const { return m_name; }
+            const std::string& get_name() const;
             void set_tensor_type(const element::Type& element_type, const PartialShape& pshape);
 
             const element::Type& get_element_type() const { return m_element_type; }
@@ -74,7 +81,13 @@ namespace ngraph
             Shape m_shape;
             PartialShape m_partial_shape;
 
-            std::string m_name;
+            mutable std::string m_name;
+            mutable std::once_flag m_name_once;
+            // Type name and instance id of the owning node, kept instead of the node itself
+            // because the tensor may outlive it
+            const std::string* m_node_type{nullptr};
+            size_t m_node_instance_id{0};
+            size_t m_node_output_number{0};
             std::shared_ptr<layout::TensorLayout> m_tensor_layout;
             size_t m_pool_offset{0};
         };
@@ -21,6 +21,7 @@
 #include <dirent.h>
 #include <ftw.h>
 #include <sys/file.h>
+#include <sys/mman.h>
 #include <sys/time.h>
 #include <unistd.h>
 #endif
@@ -336,6 +337,35 @@ void file_util::iterate_files(const string& path,
     }
 }
 
+shared_ptr<void> file_util::map_file(const string& path, size_t& size)
+{
+    shared_ptr<void> rc;
+    size = get_file_size(path);
+#ifdef _WIN32
+    // Fall back to reading the file into memory
+    vector<char>* contents = new vector<char>(read_file_contents(path));
+    rc = shared_ptr<void>(contents->data(), [contents](void*) { delete contents; });
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        throw runtime_error("error opening file '" + path + "' " + strerror(errno));
+    }
+    if (size > 0)
+    {
+        void* data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        if (data == MAP_FAILED)
+        {
+            close(fd);
+            throw runtime_error("error mapping file '" + path + "' " + strerror(errno));
+        }
+        rc = shared_ptr<void>(data, [size](void* p) { munmap(p, size); });
+    }
+    close(fd);
+#endif
+    return rc;
+}
+
 string file_util::tmp_filename(const string& extension)
 {
     string rc;
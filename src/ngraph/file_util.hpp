@@ -17,6 +17,7 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -77,6 +78,13 @@ namespace ngraph
         /// \return string of the file's contents
         std::string read_file_to_string(const std::string& path);
 
+        /// \brief Maps a file read-only into memory. Pages are loaded lazily and shared with
+        ///        other processes mapping the same file.
+        /// \param path The path of the file to map
+        /// \param size Set to the size of the file in bytes
+        /// \return The mapping, which is released when the last reference goes away
+        std::shared_ptr<void> map_file(const std::string& path, size_t& size);
+
         /// \brief Iterate through files and optionally directories. Symbolic links are skipped.
         /// \param path The path to iterate over
         /// \param func A callback function called with each file or directory encountered
@@ -21,6 +21,7 @@
 #include "core/model.hpp"
 #include "core/node.hpp"
 #include "ngraph/except.hpp"
+#include "ngraph/node.hpp"
 #include "onnx.hpp"
 #include "ops_bridge.hpp"
 
@@ -59,6 +60,8 @@ namespace ngraph
                 throw detail::error::stream_parse{sin};
             }
             Model model{model_proto};
+            // Nodes are validated once, in order, when the function is constructed
+            DeferredValidation deferred_validation;
             Graph graph{model_proto.graph(), model, weights};
             auto function = std::make_shared<Function>(
                 graph.get_ng_outputs(), graph.get_ng_parameters(), graph.get_name());
@@ -15,8 +15,11 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <deque>
 #include <list>
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
@@ -70,19 +73,47 @@ Function::Function(const std::shared_ptr<Node>& result,
                    const std::string& name)
     : Function(NodeVector{result}, parameters, name)
 {
-    // TODO this does not do anything while infer happens in the constructors
-    // and it will go away after we add shape during a clone; it is here now
-    // to assist development between those two stages.
-    validate_nodes_and_infer_types();
 }
 
 void Function::validate_nodes_and_infer_types()
 {
-    ngraph::validate_nodes_and_infer_types(get_ops());
+    auto ordered_ops = get_ordered_ops_view();
+    for (auto& node : *ordered_ops)
+    {
+        node->delayed_validate_and_infer_types();
+    }
+}
+
+Function::~Function()
+{
+    if (Node* graph_node = get_graph_node())
+    {
+        vector<Function*>& functions = graph_node->get_graph_functions();
+        functions.erase(remove(functions.begin(), functions.end(), this), functions.end());
+    }
 }
 
 void Function::init()
 {
+    // Join the graphs of all results and parameters, even unused ones, so one version covers
+    // every node of the function
+    if (Node* graph_node = get_graph_node())
+    {
+        for (auto& result : m_results)
+        {
+            Node::connect_graphs(*graph_node, *result);
+        }
+        for (auto& parameter : m_parameters)
+        {
+            Node::connect_graphs(*graph_node, *parameter);
+        }
+        vector<Function*>& functions = graph_node->get_graph_functions();
+        if (find(functions.begin(), functions.end(), this) == functions.end())
+        {
+            functions.push_back(this);
+        }
+    }
+
     validate_nodes_and_infer_types();
 
     traverse_nodes(this,
@@ -101,7 +132,48 @@ void Function::init()
 
 std::list<shared_ptr<Node>> Function::get_ordered_ops(bool include_control_deps) const
 {
-    return topological_sort(get_ops(include_control_deps), include_control_deps);
+    if (!include_control_deps)
+    {
+        return topological_sort(get_ops(false), false);
+    }
+    auto ops = get_ordered_ops_view();
+    return std::list<shared_ptr<Node>>(ops->begin(), ops->end());
+}
+
+shared_ptr<const NodeVector> Function::get_ordered_ops_view() const
+{
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    return update_ordered_ops_cache();
+}
+
+Node* Function::get_graph_node() const
+{
+    if (!m_results.empty())
+    {
+        return m_results.front().get();
+    }
+    return m_parameters.empty() ? nullptr : m_parameters.front().get();
+}
+
+size_t Function::get_graph_version() const
+{
+    Node* graph_node = get_graph_node();
+    return graph_node ? graph_node->get_graph_version() : 0;
+}
+
+shared_ptr<const NodeVector> Function::update_ordered_ops_cache() const
+{
+    // Read the version before sorting so an edit racing with the sort leaves the cache stale
+    size_t version = get_graph_version();
+    if (!m_ordered_ops || m_ordered_ops_version != version)
+    {
+        auto ops = topological_sort(get_ops(true), true);
+        auto ordered_ops = make_shared<NodeVector>();
+        ordered_ops->assign(ops.begin(), ops.end());
+        m_ordered_ops = ordered_ops;
+        m_ordered_ops_version = version;
+    }
+    return m_ordered_ops;
 }
 
 const std::string& Function::get_friendly_name() const
@@ -191,3 +263,159 @@ void Function::replace_node(std::shared_ptr<Node> old, std::shared_ptr<Node> rep
 {
     ngraph::replace_node(old, repl);
 }
+
+vector<pair<Function*, bool>> Function::get_graph_functions(Node& a, Node& b)
+{
+    vector<pair<Function*, bool>> functions;
+    for (Function* f : a.get_graph_functions())
+    {
+        functions.emplace_back(f, f->is_ordered_ops_cache_current());
+    }
+    if (a.get_graph() != b.get_graph())
+    {
+        for (Function* f : b.get_graph_functions())
+        {
+            functions.emplace_back(f, f->is_ordered_ops_cache_current());
+        }
+    }
+    return functions;
+}
+
+bool Function::is_ordered_ops_cache_current() const
+{
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    return m_ordered_ops && m_ordered_ops_version == get_graph_version();
+}
+
+void Function::replace_in_ordered_ops_cache(const shared_ptr<Node>& old,
+                                            const shared_ptr<Node>& repl,
+                                            bool was_current)
+{
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    if (!was_current || !patch_ordered_ops_cache(old, repl))
+    {
+        m_ordered_ops = nullptr;
+    }
+}
+
+// Splices the nodes introduced by repl into the cached order at old's position and drops
+// the nodes that became unreachable. Returns false when the cached order cannot be patched
+// locally, in which case it is recomputed on next use.
+bool Function::patch_ordered_ops_cache(const shared_ptr<Node>& old, const shared_ptr<Node>& repl)
+{
+    const NodeVector& ops = *m_ordered_ops;
+    unordered_map<Node*, size_t> position;
+    for (size_t i = 0; i < ops.size(); i++)
+    {
+        if (!ops[i]->get_control_dependencies().empty())
+        {
+            return false;
+        }
+        position[ops[i].get()] = i;
+    }
+
+    // A user of old in the function would make old part of it too, so the edit did not
+    // touch the function
+    auto old_it = position.find(old.get());
+    if (old_it == position.end())
+    {
+        m_ordered_ops_version = get_graph_version();
+        return true;
+    }
+    if (old->is_parameter())
+    {
+        return false;
+    }
+    size_t old_position = old_it->second;
+
+    // Nodes reachable from repl that are not in the function yet, arguments first. Their
+    // arguments already in the function must precede old for the splice to stay ordered.
+    NodeVector new_nodes;
+    unordered_set<Node*> new_set;
+    vector<pair<shared_ptr<Node>, bool>> stack{{repl, false}};
+    while (!stack.empty())
+    {
+        auto entry = stack.back();
+        stack.pop_back();
+        Node* node = entry.first.get();
+        if (entry.second)
+        {
+            new_nodes.push_back(entry.first);
+            continue;
+        }
+        auto it = position.find(node);
+        if (it != position.end())
+        {
+            if (it->second >= old_position)
+            {
+                return false;
+            }
+            continue;
+        }
+        if (new_set.count(node) != 0)
+        {
+            continue;
+        }
+        if (!node->get_control_dependencies().empty())
+        {
+            return false;
+        }
+        new_set.insert(node);
+        stack.emplace_back(entry.first, true);
+        for (auto& arg : node->get_arguments())
+        {
+            stack.emplace_back(arg, false);
+        }
+    }
+
+    // A node is dead once none of its users is live in the function; parameters always stay.
+    unordered_set<Node*> dead{old.get()};
+    deque<Node*> pending{old.get()};
+    while (!pending.empty())
+    {
+        Node* node = pending.front();
+        pending.pop_front();
+        for (auto& arg : node->get_arguments())
+        {
+            Node* arg_node = arg.get();
+            if (arg_node->is_parameter() || dead.count(arg_node) != 0 ||
+                position.count(arg_node) == 0)
+            {
+                continue;
+            }
+            bool live = false;
+            for (auto& user : arg_node->get_users())
+            {
+                Node* user_node = user.get();
+                if (new_set.count(user_node) != 0 ||
+                    (position.count(user_node) != 0 && dead.count(user_node) == 0))
+                {
+                    live = true;
+                    break;
+                }
+            }
+            if (!live)
+            {
+                dead.insert(arg_node);
+                pending.push_back(arg_node);
+            }
+        }
+    }
+
+    auto patched = make_shared<NodeVector>();
+    patched->reserve(ops.size() + new_nodes.size());
+    for (size_t i = 0; i < ops.size(); i++)
+    {
+        if (i == old_position)
+        {
+            patched->insert(patched->end(), new_nodes.begin(), new_nodes.end());
+        }
+        if (dead.count(ops[i].get()) == 0)
+        {
+            patched->push_back(ops[i]);
+        }
+    }
+    m_ordered_ops = patched;
+    m_ordered_ops_version = get_graph_version();
+    return true;
+}
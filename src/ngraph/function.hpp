@@ -20,6 +20,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -29,9 +30,13 @@
 
 namespace ngraph
 {
+    void replace_node(std::shared_ptr<Node> target, std::shared_ptr<Node> replacement);
+
     /// A user-defined function.
     class Function
     {
+        friend void replace_node(std::shared_ptr<Node> target, std::shared_ptr<Node> replacement);
+
     public:
         Function(const NodeVector& results,
                  const ParameterVector& parameters,
@@ -47,7 +52,7 @@ namespace ngraph
 
         void init();
 
-        virtual ~Function() {}
+        virtual ~Function();
     public:
         /// Return the number of outputs for this function.
         size_t get_output_size() const;
@@ -76,11 +81,15 @@ namespace ngraph
         void set_name(const std::string& name);
         std::list<std::shared_ptr<Node>> get_ops(bool include_control_deps = true) const;
         std::list<std::shared_ptr<Node>> get_ordered_ops(bool include_control_deps = true) const;
+        /// Topological order including control dependencies, shared with the function's cache.
+        /// The snapshot stays valid while held; edits to the graph produce a new one.
+        std::shared_ptr<const NodeVector> get_ordered_ops_view() const;
         friend std::ostream& operator<<(std::ostream&, const Function&);
         size_t get_instance_id() { return m_instance_id; }
         size_t get_temporary_pool_size();
         void set_temporary_pool_size(size_t);
-        // updates graph and m_results list
+        // updates graph and m_results list; same as ngraph::replace_node, which patches the
+        // cached order of every function in the graph in place when possible
         void replace_node(std::shared_ptr<Node> old, std::shared_ptr<Node> repl);
 
         void validate_nodes_and_infer_types();
@@ -99,5 +108,24 @@ namespace ngraph
         size_t m_instance_id;
         std::string m_name;
         const std::string m_unique_name;
+
+        // The node whose graph holds all of the function's nodes, or null for an empty function
+        Node* get_graph_node() const;
+        size_t get_graph_version() const;
+        // The functions cached against the graphs of a and b, and whether their cached order was
+        // current
+        static std::vector<std::pair<Function*, bool>> get_graph_functions(Node& a, Node& b);
+        bool is_ordered_ops_cache_current() const;
+        // Updates the cached order after old was replaced by repl in the function's graph
+        void replace_in_ordered_ops_cache(const std::shared_ptr<Node>& old,
+                                          const std::shared_ptr<Node>& repl,
+                                          bool was_current);
+        std::shared_ptr<const NodeVector> update_ordered_ops_cache() const;
+        bool patch_ordered_ops_cache(const std::shared_ptr<Node>& old,
+                                     const std::shared_ptr<Node>& repl);
+
+        mutable std::mutex m_ordered_ops_mutex;
+        mutable std::shared_ptr<const NodeVector> m_ordered_ops;
+        mutable size_t m_ordered_ops_version = 0;
     };
 }
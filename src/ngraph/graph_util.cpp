@@ -27,8 +27,10 @@
 #include "ngraph/log.hpp"
 #include "ngraph/node.hpp"
 #include "ngraph/node_vector.hpp"
+#include "ngraph/op/allreduce.hpp"
 #include "ngraph/op/broadcast.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/op/experimental/generate_mask.hpp"
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/result.hpp"
 #include "ngraph/placement.hpp"
@@ -151,6 +153,9 @@ void ngraph::replace_node(std::shared_ptr<Node> target, std::shared_ptr<Node> re
     // Fix input/output descriptors
     assert(target->get_outputs().size() == replacement->get_outputs().size());
 
+    // The functions cached against either graph patch their order after the edit
+    vector<pair<Function*, bool>> functions = Function::get_graph_functions(*target, *replacement);
+
     // For each of target's output O with replacement output O_rep:
     //     For each O's connected downstream input I:
     //         Change I's connected upstream output to O_rep
@@ -164,6 +169,11 @@ void ngraph::replace_node(std::shared_ptr<Node> target, std::shared_ptr<Node> re
             input->replace_output(replacement->get_outputs().at(i));
         }
     }
+
+    for (auto& f : functions)
+    {
+        f.first->replace_in_ordered_ops_cache(target, replacement, f.second);
+    }
 }
 
 // Check if all paths from X to a result go through Y
@@ -269,6 +279,9 @@ std::shared_ptr<ngraph::Function> ngraph::clone_function(const ngraph::Function&
 std::shared_ptr<ngraph::Function> ngraph::clone_function(const ngraph::Function& func,
                                                          NodeMap& node_map)
 {
+    // The clones are validated once, in order, by the Function constructor
+    DeferredValidation deferred_validation;
+
     // clone function operations
     clone_nodes(func.get_ops(true), node_map);
 
@@ -555,6 +568,12 @@ bool ngraph::possibly_overwritten(Node* node)
     return false;
 }
 
+bool ngraph::is_reusable(const Node& node)
+{
+    return dynamic_cast<const op::GenerateMask*>(&node) == nullptr &&
+           dynamic_cast<const op::AllReduce*>(&node) == nullptr;
+}
+
 bool ngraph::is_strided(const Strides& strides)
 {
     return std::any_of(strides.begin(), strides.end(), [](size_t stride) { return stride != 1; });
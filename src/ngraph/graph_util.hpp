@@ -320,6 +320,10 @@ namespace ngraph
     // the output of this node with in-place kernels
     bool possibly_overwritten(Node* node);
 
+    // Returns true if the outputs of `node` depend on nothing but its inputs, so they may be
+    // computed once and reused. Random ops and collective ops are not.
+    bool is_reusable(const Node& node);
+
     bool is_strided(const Strides& strides);
 
     bool is_valid_rank(const std::shared_ptr<Node>& node, std::vector<size_t> valid_ranks);
@@ -0,0 +1,82 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/index_walker.hpp"
+#include "ngraph/except.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+IndexWalker::IndexWalker(const Shape& shape, const Strides& steps, size_t offset)
+    : m_shape(shape)
+    , m_steps(steps)
+    , m_extents(shape.size())
+    , m_coordinate(shape.size(), 0)
+    , m_offset(offset)
+    , m_index(offset)
+    , m_position(0)
+    , m_size(shape_size(shape))
+{
+    if (m_steps.size() != m_shape.size())
+    {
+        throw ngraph_error("IndexWalker steps do not have the same rank as the walked shape");
+    }
+    for (size_t axis = 0; axis < m_shape.size(); axis++)
+    {
+        m_extents[axis] = m_steps[axis] * m_shape[axis];
+    }
+}
+
+static Strides projected_steps(const Shape& shape, const AxisSet& projected_axes)
+{
+    Strides steps(shape.size(), 0);
+    size_t step = 1;
+    for (size_t axis = shape.size(); axis-- > 0;)
+    {
+        if (projected_axes.count(axis) == 0)
+        {
+            steps[axis] = step;
+            step *= shape[axis];
+        }
+    }
+    return steps;
+}
+
+IndexWalker::IndexWalker(const Shape& shape, const AxisSet& projected_axes)
+    : IndexWalker(shape, projected_steps(shape, projected_axes))
+{
+}
+
+void IndexWalker::operator+=(size_t n)
+{
+    seek(m_position + n);
+}
+
+void IndexWalker::seek(size_t position)
+{
+    m_position = position;
+    m_index = m_offset;
+    for (size_t axis = m_shape.size(); axis-- > 0;)
+    {
+        if (m_shape[axis] == 0)
+        {
+            return;
+        }
+        m_coordinate[axis] = position % m_shape[axis];
+        position /= m_shape[axis];
+        m_index += m_coordinate[axis] * m_steps[axis];
+    }
+}
@@ -0,0 +1,84 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/coordinate.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    /// \brief Walks a shape in row-major order and yields, at each position, the linear index
+    ///        of the matching element in some buffer.
+    ///
+    /// Every axis of the walked shape moves the index by a fixed step, so advancing only adds
+    /// steps and propagates carries; no coordinates are materialized and nothing is divided.
+    /// A step of zero revisits the same elements, which is how broadcasts and reductions are
+    /// expressed.
+    class IndexWalker
+    {
+    public:
+        /// \brief Walks `shape`, moving the index by `steps[i]` along axis i, starting at
+        ///        `offset`.
+        IndexWalker(const Shape& shape, const Strides& steps, size_t offset = 0);
+
+        /// \brief Walks `shape` and yields indices into a row-major buffer of
+        ///        `reduce(shape, projected_axes)`; the projected axes have a step of zero.
+        IndexWalker(const Shape& shape, const AxisSet& projected_axes);
+
+        size_t operator*() const { return m_index; }
+        void operator++()
+        {
+            ++m_position;
+            for (size_t axis = m_shape.size(); axis-- > 0;)
+            {
+                m_index += m_steps[axis];
+                if (++m_coordinate[axis] < m_shape[axis])
+                {
+                    return;
+                }
+                // Carry: rewind this axis and move on to the next outer one.
+                m_index -= m_extents[axis];
+                m_coordinate[axis] = 0;
+            }
+        }
+
+        /// \brief Advances by `n` positions in O(rank), e.g. to start a chunk of a
+        ///        parallel loop.
+        void operator+=(size_t n);
+
+        /// \brief Moves to row-major `position` in the walked shape in O(rank).
+        void seek(size_t position);
+
+        size_t get_position() const { return m_position; }
+        size_t size() const { return m_size; }
+        bool at_end() const { return m_position >= m_size; }
+    private:
+        Shape m_shape;
+        Strides m_steps;
+        // m_extents[i] == m_steps[i] * m_shape[i], the amount to rewind on carry out of axis i
+        Strides m_extents;
+        Coordinate m_coordinate;
+        size_t m_offset;
+        size_t m_index;
+        size_t m_position;
+        size_t m_size;
+    };
+}
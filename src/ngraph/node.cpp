@@ -15,9 +15,11 @@
 //*****************************************************************************
 
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <typeindex>
 #include <typeinfo>
+#include <unordered_set>
 
 #include "ngraph/autodiff/adjoints.hpp"
 #include "ngraph/descriptor/layout/tensor_layout.hpp"
@@ -32,11 +34,42 @@ using namespace ngraph;
 
 atomic<size_t> Node::m_next_instance_id(0);
 
+// The nodes of a connected graph share the ConnectedGraph found by following m_parent from the
+// one each of them holds. Graphs are joined by rank, so those chains stay short.
+struct Node::ConnectedGraph
+{
+    shared_ptr<ConnectedGraph> m_parent;
+    size_t m_rank = 0;
+    size_t m_version = 0;
+    vector<Function*> m_functions;
+};
+
+// Versions are drawn from one counter so a graph never returns to a version it reported before
+static atomic<size_t> s_last_graph_version(0);
+
+namespace
+{
+    // Node type names are shared by every instance of an op, so each is stored once
+    const string* intern_node_type(const string& node_type)
+    {
+        static mutex interned_mutex;
+        static unordered_set<string> interned;
+        lock_guard<mutex> lock(interned_mutex);
+        return &*interned.insert(node_type).first;
+    }
+}
+
 Node::Node(const std::string& node_type, const NodeVector& arguments, size_t output_size)
-    : m_node_type(node_type)
+    : m_node_type(intern_node_type(node_type))
     , m_instance_id(m_next_instance_id.fetch_add(1))
-    , m_unique_name(description() + "_" + to_string(m_instance_id))
 {
+    size_t input_size = 0;
+    for (auto& arg : arguments)
+    {
+        input_size += arg->get_outputs().size();
+    }
+    m_inputs.reserve(input_size);
+
     // Add this node as a user of each argument.
     size_t i = 0;
     for (auto arg : arguments)
@@ -56,6 +89,11 @@ Node::Node(const std::string& node_type, const NodeVector& arguments, size_t out
 
 void Node::constructor_validate_and_infer_types()
 {
+    if (DeferredValidation::is_active())
+    {
+        m_validation_deferred = true;
+        return;
+    }
 #ifdef IN_TRANSITION
     validate_and_infer_types();
 #endif
@@ -63,19 +101,97 @@ void Node::constructor_validate_and_infer_types()
 
 void Node::delayed_validate_and_infer_types()
 {
+    validate_if_deferred();
 #ifndef IN_TRANSITION
     validate_and_infer_types();
 #endif
 }
 #undef IN_TRANSITION
 
+void Node::validate_if_deferred()
+{
+    if (!m_validation_deferred)
+    {
+        return;
+    }
+
+    // Order the deferred ancestors arguments first; iterative since chains can be long
+    vector<Node*> ordered;
+    unordered_set<Node*> visited;
+    vector<pair<Node*, bool>> stack{{this, false}};
+    while (!stack.empty())
+    {
+        auto entry = stack.back();
+        stack.pop_back();
+        if (entry.second)
+        {
+            ordered.push_back(entry.first);
+        }
+        else if (visited.insert(entry.first).second)
+        {
+            stack.emplace_back(entry.first, true);
+            for (auto& input : entry.first->m_inputs)
+            {
+                Node* arg = input.get_output().get_raw_pointer_node();
+                if (arg->m_validation_deferred)
+                {
+                    stack.emplace_back(arg, false);
+                }
+            }
+        }
+    }
+
+    for (Node* node : ordered)
+    {
+        if (node->m_validation_deferred)
+        {
+            node->m_validation_deferred = false;
+            try
+            {
+                node->validate_and_infer_types();
+            }
+            catch (...)
+            {
+                node->m_validation_deferred = true;
+                throw;
+            }
+        }
+    }
+}
+
+static thread_local size_t s_deferred_validation_depth = 0;
+
+DeferredValidation::DeferredValidation()
+{
+    s_deferred_validation_depth++;
+}
+
+DeferredValidation::~DeferredValidation()
+{
+    s_deferred_validation_depth--;
+}
+
+bool DeferredValidation::is_active()
+{
+    return s_deferred_validation_depth > 0;
+}
+
 void Node::set_output_size(size_t n)
 {
     NGRAPH_ASSERT(n >= m_outputs.size()) << "shrinking " << m_outputs.size() << " to " << n;
+    if (n > m_outputs.size())
+    {
+        for (auto& output : m_outputs)
+        {
+            NGRAPH_ASSERT(output.get_inputs().empty())
+                << "growing the outputs of " << get_name() << " after they are connected";
+        }
+        m_outputs.reserve(n);
+    }
     for (size_t i = m_outputs.size(); i < n; ++i)
     {
-        auto tensor_descriptor = make_shared<descriptor::Tensor>(
-            element::dynamic, PartialShape::dynamic(), get_name() + "_" + to_string(i));
+        auto tensor_descriptor =
+            make_shared<descriptor::Tensor>(element::dynamic, PartialShape::dynamic(), this, i);
         m_outputs.emplace_back(this, i, tensor_descriptor);
     }
 }
@@ -89,12 +205,12 @@ void Node::set_output_type(size_t i, const element::Type& element_type, const Pa
     m_outputs.at(i).get_tensor_ptr()->set_tensor_type(element_type, pshape);
 }
 
-std::deque<descriptor::Output>& Node::get_outputs()
+std::vector<descriptor::Output>& Node::get_outputs()
 {
     return m_outputs;
 }
 
-const std::deque<descriptor::Output>& Node::get_outputs() const
+const std::vector<descriptor::Output>& Node::get_outputs() const
 {
     return m_outputs;
 }
@@ -118,13 +234,15 @@ const std::string& Node::get_friendly_name() const
 {
     if (m_name.empty())
     {
-        return m_unique_name;
+        return get_name();
     }
     return m_name;
 }
 
 const std::string& Node::get_name() const
 {
+    call_once(m_unique_name_once,
+              [this]() { m_unique_name = description() + "_" + to_string(m_instance_id); });
     return m_unique_name;
 }
 
@@ -174,7 +292,7 @@ Node::~Node()
 {
     for (auto& input : m_inputs)
     {
-        input.get_output().remove_input(&input);
+        input.disconnect();
     }
 }
 
@@ -192,12 +310,95 @@ NodeVector Node::get_arguments() const
 
 const std::set<std::shared_ptr<Node>>& Node::get_control_dependencies() const
 {
-    return m_control_dependencies;
+    static const std::set<std::shared_ptr<Node>> no_control_dependencies;
+    return m_control_dependencies ? *m_control_dependencies : no_control_dependencies;
 }
 
 void Node::add_control_dependency(std::shared_ptr<Node> node)
 {
-    m_control_dependencies.insert(node);
+    if (!m_control_dependencies)
+    {
+        m_control_dependencies.reset(new std::set<std::shared_ptr<Node>>());
+    }
+    m_control_dependencies->insert(node);
+    connect_graphs(*this, *node);
+    increment_graph_version();
+}
+
+void Node::remove_control_dependency(std::shared_ptr<Node> node)
+{
+    if (m_control_dependencies)
+    {
+        m_control_dependencies->erase(node);
+    }
+    increment_graph_version();
+}
+
+shared_ptr<Node::ConnectedGraph> Node::get_graph() const
+{
+    shared_ptr<ConnectedGraph> graph = m_graph;
+    while (graph && graph->m_parent)
+    {
+        graph = graph->m_parent;
+    }
+    return graph;
+}
+
+void Node::connect_graphs(Node& a, Node& b)
+{
+    shared_ptr<ConnectedGraph> graph_a = a.get_graph();
+    shared_ptr<ConnectedGraph> graph_b = b.get_graph();
+    if (!graph_a && !graph_b)
+    {
+        graph_a = make_shared<ConnectedGraph>();
+    }
+    if (!graph_a || !graph_b)
+    {
+        a.m_graph = b.m_graph = graph_a ? graph_a : graph_b;
+        return;
+    }
+    if (graph_a == graph_b)
+    {
+        return;
+    }
+    if (graph_a->m_rank < graph_b->m_rank)
+    {
+        swap(graph_a, graph_b);
+    }
+    graph_b->m_parent = graph_a;
+    if (graph_a->m_rank == graph_b->m_rank)
+    {
+        graph_a->m_rank++;
+    }
+    // A function cached against either graph sees the change if that graph was edited since
+    graph_a->m_version = max(graph_a->m_version, graph_b->m_version);
+    graph_a->m_functions.insert(
+        graph_a->m_functions.end(), graph_b->m_functions.begin(), graph_b->m_functions.end());
+    graph_b->m_functions.clear();
+}
+
+size_t Node::get_graph_version() const
+{
+    shared_ptr<ConnectedGraph> graph = get_graph();
+    return graph ? graph->m_version : 0;
+}
+
+void Node::increment_graph_version()
+{
+    if (!m_graph)
+    {
+        m_graph = make_shared<ConnectedGraph>();
+    }
+    get_graph()->m_version = s_last_graph_version.fetch_add(1) + 1;
+}
+
+vector<Function*>& Node::get_graph_functions()
+{
+    if (!m_graph)
+    {
+        m_graph = make_shared<ConnectedGraph>();
+    }
+    return get_graph()->m_functions;
 }
 
 std::vector<std::shared_ptr<Function>> Node::get_functions() const
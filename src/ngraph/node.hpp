@@ -17,9 +17,9 @@
 #pragma once
 
 #include <atomic>
-#include <deque>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <tuple>
@@ -77,6 +77,8 @@ namespace ngraph
         // So Adjoints can call generate_adjoints
         friend class autodiff::Adjoints;
         friend class descriptor::Input;
+        friend class descriptor::Output;
+        friend class Function;
         friend void replace_node_users_arguments(std::shared_ptr<Node> target,
                                                  std::shared_ptr<Node> replacement);
         friend std::pair<std::shared_ptr<op::Result>, std::shared_ptr<op::Parameter>>
@@ -115,12 +117,19 @@ namespace ngraph
         virtual void generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas) {}
     public:
         virtual ~Node();
-        void revalidate_and_infer_types() { validate_and_infer_types(); }
+        void revalidate_and_infer_types()
+        {
+            m_validation_deferred = false;
+            validate_and_infer_types();
+        }
         // Called after transition
         void delayed_validate_and_infer_types();
+        /// Runs the validation and type inference a DeferredValidation scope skipped for this
+        /// node, after doing the same for its deferred arguments.
+        void validate_if_deferred();
 
         /// The class name, must not contain spaces
-        std::string description() const { return m_node_type; }
+        const std::string& description() const { return *m_node_type; }
         const std::string& get_friendly_name() const;
         const std::string& get_name() const;
         void set_name(const std::string& name);
@@ -148,25 +157,28 @@ namespace ngraph
         virtual std::ostream& write_long_description(std::ostream&) const;
 
         // TODO: Deprecate
-        std::deque<descriptor::Input>& get_inputs() { return m_inputs; }
+        std::vector<descriptor::Input>& get_inputs() { return m_inputs; }
         // TODO: Deprecate
-        const std::deque<descriptor::Input>& get_inputs() const { return m_inputs; }
+        const std::vector<descriptor::Input>& get_inputs() const { return m_inputs; }
         // Deprecated
         // TODO: Remove from unit tests.
-        std::deque<descriptor::Output>& get_outputs();
+        std::vector<descriptor::Output>& get_outputs();
         // Deprecated
         // TODO: Remove from unit tests.
-        const std::deque<descriptor::Output>& get_outputs() const;
+        const std::vector<descriptor::Output>& get_outputs() const;
 
         /// Get control dependencies registered on the node
         const std::set<std::shared_ptr<Node>>& get_control_dependencies() const;
 
         void add_control_dependency(std::shared_ptr<Node> node);
 
-        void remove_control_dependency(std::shared_ptr<Node> node)
-        {
-            m_control_dependencies.erase(node);
-        }
+        void remove_control_dependency(std::shared_ptr<Node> node);
+
+        /// Changes on every edit of a graph edge or control dependency among the nodes connected
+        /// to this one, directly or through other nodes. Caches derived from graph structure,
+        /// such as a Function's topological order, compare against it.
+        size_t get_graph_version() const;
+        void increment_graph_version();
 
         /// Returns the number of outputs on the for the node.
         size_t get_output_size() const;
@@ -253,20 +265,53 @@ namespace ngraph
         bool operator<(const Node& other) const { return m_instance_id < other.m_instance_id; }
         static const size_t placement_invalid = -1;
 
+    private:
+        struct ConnectedGraph;
+
+        // Joins the graphs of a and b, as when an edge is added between them
+        static void connect_graphs(Node& a, Node& b);
+        std::shared_ptr<ConnectedGraph> get_graph() const;
+        // Functions whose cached order may include nodes of this node's graph
+        std::vector<Function*>& get_graph_functions();
+
     protected:
-        std::set<std::shared_ptr<Node>> m_control_dependencies;
         void set_output_size(size_t n);
 
-        std::string m_node_type;
+        // Interned, shared by all nodes of the same type
+        const std::string* m_node_type;
         size_t m_instance_id;
         std::string m_name;
-        const std::string m_unique_name;
+        // Generated on first use; most nodes of a large graph are never asked for their name
+        mutable std::string m_unique_name;
+        mutable std::once_flag m_unique_name_once;
         static std::atomic<size_t> m_next_instance_id;
-        std::deque<descriptor::Input> m_inputs;
-        std::deque<descriptor::Output> m_outputs;
-        std::unordered_map<Node*, autodiff::Adjoints> m_adjoint_map;
+        // Shared by connected nodes; allocated when the node is first connected or edited
+        std::shared_ptr<ConnectedGraph> m_graph;
+        // Inputs and outputs are referenced by address from the connected nodes, so the vectors
+        // are sized up front and never reallocate once a connection exists.
+        std::vector<descriptor::Input> m_inputs;
+        std::vector<descriptor::Output> m_outputs;
+        // Allocated only for the few nodes that have control dependencies
+        std::unique_ptr<std::set<std::shared_ptr<Node>>> m_control_dependencies;
         Placement m_placement = Placement::DEFAULT;
         size_t m_placement_index = placement_invalid;
+        bool m_validation_deferred = false;
+    };
+
+    /// \brief While an instance is alive, op constructors on the current thread skip validation
+    ///        and type inference. A deferred node is validated the first time the types of its
+    ///        outputs are inspected, or in topological order when a Function is constructed.
+    ///
+    /// Ops used inside the scope must size their outputs in their constructors.
+    class DeferredValidation
+    {
+    public:
+        DeferredValidation();
+        ~DeferredValidation();
+        DeferredValidation(const DeferredValidation&) = delete;
+        DeferredValidation& operator=(const DeferredValidation&) = delete;
+
+        static bool is_active();
     };
 
     class NodeValidationError : public AssertionFailure
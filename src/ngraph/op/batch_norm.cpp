@@ -29,6 +29,7 @@ ngraph::op::BatchNormTraining::BatchNormTraining(std::shared_ptr<ngraph::Node> i
     : Op("BatchNormTraining", check_single_output_args({gamma, beta, input}))
     , m_epsilon(epsilon)
 {
+    set_output_size(3);
     constructor_validate_and_infer_types();
 }
 
@@ -40,6 +41,7 @@ ngraph::op::BatchNormTraining::BatchNormTraining(double eps,
     : Op("BatchNormTraining", check_single_output_args({gamma, beta, input}))
     , m_epsilon(eps)
 {
+    set_output_size(3);
     constructor_validate_and_infer_types();
 }
 
@@ -49,7 +51,6 @@ void ngraph::op::BatchNormTraining::validate_and_infer_types()
     PartialShape result_batch_shape;
     PartialShape result_channel_shape;
 
-    set_output_size(3);
     std::tie(result_et, result_batch_shape, result_channel_shape) =
         infer_batch_norm_forward(this,
                                  get_input_element_type(INPUT_DATA),
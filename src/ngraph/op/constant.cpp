@@ -54,10 +54,6 @@ string to_cpp_string(T value)
 
 op::Constant::~Constant()
 {
-    if (m_data)
-    {
-        aligned_free(m_data);
-    }
 }
 
 vector<string> op::Constant::get_value_strings() const
@@ -161,12 +157,12 @@ vector<string> op::Constant::get_value_strings() const
 shared_ptr<Node> op::Constant::copy_with_new_args(const NodeVector& new_args) const
 {
     check_new_args_count(this, new_args);
-    return make_shared<Constant>(m_element_type, m_shape, m_data);
+    return make_shared<Constant>(m_element_type, m_shape, m_buffer);
 }
 
 shared_ptr<op::Constant> op::ScalarConstantLikeBase::as_constant() const
 {
-    return std::make_shared<op::Constant>(m_element_type, m_shape, m_data);
+    return std::make_shared<op::Constant>(m_element_type, m_shape, m_buffer);
 }
 
 std::shared_ptr<Node> op::ScalarConstantLike::copy_with_new_args(const NodeVector& new_args) const
@@ -179,7 +175,7 @@ void op::ScalarConstantLike::infer_element_type()
     m_element_type = get_input_element_type(0);
     if (nullptr == m_data)
     {
-        m_data = ngraph::aligned_alloc(m_element_type.size(), m_element_type.size());
+        set_data_buffer(allocate_buffer(m_element_type, m_shape));
         write_values(std::vector<double>(1, m_value));
     }
 }
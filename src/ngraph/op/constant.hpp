@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cstring>
+#include <memory>
 #include <sstream>
 
 #include "ngraph/log.hpp"
@@ -27,6 +28,8 @@
 
 namespace ngraph
 {
+    class ConstantStore;
+
     namespace op
     {
         /// \brief Class for constants.
@@ -44,8 +47,8 @@ namespace ngraph
                 : Node("Constant", {})
                 , m_element_type(type)
                 , m_shape(shape)
-                , m_data(ngraph::aligned_alloc(m_element_type.size(),
-                                               shape_size(m_shape) * m_element_type.size()))
+                , m_buffer(allocate_buffer(m_element_type, m_shape))
+                , m_data(m_buffer.get())
             {
                 NODE_VALIDATION_ASSERT(this,
                                        values.size() == 1 || values.size() == shape_size(m_shape))
@@ -74,8 +77,8 @@ namespace ngraph
                 : Node("Constant", {})
                 , m_element_type(type)
                 , m_shape(shape)
-                , m_data(ngraph::aligned_alloc(m_element_type.size(),
-                                               shape_size(m_shape) * m_element_type.size()))
+                , m_buffer(allocate_buffer(m_element_type, m_shape))
+                , m_data(m_buffer.get())
             {
                 NODE_VALIDATION_ASSERT(this, values.size() == shape_size(m_shape))
                     << "Did not get the expected number of literals for a constant of shape "
@@ -97,11 +100,30 @@ namespace ngraph
                 : Node("Constant", {})
                 , m_element_type(type)
                 , m_shape(shape)
-                , m_data(nullptr)
+                , m_buffer(allocate_buffer(m_element_type, m_shape))
+                , m_data(m_buffer.get())
+            {
+                std::memcpy(m_data, data, shape_size(m_shape) * m_element_type.size());
+                constructor_validate_and_infer_types();
+            }
+
+            /// \brief Constructs a tensor constant that shares an existing buffer.
+            ///        No copy is made. The buffer must hold at least
+            ///        shape_size(shape) * type.size() bytes and must not be modified while any
+            ///        constant refers to it.
+            ///
+            /// \param type The element type of the tensor constant.
+            /// \param shape The shape of the tensor constant.
+            /// \param data The shared buffer holding the constant data.
+            Constant(const element::Type& type,
+                     const Shape& shape,
+                     const std::shared_ptr<void>& data)
+                : Node("Constant", {})
+                , m_element_type(type)
+                , m_shape(shape)
+                , m_buffer(data)
+                , m_data(m_buffer.get())
             {
-                size_t size = shape_size(m_shape) * m_element_type.size();
-                m_data = ngraph::aligned_alloc(m_element_type.size(), size);
-                std::memcpy(m_data, data, size);
                 constructor_validate_and_infer_types();
             }
 
@@ -165,6 +187,11 @@ namespace ngraph
             }
 
             const void* get_data_ptr() const { return m_data; }
+            /// \return The shared buffer backing this constant. Clones of this constant share
+            ///         the same buffer.
+            const std::shared_ptr<void>& get_data_buffer() const { return m_buffer; }
+            /// \return The size of the constant data in bytes.
+            size_t get_data_size() const { return shape_size(m_shape) * m_element_type.size(); }
             template <typename T>
             const T* get_data_ptr() const
             {
@@ -180,6 +207,21 @@ namespace ngraph
             }
 
             virtual void infer_element_type() {}
+            static std::shared_ptr<void> allocate_buffer(const element::Type& type,
+                                                         const Shape& shape)
+            {
+                return std::shared_ptr<void>(
+                    ngraph::aligned_alloc(type.size(), shape_size(shape) * type.size()),
+                    ngraph::aligned_free);
+            }
+
+            /// \brief Rebinds this constant to a buffer holding identical data.
+            void set_data_buffer(const std::shared_ptr<void>& buffer)
+            {
+                m_buffer = buffer;
+                m_data = m_buffer.get();
+            }
+
             template <typename T>
             void write_values(const std::vector<T>& values)
             {
@@ -263,9 +305,11 @@ namespace ngraph
 
             element::Type m_element_type;
             Shape m_shape{};
+            std::shared_ptr<void> m_buffer;
             void* m_data{nullptr};
             Constant(const Constant&) = delete;
             Constant operator=(const Constant&) = delete;
+            friend class ngraph::ConstantStore;
         };
 
         class ScalarConstantLikeBase : public Constant
@@ -41,7 +41,7 @@ void op::Parameter::validate_and_infer_types()
 shared_ptr<Node> op::Parameter::copy_with_new_args(const NodeVector& new_args) const
 {
     check_new_args_count(this, new_args);
-    return make_shared<Parameter>(m_element_type, m_partial_shape);
+    return make_shared<Parameter>(m_element_type, m_partial_shape, m_cacheable);
 }
 
 void op::Parameter::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
@@ -34,6 +34,7 @@ op::TopK::TopK(const shared_ptr<Node>& arg,
     , m_k(k)
     , m_compute_max(compute_max)
 {
+    set_output_size(2);
     constructor_validate_and_infer_types();
 }
 
@@ -78,7 +79,6 @@ void op::TopK::validate_and_infer_types()
         }
     }
 
-    set_output_size(2);
     set_output_type(0, m_index_element_type, output_shape);
     set_output_type(1, input_element_type, output_shape);
 }
@@ -0,0 +1,207 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ngraph/parallel.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+namespace
+{
+    // Jobs from any number of callers share the workers. Each caller works on its own job
+    // and only waits for workers still running one of its indices, so calls from within
+    // func cannot deadlock.
+    class ThreadPool
+    {
+    public:
+        ThreadPool(size_t threads)
+        {
+            for (size_t i = 1; i < threads; i++)
+            {
+                m_workers.emplace_back([this]() { worker(); });
+            }
+        }
+
+        ~ThreadPool()
+        {
+            {
+                lock_guard<mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_work_available.notify_all();
+            for (thread& worker : m_workers)
+            {
+                worker.join();
+            }
+        }
+
+        void run(size_t begin, size_t end, const function<void(size_t)>& func)
+        {
+            Job job(begin, end, func);
+            {
+                lock_guard<mutex> lock(m_mutex);
+                m_jobs.push_back(&job);
+            }
+            m_work_available.notify_all();
+            work(job);
+
+            // Once the job is withdrawn no more workers can join it
+            unique_lock<mutex> lock(m_mutex);
+            m_jobs.erase(find(m_jobs.begin(), m_jobs.end(), &job));
+            m_job_done.wait(lock, [&]() { return job.m_participants == 0; });
+            if (job.m_error)
+            {
+                rethrow_exception(job.m_error);
+            }
+        }
+
+    private:
+        struct Job
+        {
+            Job(size_t begin, size_t end, const function<void(size_t)>& func)
+                : m_next(begin)
+                , m_end(end)
+                , m_func(func)
+            {
+            }
+            bool has_work() const { return m_next < m_end; }
+            atomic<size_t> m_next;
+            size_t m_end;
+            const function<void(size_t)>& m_func;
+            size_t m_participants = 0;
+            mutex m_error_mutex;
+            exception_ptr m_error;
+        };
+
+        static void work(Job& job)
+        {
+            for (size_t i = job.m_next++; i < job.m_end; i = job.m_next++)
+            {
+                try
+                {
+                    job.m_func(i);
+                }
+                catch (...)
+                {
+                    lock_guard<mutex> lock(job.m_error_mutex);
+                    if (!job.m_error)
+                    {
+                        job.m_error = current_exception();
+                    }
+                    job.m_next = job.m_end;
+                }
+            }
+        }
+
+        // The oldest job with indices left, or nullptr
+        Job* find_job() const
+        {
+            for (Job* job : m_jobs)
+            {
+                if (job->has_work())
+                {
+                    return job;
+                }
+            }
+            return nullptr;
+        }
+
+        void worker()
+        {
+            unique_lock<mutex> lock(m_mutex);
+            while (true)
+            {
+                Job* job = nullptr;
+                m_work_available.wait(lock, [&]() {
+                    job = find_job();
+                    return m_stop || job != nullptr;
+                });
+                if (m_stop)
+                {
+                    break;
+                }
+                job->m_participants++;
+                lock.unlock();
+                work(*job);
+                lock.lock();
+                if (--job->m_participants == 0)
+                {
+                    m_job_done.notify_all();
+                }
+            }
+        }
+
+        vector<thread> m_workers;
+        mutex m_mutex;
+        condition_variable m_work_available;
+        condition_variable m_job_done;
+        vector<Job*> m_jobs;
+        bool m_stop = false;
+    };
+}
+
+size_t ngraph::get_parallelism()
+{
+    static size_t s_parallelism = []() {
+        size_t rc = thread::hardware_concurrency();
+        if (const char* env = getenv("NGRAPH_PARALLELISM"))
+        {
+            rc = strtoul(env, nullptr, 10);
+        }
+        return rc == 0 ? 1 : rc;
+    }();
+    return s_parallelism;
+}
+
+void ngraph::parallel_for(size_t begin, size_t end, const function<void(size_t)>& func)
+{
+    static ThreadPool s_pool(get_parallelism());
+    if (end <= begin + 1 || get_parallelism() == 1)
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            func(i);
+        }
+    }
+    else
+    {
+        s_pool.run(begin, end, func);
+    }
+}
+
+void ngraph::parallel_for_ranges(size_t begin,
+                                 size_t end,
+                                 const function<void(size_t, size_t)>& func)
+{
+    if (end <= begin)
+    {
+        return;
+    }
+    size_t count = end - begin;
+    size_t ranges = min(count, get_parallelism() * 4);
+    parallel_for(0, ranges, [&](size_t range) {
+        func(begin + count * range / ranges, begin + count * (range + 1) / ranges);
+    });
+}
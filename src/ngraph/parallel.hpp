@@ -0,0 +1,52 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace ngraph
+{
+    /// \brief Returns the number of threads used by parallel_for, including the calling thread.
+    ///        Set by the NGRAPH_PARALLELISM environment variable, defaults to the hardware
+    ///        concurrency.
+    size_t get_parallelism();
+
+    /// \brief Calls func(i) for every i in [begin, end) on a shared pool of threads. The calling
+    ///        thread takes part, indices are handed out one at a time in increasing order.
+    ///        Calls from different threads, including calls from within func, run at the same
+    ///        time and share the pool, idle threads joining the oldest call first. If func
+    ///        throws, the remaining indices are skipped and the first exception is rethrown
+    ///        once all running calls have returned.
+    /// \param begin The first index
+    /// \param end One past the last index
+    /// \param func The function to call for each index
+    void parallel_for(size_t begin, size_t end, const std::function<void(size_t)>& func);
+
+    /// \brief Splits [begin, end) into a few contiguous ranges per thread and calls
+    ///        func(range_begin, range_end) for each of them through parallel_for. Kernels use
+    ///        this to split an outer loop without paying for a call per element. When every
+    ///        index writes its own outputs and computes them in a fixed order, as in the
+    ///        reference convolution and pooling kernels, the result does not depend on how
+    ///        the indices were split and is bit-identical to the serial loop.
+    /// \param begin The first index
+    /// \param end One past the last index
+    /// \param func The function to call for each range
+    void parallel_for_ranges(size_t begin,
+                             size_t end,
+                             const std::function<void(size_t, size_t)>& func);
+}
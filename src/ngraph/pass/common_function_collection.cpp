@@ -27,6 +27,18 @@ pass::CommonFunctionCollection::CommonFunctionCollection(function<string(Node&,
     : m_emit_op_as_function(emitter)
     , m_node_function_map(result_map)
     , m_emitted_functions(emitted_functions)
+    , m_emitted_function_list(nullptr)
+{
+}
+
+pass::CommonFunctionCollection::CommonFunctionCollection(function<string(Node&, string)> emitter,
+                                                         unordered_map<Node*, Node*>& result_map,
+                                                         string& emitted_functions,
+                                                         vector<string>& emitted_function_list)
+    : m_emit_op_as_function(emitter)
+    , m_node_function_map(result_map)
+    , m_emitted_functions(emitted_functions)
+    , m_emitted_function_list(&emitted_function_list)
 {
 }
 
@@ -94,6 +106,10 @@ bool pass::CommonFunctionCollection::run_on_module(vector<shared_ptr<Function>>&
                     string match_function_name = create_function_name(*it->second);
                     emitted_function.replace(offset, function_name.size(), match_function_name);
                     ss << emitted_function << "\n";
+                    if (m_emitted_function_list)
+                    {
+                        m_emitted_function_list->push_back(emitted_function);
+                    }
                 }
             }
             else
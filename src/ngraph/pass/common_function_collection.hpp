@@ -17,6 +17,7 @@
 #pragma once
 
 #include <unordered_map>
+#include <vector>
 
 #include "ngraph/codegen/code_writer.hpp"
 #include "ngraph/pass/pass.hpp"
@@ -45,6 +46,15 @@ public:
                              std::unordered_map<Node*, Node*>& result_map,
                              std::string& emitted_functions);
 
+    /// \brief Create the CommonFunctionCollection pass
+    /// \param emitted_function_list - In addition to emitted_functions, receives the code of
+    ///        each static function on its own so that callers can split the functions across
+    ///        several sources.
+    CommonFunctionCollection(std::function<std::string(Node&, std::string)> function_emitter,
+                             std::unordered_map<Node*, Node*>& result_map,
+                             std::string& emitted_functions,
+                             std::vector<std::string>& emitted_function_list);
+
     virtual ~CommonFunctionCollection() override;
 
     bool run_on_module(std::vector<std::shared_ptr<ngraph::Function>>&) override;
@@ -59,4 +69,5 @@ private:
     std::function<std::string(Node&, std::string)> m_emit_op_as_function;
     std::unordered_map<Node*, Node*>& m_node_function_map;
     std::string& m_emitted_functions;
+    std::vector<std::string>* m_emitted_function_list;
 };
@@ -14,7 +14,10 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <stdint.h>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "constant_folding.hpp"
 #include "ngraph/graph_util.hpp"
@@ -29,12 +32,15 @@
 #include "ngraph/op/multiply.hpp"
 #include "ngraph/op/negative.hpp"
 #include "ngraph/op/pad.hpp"
+#include "ngraph/op/parameter.hpp"
 #include "ngraph/op/quantize.hpp"
 #include "ngraph/op/relu.hpp"
 #include "ngraph/op/reshape.hpp"
 #include "ngraph/op/subtract.hpp"
 #include "ngraph/pattern/matcher.hpp"
 #include "ngraph/pattern/op/label.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/tensor.hpp"
 #include "ngraph/runtime/reference/abs.hpp"
 #include "ngraph/runtime/reference/add.hpp"
 #include "ngraph/runtime/reference/broadcast.hpp"
@@ -620,3 +626,184 @@ void ngraph::pass::ConstantFolding::construct_constant_quantize()
         quant, constant_quantize_callback, "ConstantFolding.ConstantQuantize");
     this->add_matcher(quantize_matcher);
 }
+
+static size_t tensor_bytes(const descriptor::Output& output)
+{
+    return shape_size(output.get_shape()) * output.get_element_type().size();
+}
+
+// Ops whose value depends on nothing but their inputs
+static bool is_foldable_op(const shared_ptr<Node>& node)
+{
+    return node->is_op() && !node->is_output() && !node->is_parameter() && !node->is_constant() &&
+           node->get_input_size() > 0 && node->get_control_dependencies().empty() &&
+           is_reusable(*node);
+}
+
+bool ngraph::pass::ConstantFolding::run_on_function(shared_ptr<ngraph::Function> f)
+{
+    bool rewritten = GraphRewrite::run_on_function(f);
+    if (!m_backend_name.empty())
+    {
+        rewritten = fold_constant_subgraphs(f) || rewritten;
+    }
+    return rewritten;
+}
+
+bool ngraph::pass::ConstantFolding::fold_constant_subgraphs(const shared_ptr<ngraph::Function>& f)
+{
+    // Nodes whose values are known at compile time
+    unordered_set<Node*> constant_valued;
+    NodeVector folded;
+    auto ordered_ops = f->get_ordered_ops_view();
+    for (auto& node : *ordered_ops)
+    {
+        if (node->is_constant())
+        {
+            constant_valued.insert(node.get());
+            continue;
+        }
+        if (!is_foldable_op(node))
+        {
+            continue;
+        }
+
+        bool foldable = true;
+        size_t input_bytes = 0;
+        for (auto& input : node->get_inputs())
+        {
+            if (constant_valued.count(input.get_output().get_raw_pointer_node()) == 0)
+            {
+                foldable = false;
+                break;
+            }
+            input_bytes += tensor_bytes(input.get_output());
+        }
+        size_t output_bytes = 0;
+        for (size_t i = 0; foldable && i < node->get_output_size(); i++)
+        {
+            foldable = node->get_output_partial_shape(i).is_static();
+            output_bytes += foldable ? tensor_bytes(node->get_outputs().at(i)) : 0;
+        }
+        if (foldable && output_bytes <= max(input_bytes, m_max_folded_size))
+        {
+            constant_valued.insert(node.get());
+            folded.push_back(node);
+        }
+    }
+
+    // Only the values used by the rest of the graph are materialized
+    NodeVector frontier;
+    for (auto& node : folded)
+    {
+        if (node->get_output_size() != 1)
+        {
+            continue;
+        }
+        for (auto& user : node->get_users())
+        {
+            if (constant_valued.count(user.get()) == 0)
+            {
+                frontier.push_back(node);
+                break;
+            }
+        }
+    }
+    if (frontier.empty())
+    {
+        return false;
+    }
+
+    unordered_set<Node*> needed;
+    vector<Node*> stack;
+    for (auto& node : frontier)
+    {
+        stack.push_back(node.get());
+    }
+    while (!stack.empty())
+    {
+        Node* node = stack.back();
+        stack.pop_back();
+        if (needed.insert(node).second)
+        {
+            for (auto& input : node->get_inputs())
+            {
+                stack.push_back(input.get_output().get_raw_pointer_node());
+            }
+        }
+    }
+
+    // Evaluate all of them with one function whose parameters stand in for the constants, so
+    // that the backend's own pipeline has nothing to fold again
+    unordered_map<Node*, shared_ptr<Node>> clones;
+    ParameterVector parameters;
+    vector<shared_ptr<op::Constant>> parameter_values;
+    for (auto& node : *ordered_ops)
+    {
+        if (needed.count(node.get()) == 0)
+        {
+            continue;
+        }
+        if (node->is_constant())
+        {
+            auto parameter =
+                make_shared<op::Parameter>(node->get_element_type(), node->get_shape());
+            clones[node.get()] = parameter;
+            parameters.push_back(parameter);
+            parameter_values.push_back(static_pointer_cast<op::Constant>(node));
+        }
+        else
+        {
+            NodeVector args;
+            for (auto& arg : node->get_arguments())
+            {
+                args.push_back(clones.at(arg.get()));
+            }
+            clones[node.get()] = node->copy_with_new_args(args);
+        }
+    }
+    NodeVector results;
+    for (auto& node : frontier)
+    {
+        results.push_back(clones.at(node.get()));
+    }
+
+    vector<shared_ptr<op::Constant>> values;
+    try
+    {
+        auto evaluator = make_shared<Function>(results, parameters);
+        auto backend = runtime::Backend::create(m_backend_name);
+        vector<shared_ptr<runtime::Tensor>> inputs;
+        for (auto& value : parameter_values)
+        {
+            auto tensor = backend->create_tensor(value->get_element_type(), value->get_shape());
+            tensor->write(value->get_data_ptr(), 0, tensor_bytes(value->get_outputs().at(0)));
+            inputs.push_back(tensor);
+        }
+        vector<shared_ptr<runtime::Tensor>> outputs;
+        for (auto& node : frontier)
+        {
+            outputs.push_back(backend->create_tensor(node->get_element_type(), node->get_shape()));
+        }
+        backend->call_with_validate(backend->compile(evaluator), outputs, inputs);
+
+        for (size_t i = 0; i < frontier.size(); i++)
+        {
+            vector<char> data(tensor_bytes(frontier[i]->get_outputs().at(0)));
+            outputs[i]->read(data.data(), 0, data.size());
+            values.push_back(make_shared<op::Constant>(
+                frontier[i]->get_element_type(), frontier[i]->get_shape(), data.data()));
+        }
+    }
+    catch (const exception& e)
+    {
+        NGRAPH_DEBUG << "Constant subgraphs not folded on " << m_backend_name << ": " << e.what();
+        return false;
+    }
+
+    for (size_t i = 0; i < frontier.size(); i++)
+    {
+        replace_node(frontier[i], values[i]);
+    }
+    return true;
+}
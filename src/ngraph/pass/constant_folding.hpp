@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <string>
+
 #include "ngraph/pass/graph_rewrite.hpp"
 
 namespace ngraph
@@ -72,7 +74,27 @@ public:
         }
     }
 
+    /// Additionally folds every remaining subgraph computed from constants alone by evaluating
+    /// it once with the kernels of \p backend_name. A node is folded only if its result is no
+    /// larger than \p max_folded_size bytes or than its inputs combined.
+    ConstantFolding(const std::string& backend_name,
+                    size_t max_folded_size = default_max_folded_size)
+        : ConstantFolding()
+    {
+        m_backend_name = backend_name;
+        m_max_folded_size = max_folded_size;
+    }
+
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+    static const size_t default_max_folded_size = 16 * 1024 * 1024;
+
 private:
+    bool fold_constant_subgraphs(const std::shared_ptr<ngraph::Function>& f);
+
+    std::string m_backend_name;
+    size_t m_max_folded_size = 0;
+
     void construct_constant_reshape();
     void construct_constant_broadcast();
     void construct_constant_pad();
@@ -26,13 +26,19 @@
 #include "ngraph/op/broadcast.hpp"
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/divide.hpp"
+#include "ngraph/op/dot.hpp"
 #include "ngraph/op/exp.hpp"
+#include "ngraph/op/experimental/quantized_conv.hpp"
+#include "ngraph/op/experimental/quantized_conv_bias.hpp"
+#include "ngraph/op/experimental/quantized_conv_relu.hpp"
 #include "ngraph/op/max_pool.hpp"
 #include "ngraph/op/maximum.hpp"
 #include "ngraph/op/multiply.hpp"
 #include "ngraph/op/negative.hpp"
 #include "ngraph/op/parameter.hpp"
+#include "ngraph/op/quantize.hpp"
 #include "ngraph/op/relu.hpp"
 #include "ngraph/op/reshape.hpp"
 #include "ngraph/op/sigmoid.hpp"
@@ -380,6 +386,396 @@ void pass::CoreFusion::construct_conv_affine_folding()
     this->add_matcher(m);
 }
 
+// Returns the per-column values of a broadcast onto a rank-2 Dot output, or nullptr
+// if `bcast` is not a scalar or a row vector broadcast along axis 0.
+static shared_ptr<Node> get_column_bcast_input(const shared_ptr<Node>& node)
+{
+    auto bcast = std::dynamic_pointer_cast<op::Broadcast>(node);
+    if (!bcast || bcast->get_shape().size() != 2)
+    {
+        return nullptr;
+    }
+
+    auto arg = bcast->get_argument(0);
+    if (arg->get_shape().size() == 0)
+    {
+        return std::make_shared<op::Broadcast>(arg, Shape{bcast->get_shape()[1]}, AxisSet{0});
+    }
+    if (arg->get_shape().size() == 1 && bcast->get_broadcast_axes() == AxisSet{0})
+    {
+        return arg;
+    }
+    return nullptr;
+}
+
+static bool is_foldable_dot(const shared_ptr<op::Dot>& dot)
+{
+    return dot->get_reduction_axes_count() == 1 && dot->get_shape().size() == 2 &&
+           dot->get_argument(0)->get_shape().size() == 2 &&
+           dot->get_argument(1)->get_shape().size() == 2;
+}
+
+// x . W scaled per column by A_c equals x . (W * A_c)
+static shared_ptr<Node> make_scaled_dot(const shared_ptr<Node>& input,
+                                        const shared_ptr<Node>& weights,
+                                        const shared_ptr<Node>& Ac)
+{
+    auto weights_n = std::make_shared<op::Multiply>(
+        weights, std::make_shared<op::Broadcast>(Ac, weights->get_shape(), AxisSet{0}));
+    return std::make_shared<op::Dot>(input, weights_n);
+}
+
+void pass::CoreFusion::construct_folded_batch_norm_dot()
+{
+    // BatchNorm (Dot (input, weights)) -> Dot (input, weights * scale) + bias
+    auto input = std::make_shared<pattern::op::Label>(element::f32, Shape{2, 3});
+    auto weights = std::make_shared<pattern::op::Label>(element::f32, Shape{3, 4});
+    auto pdot = std::make_shared<op::Dot>(input, weights);
+
+    auto mean = std::make_shared<pattern::op::Label>(element::f32, Shape{4});
+    auto var = std::make_shared<pattern::op::Label>(element::f32, Shape{4});
+    auto gamma = std::make_shared<pattern::op::Label>(element::f32, Shape{4});
+    auto beta = std::make_shared<pattern::op::Label>(element::f32, Shape{4});
+    double eps = 0.001;
+    auto bn = std::make_shared<op::BatchNormInference>(eps, gamma, beta, pdot, mean, var);
+
+    ngraph::pattern::graph_rewrite_callback callback = [input, weights, mean, var, gamma, beta](
+        pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for folded batch norm dot against node = "
+                     << m.get_match_root()->get_name();
+        auto pattern_map = m.get_pattern_map();
+
+        auto m_bn = std::static_pointer_cast<op::BatchNormInference>(m.get_match_root());
+        auto m_dot = std::static_pointer_cast<op::Dot>(m_bn->get_argument(2));
+
+        if (m_dot->get_users(true).size() > 1 || !is_foldable_dot(m_dot) ||
+            m_bn->get_element_type() != element::f32)
+        {
+            return false;
+        }
+
+        // new weights = old weights * gamma / sqrt(variance + epsilon)
+        // new biases = -mean * gamma / sqrt(variance + epsilon) + beta
+
+        auto bn_eps = op::Constant::create(element::f32, Shape{}, {m_bn->get_eps_value()});
+        auto var_eps = std::make_shared<op::Add>(
+            pattern_map[var],
+            std::make_shared<op::Broadcast>(bn_eps, pattern_map[var]->get_shape(), AxisSet{0}));
+        auto sqrt_var_eps = std::make_shared<op::Sqrt>(var_eps);
+
+        auto mean_gamma = std::make_shared<op::Multiply>(pattern_map[mean], pattern_map[gamma]);
+        auto new_biases = std::make_shared<op::Subtract>(
+            pattern_map[beta], std::make_shared<op::Divide>(mean_gamma, sqrt_var_eps));
+        auto weight_scaling = std::make_shared<op::Divide>(pattern_map[gamma], sqrt_var_eps);
+
+        auto dot = make_scaled_dot(pattern_map[input], pattern_map[weights], weight_scaling);
+        auto dot_bias =
+            dot + std::make_shared<op::Broadcast>(new_biases, dot->get_shape(), AxisSet{0});
+        ngraph::replace_node(m.get_match_root(), dot_bias);
+
+        return true;
+    };
+
+    auto m =
+        std::make_shared<ngraph::pattern::Matcher>(bn, callback, "CoreFusion.FoldedBatchNormDot");
+    this->add_matcher(m);
+}
+
+void pass::CoreFusion::construct_dot_affine_folding()
+{
+    // A * Dot (input, weights) -> Dot (input, weights * A_c)
+    auto input = std::make_shared<pattern::op::Label>(element::f32, Shape{2, 3});
+    auto weights = std::make_shared<pattern::op::Label>(element::f32, Shape{3, 4});
+    auto pdot = std::make_shared<op::Dot>(input, weights);
+    auto dot_label = std::make_shared<pattern::op::Label>(pdot, nullptr, NodeVector{pdot});
+
+    auto Ac = std::make_shared<pattern::op::Label>(element::f32, Shape{4});
+    auto A = std::make_shared<op::Broadcast>(Ac, Shape{2, 4}, AxisSet{0});
+    auto A_label = std::make_shared<pattern::op::Label>(A, nullptr, NodeVector{A});
+    auto multiply = std::make_shared<op::Multiply>(dot_label, A_label);
+
+    ngraph::pattern::graph_rewrite_callback callback = [input, weights, dot_label, A_label](
+        pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for dot affine folding against node = "
+                     << m.get_match_root()->get_name();
+        auto pattern_map = m.get_pattern_map();
+
+        auto dot_m = std::static_pointer_cast<op::Dot>(pattern_map[dot_label]);
+        if (dot_m->get_users(true).size() > 1 || !is_foldable_dot(dot_m))
+        {
+            return false;
+        }
+
+        auto Ac_m = get_column_bcast_input(pattern_map[A_label]);
+        if (!Ac_m)
+        {
+            return false;
+        }
+
+        ngraph::replace_node(m.get_match_root(),
+                             make_scaled_dot(pattern_map[input], pattern_map[weights], Ac_m));
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(
+        multiply, callback, "CoreFusion.DotAffineFolding");
+    this->add_matcher(m);
+}
+
+void pass::CoreFusion::construct_dot_bias_affine_folding()
+{
+    // A * (Dot (input, weights) + B) -> Dot (input, weights * A_c) + B_c * A_c
+    auto input = std::make_shared<pattern::op::Label>(element::f32, Shape{2, 3});
+    auto weights = std::make_shared<pattern::op::Label>(element::f32, Shape{3, 4});
+    auto pdot = std::make_shared<op::Dot>(input, weights);
+    auto dot_label = std::make_shared<pattern::op::Label>(pdot, nullptr, NodeVector{pdot});
+
+    auto Bc = std::make_shared<pattern::op::Label>(element::f32, Shape{4});
+    auto B = std::make_shared<op::Broadcast>(Bc, Shape{2, 4}, AxisSet{0});
+    auto B_label = std::make_shared<pattern::op::Label>(B, nullptr, NodeVector{B});
+    auto padd = std::make_shared<op::Add>(dot_label, B_label);
+    auto add_label = std::make_shared<pattern::op::Label>(padd, nullptr, NodeVector{padd});
+
+    auto Ac = std::make_shared<pattern::op::Label>(element::f32, Shape{4});
+    auto A = std::make_shared<op::Broadcast>(Ac, Shape{2, 4}, AxisSet{0});
+    auto A_label = std::make_shared<pattern::op::Label>(A, nullptr, NodeVector{A});
+    auto multiply = std::make_shared<op::Multiply>(add_label, A_label);
+
+    ngraph::pattern::graph_rewrite_callback callback =
+        [input, weights, dot_label, add_label, A_label, B_label](pattern::Matcher& m) {
+            NGRAPH_DEBUG << "In callback for dot bias affine folding against node = "
+                         << m.get_match_root()->get_name();
+            auto pattern_map = m.get_pattern_map();
+
+            // Only live users count: folding the inner part of a chain earlier in this pass
+            // leaves the replaced nodes attached to the Dot until the pass finishes
+            auto dot_m = std::static_pointer_cast<op::Dot>(pattern_map[dot_label]);
+            if (dot_m->get_users(true).size() > 1 ||
+                pattern_map[add_label]->get_users(true).size() > 1 || !is_foldable_dot(dot_m))
+            {
+                return false;
+            }
+
+            auto Ac_m = get_column_bcast_input(pattern_map[A_label]);
+            auto Bc_m = get_column_bcast_input(pattern_map[B_label]);
+            if (!Ac_m || !Bc_m)
+            {
+                return false;
+            }
+
+            auto dot_n = make_scaled_dot(pattern_map[input], pattern_map[weights], Ac_m);
+            auto bias_n = std::make_shared<op::Multiply>(Bc_m, Ac_m);
+            auto dot_bias =
+                dot_n + std::make_shared<op::Broadcast>(bias_n, dot_n->get_shape(), AxisSet{0});
+            ngraph::replace_node(m.get_match_root(), dot_bias);
+
+            return true;
+        };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(
+        multiply, callback, "CoreFusion.DotBiasAffineFolding");
+    this->add_matcher(m);
+}
+
+void pass::CoreFusion::construct_dot_bias_chain_folding()
+{
+    // (Dot (input, weights) + B1) + B2 -> Dot (input, weights) + (B1_c + B2_c)
+    auto input = std::make_shared<pattern::op::Label>(element::f32, Shape{2, 3});
+    auto weights = std::make_shared<pattern::op::Label>(element::f32, Shape{3, 4});
+    auto pdot = std::make_shared<op::Dot>(input, weights);
+    auto dot_label = std::make_shared<pattern::op::Label>(pdot, nullptr, NodeVector{pdot});
+
+    auto B1c = std::make_shared<pattern::op::Label>(element::f32, Shape{4});
+    auto B1 = std::make_shared<op::Broadcast>(B1c, Shape{2, 4}, AxisSet{0});
+    auto B1_label = std::make_shared<pattern::op::Label>(B1, nullptr, NodeVector{B1});
+    auto padd = std::make_shared<op::Add>(dot_label, B1_label);
+    auto add_label = std::make_shared<pattern::op::Label>(padd, nullptr, NodeVector{padd});
+
+    auto B2c = std::make_shared<pattern::op::Label>(element::f32, Shape{4});
+    auto B2 = std::make_shared<op::Broadcast>(B2c, Shape{2, 4}, AxisSet{0});
+    auto B2_label = std::make_shared<pattern::op::Label>(B2, nullptr, NodeVector{B2});
+    auto add = std::make_shared<op::Add>(add_label, B2_label);
+
+    ngraph::pattern::graph_rewrite_callback callback =
+        [dot_label, add_label, B1_label, B2_label](pattern::Matcher& m) {
+            NGRAPH_DEBUG << "In callback for dot bias chain folding against node = "
+                         << m.get_match_root()->get_name();
+            auto pattern_map = m.get_pattern_map();
+
+            auto dot_m = std::static_pointer_cast<op::Dot>(pattern_map[dot_label]);
+            if (pattern_map[add_label]->get_users(true).size() > 1 || !is_foldable_dot(dot_m))
+            {
+                return false;
+            }
+
+            auto B1c_m = get_column_bcast_input(pattern_map[B1_label]);
+            auto B2c_m = get_column_bcast_input(pattern_map[B2_label]);
+            if (!B1c_m || !B2c_m)
+            {
+                return false;
+            }
+
+            auto bias_n = std::make_shared<op::Add>(B1c_m, B2c_m);
+            auto dot_bias =
+                dot_m + std::make_shared<op::Broadcast>(bias_n, dot_m->get_shape(), AxisSet{0});
+            ngraph::replace_node(m.get_match_root(), dot_bias);
+
+            return true;
+        };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(
+        add, callback, "CoreFusion.DotBiasChainFolding");
+    this->add_matcher(m);
+}
+
+// Extracts the value of a positive f32 constant that is the same for every element,
+// either as a Constant or as a Broadcast of a scalar Constant.
+static bool get_uniform_positive_constant(shared_ptr<Node> node, float& value)
+{
+    if (auto bcast = std::dynamic_pointer_cast<op::Broadcast>(node))
+    {
+        node = bcast->get_argument(0);
+        if (node->get_shape().size() != 0)
+        {
+            return false;
+        }
+    }
+
+    auto constant = std::dynamic_pointer_cast<op::Constant>(node);
+    if (!constant || constant->get_element_type() != element::f32)
+    {
+        return false;
+    }
+
+    auto values = constant->get_vector<float>();
+    if (values.empty() || !(values[0] > 0))
+    {
+        return false;
+    }
+    value = values[0];
+    return std::all_of(values.begin(), values.end(), [value](float v) { return v == value; });
+}
+
+static bool is_quantized_conv(shared_ptr<Node> node)
+{
+    return std::dynamic_pointer_cast<op::QuantizedConvolution>(node) ||
+           std::dynamic_pointer_cast<op::QuantizedConvolutionRelu>(node) ||
+           std::dynamic_pointer_cast<op::QuantizedConvolutionBias>(node) ||
+           std::dynamic_pointer_cast<op::QuantizedConvolutionBiasAdd>(node) ||
+           std::dynamic_pointer_cast<op::QuantizedConvolutionBiasSignedAdd>(node);
+}
+
+static shared_ptr<Node> scale_constant(const shared_ptr<op::Constant>& scale, float factor)
+{
+    auto values = scale->get_vector<float>();
+    for (auto& v : values)
+    {
+        v *= factor;
+    }
+    return std::make_shared<op::Constant>(element::f32, scale->get_shape(), values);
+}
+
+static bool is_uniform_positive_constant(shared_ptr<Node> node)
+{
+    float value;
+    return get_uniform_positive_constant(node, value);
+}
+
+void pass::CoreFusion::construct_quantized_conv_scale_folding()
+{
+    // A * Dequantize (QuantizedConv (...), scale, offset)
+    //     -> Dequantize (QuantizedConv (...), scale * A, offset)
+    auto qconv =
+        std::make_shared<pattern::op::Label>(element::i8, Shape{1, 2, 2, 2}, is_quantized_conv);
+    auto scale = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto offset = std::make_shared<pattern::op::Label>(element::i8, Shape{});
+    auto dequantize =
+        std::make_shared<op::Dequantize>(qconv, scale, offset, element::f32, AxisSet{});
+    auto dequantize_label =
+        std::make_shared<pattern::op::Label>(dequantize, nullptr, NodeVector{dequantize});
+    auto A = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{1, 2, 2, 2}, is_uniform_positive_constant);
+    auto multiply = std::make_shared<op::Multiply>(dequantize_label, A);
+
+    ngraph::pattern::graph_rewrite_callback callback =
+        [qconv, scale, offset, dequantize_label, A](pattern::Matcher& m) {
+            NGRAPH_DEBUG << "In callback for quantized conv scale folding against node = "
+                         << m.get_match_root()->get_name();
+            auto pattern_map = m.get_pattern_map();
+
+            auto dequantize_m =
+                std::static_pointer_cast<op::Dequantize>(pattern_map[dequantize_label]);
+            auto scale_m = std::dynamic_pointer_cast<op::Constant>(pattern_map[scale]);
+            if (dequantize_m->get_users(true).size() > 1 || !scale_m ||
+                scale_m->get_element_type() != element::f32)
+            {
+                return false;
+            }
+
+            float factor;
+            get_uniform_positive_constant(pattern_map[A], factor);
+            auto dequantize_n = std::make_shared<op::Dequantize>(pattern_map[qconv],
+                                                                 scale_constant(scale_m, factor),
+                                                                 pattern_map[offset],
+                                                                 dequantize_m->get_element_type(),
+                                                                 dequantize_m->get_axes());
+            ngraph::replace_node(m.get_match_root(), dequantize_n);
+            return true;
+        };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(
+        multiply, callback, "CoreFusion.QuantizedConvScaleFolding");
+    this->add_matcher(m);
+}
+
+void pass::CoreFusion::construct_quantize_scale_folding()
+{
+    // Quantize (input * A, scale, offset) -> Quantize (input, scale / A, offset)
+    auto input = std::make_shared<pattern::op::Label>(element::f32, Shape{1, 2, 2, 2});
+    auto A = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{1, 2, 2, 2}, is_uniform_positive_constant);
+    auto multiply = std::make_shared<op::Multiply>(input, A);
+    auto scale = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto offset = std::make_shared<pattern::op::Label>(element::i8, Shape{});
+    auto quantize = std::make_shared<op::Quantize>(
+        multiply,
+        scale,
+        offset,
+        element::i8,
+        AxisSet{},
+        op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN);
+
+    ngraph::pattern::graph_rewrite_callback callback = [input, A, scale, offset](
+        pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for quantize scale folding against node = "
+                     << m.get_match_root()->get_name();
+        auto pattern_map = m.get_pattern_map();
+
+        auto quantize_m = std::static_pointer_cast<op::Quantize>(m.get_match_root());
+        auto scale_m = std::dynamic_pointer_cast<op::Constant>(pattern_map[scale]);
+        if (quantize_m->get_argument(0)->get_users(true).size() > 1 || !scale_m ||
+            scale_m->get_element_type() != element::f32)
+        {
+            return false;
+        }
+
+        float factor;
+        get_uniform_positive_constant(pattern_map[A], factor);
+        auto quantize_n = std::make_shared<op::Quantize>(pattern_map[input],
+                                                         scale_constant(scale_m, 1.0f / factor),
+                                                         pattern_map[offset],
+                                                         quantize_m->get_element_type(),
+                                                         quantize_m->get_axes(),
+                                                         quantize_m->get_round_mode());
+        ngraph::replace_node(m.get_match_root(), quantize_n);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(
+        quantize, callback, "CoreFusion.QuantizeScaleFolding");
+    this->add_matcher(m);
+}
+
 static bool is_trivial_convolution(std::shared_ptr<op::Convolution> conv,
                                    bool skip_pad_checks = false)
 {
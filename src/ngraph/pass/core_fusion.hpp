@@ -35,6 +35,12 @@ public:
         construct_relu();
         construct_folded_batch_norm();
         construct_conv_affine_folding();
+        construct_folded_batch_norm_dot();
+        construct_dot_affine_folding();
+        construct_dot_bias_affine_folding();
+        construct_dot_bias_chain_folding();
+        construct_quantized_conv_scale_folding();
+        construct_quantize_scale_folding();
         construct_sigmoid();
         construct_sigmoid_bprop();
         construct_optimized_strided_conv();
@@ -44,6 +50,12 @@ public:
     void construct_relu();
     void construct_folded_batch_norm();
     void construct_conv_affine_folding();
+    void construct_folded_batch_norm_dot();
+    void construct_dot_affine_folding();
+    void construct_dot_bias_affine_folding();
+    void construct_dot_bias_chain_folding();
+    void construct_quantized_conv_scale_folding();
+    void construct_quantize_scale_folding();
     void construct_sigmoid();
     void construct_sigmoid_bprop();
     void construct_optimized_strided_conv();
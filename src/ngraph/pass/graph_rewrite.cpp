@@ -15,14 +15,18 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <deque>
 #include <iostream>
 #include <regex>
+#include <typeindex>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 #include "graph_rewrite.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/pattern/matcher.hpp"
+#include "ngraph/pattern/op/pattern.hpp"
 
 // GraphRewrite algorithm:
 // GraphRewrite processes an input graph in an topological order(i.e. args before users)
@@ -55,6 +59,72 @@
 // b) you are modifying nodes after the current node in the topological order
 // c) there's no linear order of fusions which will give
 //    the correct final fusion. i.e. the same fusion needs to occur before and after some other fusion
+//
+// Matchers are only called on nodes they can match. A pattern rooted at a regular op only matches
+// nodes of exactly that type, while patterns rooted at a Label, Any, AnyOf or Skip are called on
+// every node.
+
+namespace
+{
+    // Matchers applicable to each type of node, in the order they were registered
+    template <typename MatcherType>
+    class MatcherIndex
+    {
+    public:
+        MatcherIndex(const std::vector<std::shared_ptr<MatcherType>>& matchers)
+            : m_matchers(matchers)
+        {
+        }
+
+        const std::vector<std::shared_ptr<MatcherType>>& get_matchers(const ngraph::Node& node)
+        {
+            std::type_index type(typeid(node));
+            auto it = m_index.find(type);
+            if (it == m_index.end())
+            {
+                std::vector<std::shared_ptr<MatcherType>> matchers;
+                for (const auto& matcher : m_matchers)
+                {
+                    if (can_match(*matcher, type))
+                    {
+                        matchers.push_back(matcher);
+                    }
+                }
+                it = m_index.insert({type, matchers}).first;
+            }
+            return it->second;
+        }
+
+    private:
+        static bool can_match(ngraph::pattern::Matcher& matcher, std::type_index type)
+        {
+            // Derived matchers may override how nodes are matched
+            if (typeid(matcher) != typeid(ngraph::pattern::Matcher))
+            {
+                return true;
+            }
+            return can_match(matcher.get_pattern(), type);
+        }
+
+        static bool can_match(ngraph::pattern::RecurrentMatcher& matcher, std::type_index type)
+        {
+            return can_match(matcher.get_pattern(), type);
+        }
+
+        static bool can_match(const std::shared_ptr<ngraph::Node>& pattern, std::type_index type)
+        {
+            if (!pattern || std::dynamic_pointer_cast<ngraph::pattern::op::Pattern>(pattern))
+            {
+                return true;
+            }
+            auto& pattern_node = *pattern;
+            return std::type_index(typeid(pattern_node)) == type;
+        }
+
+        const std::vector<std::shared_ptr<MatcherType>>& m_matchers;
+        std::unordered_map<std::type_index, std::vector<std::shared_ptr<MatcherType>>> m_index;
+    };
+}
 
 bool ngraph::pass::GraphRewrite::run_on_function(std::shared_ptr<ngraph::Function> f)
 {
@@ -67,9 +137,11 @@ bool ngraph::pass::GraphRewrite::run_on_function(std::shared_ptr<ngraph::Functio
         rewritten = false;
         std::vector<std::shared_ptr<pattern::Matcher>> matchers{m_matchers};
         m_matchers.clear();
-        for (auto node : f->get_ordered_ops())
+        MatcherIndex<pattern::Matcher> index(matchers);
+        auto ordered_ops = f->get_ordered_ops_view();
+        for (auto node : *ordered_ops)
         {
-            for (auto matcher : matchers)
+            for (auto matcher : index.get_matchers(*node))
             {
                 NGRAPH_DEBUG << "Running matcher " << matcher->get_name() << "("
                              << matcher->get_pattern()->get_name() << ") on " << node->get_name();
@@ -136,28 +208,107 @@ void ngraph::pass::GraphRewrite::add_matcher(std::shared_ptr<pattern::Matcher> m
 
 bool ngraph::pass::RecurrentGraphRewrite::run_on_function(std::shared_ptr<ngraph::Function> f)
 {
-    bool changed = false;
-    size_t i = 0;
-    do
+    // Nodes are visited users first, so a recurrent match starts at the topmost cell of a
+    // chain. A callback may replace any node of the cells it matched, not only the match root,
+    // so after a rewrite the nodes of the matched cells and the nodes they fed are visited
+    // again, along with their arguments and users.
+    MatcherIndex<pattern::RecurrentMatcher> index(m_matchers);
+    std::deque<std::shared_ptr<Node>> worklist;
+    std::unordered_set<Node*> queued;
+    auto revisit = [&](const std::shared_ptr<Node>& node) {
+        if (queued.insert(node.get()).second)
+        {
+            worklist.push_front(node);
+        }
+    };
+    auto ordered_ops = f->get_ordered_ops_view();
+    for (auto it = ordered_ops->rbegin(); it != ordered_ops->rend(); ++it)
     {
-        for (auto node : f->get_ops())
+        worklist.push_back(*it);
+        queued.insert(it->get());
+    }
+
+    // Replaced nodes are no longer part of the function, and neither are the nodes only they
+    // still use
+    std::unordered_set<Node*> replaced;
+    auto mark_replaced = [&](const std::shared_ptr<Node>& node) {
+        if (!node->get_users().empty() || node->is_output() || !replaced.insert(node.get()).second)
+        {
+            return;
+        }
+        std::vector<std::shared_ptr<Node>> stack{node};
+        while (!stack.empty())
         {
-            for (auto matcher : m_matchers)
+            auto dead = stack.back();
+            stack.pop_back();
+            for (auto arg : dead->get_arguments())
             {
-                NGRAPH_DEBUG << "Running matcher " << matcher << " on " << node->get_name();
-                if (matcher->match(node))
+                bool used = false;
+                for (auto user : arg->get_users())
                 {
-                    NGRAPH_DEBUG << "Matcher " << matcher << " matched " << node->get_name();
-                    if (matcher->process_match())
+                    used |= replaced.count(user.get()) == 0;
+                }
+                if (!used && replaced.insert(arg.get()).second)
+                {
+                    stack.push_back(arg);
+                }
+            }
+        }
+    };
+
+    size_t rewrites = 0;
+    while (!worklist.empty() && rewrites < m_num_iters)
+    {
+        auto node = worklist.front();
+        worklist.pop_front();
+        queued.erase(node.get());
+        mark_replaced(node);
+        if (replaced.count(node.get()) != 0)
+        {
+            continue;
+        }
+
+        for (auto matcher : index.get_matchers(*node))
+        {
+            NGRAPH_DEBUG << "Running matcher " << matcher << " on " << node->get_name();
+            if (!matcher->match(node))
+            {
+                continue;
+            }
+            NGRAPH_DEBUG << "Matcher " << matcher << " matched " << node->get_name();
+            NodeVector matched = matcher->get_bound_nodes();
+            matched.push_back(node);
+            NodeVector users;
+            for (auto& matched_node : matched)
+            {
+                for (auto& user : matched_node->get_users())
+                {
+                    users.push_back(user);
+                }
+            }
+            if (matcher->process_match())
+            {
+                rewrites++;
+                for (auto& matched_node : matched)
+                {
+                    mark_replaced(matched_node);
+                    users.push_back(matched_node);
+                }
+                for (auto& user : users)
+                {
+                    revisit(user);
+                    for (auto& arg : user->get_arguments())
                     {
-                        changed = true;
-                        goto next_fusion;
+                        revisit(arg);
+                    }
+                    for (auto& next : user->get_users())
+                    {
+                        revisit(next);
                     }
                 }
+                break;
             }
         }
-    next_fusion:
-        i++;
-    } while (changed && i < m_num_iters);
-    return changed;
+    }
+    return rewrites > 0;
 }
@@ -43,7 +43,8 @@ pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing)
 bool pass::MemoryLayout::run_on_function(shared_ptr<ngraph::Function> function)
 {
     MemoryManager mm(m_alignment, m_disable_memory_sharing);
-    for (shared_ptr<Node> node : function->get_ordered_ops())
+    auto ordered_ops = function->get_ordered_ops_view();
+    for (shared_ptr<Node> node : *ordered_ops)
     {
         std::map<descriptor::Tensor*, descriptor::Tensor*> in_place_outputs;
         std::set<const descriptor::Tensor*> reused_inputs;
@@ -209,6 +209,17 @@ namespace ngraph
                 return NodeVector{m_matches.at(pattern)};
             }
 
+            /// \brief Returns the nodes bound to any label in any of the matched cells
+            NodeVector get_bound_nodes() const
+            {
+                NodeVector bound_nodes;
+                for (auto& match : m_matches)
+                {
+                    bound_nodes.insert(bound_nodes.end(), match.second.begin(), match.second.end());
+                }
+                return bound_nodes;
+            }
+
             size_t get_number_of_recurrent_matches() const
             {
                 if (m_matches.size() == 0)
@@ -220,6 +231,7 @@ namespace ngraph
             }
 
             size_t get_number_of_bound_labels() const { return m_matches.size(); }
+            std::shared_ptr<Node> get_pattern() { return m_pattern; }
             /// \brief Tries to match a pattern for an individual cell to a given \p graph
             bool match(std::shared_ptr<Node> graph);
 
@@ -79,12 +79,13 @@ void runtime::Backend::validate(shared_ptr<const Function> function,
                << "'";
             throw runtime_error(ss.str());
         }
-        if (input_parameters[i]->get_shape() != inputs[i]->get_shape())
+        // Dynamic dimensions accept any size
+        const PartialShape& parameter_shape = input_parameters[i]->get_output_partial_shape(0);
+        if (!parameter_shape.compatible(inputs[i]->get_shape()))
         {
             stringstream ss;
             ss << "Input " << i << " shape {" << join(inputs[i]->get_shape())
-               << "} does not match Parameter shape {" << join(input_parameters[i]->get_shape())
-               << "}";
+               << "} does not match Parameter shape " << parameter_shape;
             throw runtime_error(ss.str());
         }
     }
@@ -98,11 +99,12 @@ void runtime::Backend::validate(shared_ptr<const Function> function,
                << "' does not match Result type '" << function->get_output_element_type(i) << "'";
             throw runtime_error(ss.str());
         }
-        if (function->get_output_shape(i) != outputs[i]->get_shape())
+        const PartialShape& result_shape = function->get_output_partial_shape(i);
+        if (!result_shape.compatible(outputs[i]->get_shape()))
         {
             stringstream ss;
             ss << "Output " << i << " shape {" << join(outputs[i]->get_shape())
-               << "} does not match Result shape {" << join(function->get_output_shape(i)) << "}";
+               << "} does not match Result shape " << result_shape;
             throw runtime_error(ss.str());
         }
     }
@@ -0,0 +1,323 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <sstream>
+
+#include "ngraph/except.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/runtime/batching_executor.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// The shape of a batched tensor with `rows` rows
+static Shape batch_shape(const PartialShape& pshape, size_t rows)
+{
+    if (pshape.rank().is_dynamic() || size_t(pshape.rank()) == 0)
+    {
+        throw ngraph_error("Batched parameters and results must have a static rank above zero");
+    }
+    PartialShape shape{pshape};
+    shape[0] = rows;
+    if (shape.is_dynamic())
+    {
+        throw ngraph_error("Only the first dimension of batched tensors may be dynamic");
+    }
+    return shape.to_shape();
+}
+
+runtime::BatchingExecutor::BatchingExecutor(Backend& backend,
+                                            const shared_ptr<Function>& function,
+                                            size_t max_batch_size,
+                                            chrono::microseconds max_delay,
+                                            vector<size_t> batch_sizes)
+    : m_backend(backend)
+    , m_function(function)
+    , m_max_batch_size(max_batch_size)
+    , m_max_delay(max_delay)
+{
+    if (max_batch_size == 0)
+    {
+        throw ngraph_error("The maximum batch size must be at least one");
+    }
+    if (batch_sizes.empty())
+    {
+        for (size_t size = 1; size < max_batch_size; size *= 2)
+        {
+            batch_sizes.push_back(size);
+        }
+    }
+    batch_sizes.push_back(max_batch_size);
+    sort(batch_sizes.begin(), batch_sizes.end());
+    batch_sizes.erase(unique(batch_sizes.begin(), batch_sizes.end()), batch_sizes.end());
+    batch_sizes.erase(upper_bound(batch_sizes.begin(), batch_sizes.end(), max_batch_size),
+                      batch_sizes.end());
+
+    const ParameterVector& params = function->get_parameters();
+    for (const shared_ptr<op::Parameter>& param : params)
+    {
+        const PartialShape& pshape = param->get_output_partial_shape(0);
+        m_batched_inputs.push_back(pshape.rank().is_dynamic() || pshape.is_dynamic());
+    }
+    for (const shared_ptr<op::Result>& result : function->get_results())
+    {
+        const PartialShape& pshape = result->get_output_partial_shape(0);
+        if (pshape.rank().is_static() && (size_t(pshape.rank()) == 0 || pshape[0].is_static()))
+        {
+            throw ngraph_error("Every result of a batched function must have a batch dimension");
+        }
+    }
+
+    for (size_t size : batch_sizes)
+    {
+        // Constants are cloned sharing their data, only the batched parameters are replaced
+        NodeMap node_map;
+        for (size_t i = 0; i < params.size(); i++)
+        {
+            if (m_batched_inputs[i])
+            {
+                node_map.add(params[i],
+                             make_shared<op::Parameter>(
+                                 params[i]->get_element_type(),
+                                 batch_shape(params[i]->get_output_partial_shape(0), size),
+                                 params[i]->get_cacheable()));
+            }
+            else
+            {
+                node_map.add(params[i], params[i]->copy_with_new_args({}));
+            }
+        }
+        Batch batch;
+        batch.m_size = size;
+        batch.m_function = clone_function(*function, node_map);
+        for (size_t i = 0; i < params.size(); i++)
+        {
+            const shared_ptr<op::Parameter>& param = batch.m_function->get_parameters()[i];
+            batch.m_inputs.push_back(
+                m_batched_inputs[i]
+                    ? backend.create_tensor(param->get_element_type(), param->get_shape())
+                    : nullptr);
+        }
+        for (size_t i = 0; i < batch.m_function->get_output_size(); i++)
+        {
+            batch.m_outputs.push_back(
+                backend.create_tensor(batch.m_function->get_output_element_type(i),
+                                       batch.m_function->get_output_shape(i)));
+        }
+        backend.compile(batch.m_function);
+        m_batches.push_back(move(batch));
+    }
+
+    m_worker = thread(&BatchingExecutor::run, this);
+}
+
+runtime::BatchingExecutor::~BatchingExecutor()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_queue_changed.notify_all();
+    m_worker.join();
+    for (const Batch& batch : m_batches)
+    {
+        m_backend.remove_compiled_function(batch.m_function);
+    }
+}
+
+future<runtime::BatchingExecutor::Latency>
+    runtime::BatchingExecutor::submit(const vector<shared_ptr<Tensor>>& outputs,
+                                      const vector<shared_ptr<Tensor>>& inputs)
+{
+    if (inputs.size() != m_batched_inputs.size() ||
+        outputs.size() != m_function->get_output_size())
+    {
+        throw ngraph_error("Number of tensors does not match the batched function");
+    }
+    Request request;
+    request.m_rows = 0;
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        if (m_batched_inputs[i])
+        {
+            const Shape& shape = inputs[i]->get_shape();
+            if (request.m_rows == 0 && !shape.empty())
+            {
+                request.m_rows = shape[0];
+            }
+            const PartialShape& pshape =
+                m_function->get_parameters()[i]->get_output_partial_shape(0);
+            if (request.m_rows == 0 || shape != batch_shape(pshape, request.m_rows))
+            {
+                stringstream ss;
+                ss << "Input " << i << " of shape " << shape << " does not match the batch";
+                throw ngraph_error(ss.str());
+            }
+        }
+    }
+    if (request.m_rows > m_max_batch_size)
+    {
+        throw ngraph_error("A request has more rows than the maximum batch size");
+    }
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        if (outputs[i]->get_shape() !=
+            batch_shape(m_function->get_output_partial_shape(i), request.m_rows))
+        {
+            stringstream ss;
+            ss << "Output " << i << " of shape " << outputs[i]->get_shape()
+               << " does not match the batch";
+            throw ngraph_error(ss.str());
+        }
+    }
+    request.m_outputs = outputs;
+    request.m_inputs = inputs;
+    request.m_submitted = Clock::now();
+    future<Latency> result = request.m_promise.get_future();
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_queued_rows += request.m_rows;
+        m_queue.push_back(move(request));
+    }
+    m_queue_changed.notify_all();
+    return result;
+}
+
+runtime::BatchingExecutor::Latency
+    runtime::BatchingExecutor::call(const vector<shared_ptr<Tensor>>& outputs,
+                                    const vector<shared_ptr<Tensor>>& inputs)
+{
+    return submit(outputs, inputs).get();
+}
+
+bool runtime::BatchingExecutor::can_join(const Request& first, const Request& request) const
+{
+    for (size_t i = 0; i < m_batched_inputs.size(); i++)
+    {
+        if (!m_batched_inputs[i] && first.m_inputs[i] != request.m_inputs[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void runtime::BatchingExecutor::run()
+{
+    unique_lock<mutex> lock(m_mutex);
+    while (true)
+    {
+        m_queue_changed.wait(lock, [&] { return m_stopping || !m_queue.empty(); });
+        if (m_queue.empty())
+        {
+            return;
+        }
+        m_queue_changed.wait_until(lock, m_queue.front().m_submitted + m_max_delay, [&] {
+            return m_stopping || m_queued_rows >= m_max_batch_size;
+        });
+
+        // Take the oldest request and every later one that fits alongside it
+        vector<Request> requests;
+        size_t rows = 0;
+        for (auto it = m_queue.begin(); it != m_queue.end();)
+        {
+            if (rows + it->m_rows <= m_max_batch_size &&
+                (requests.empty() || can_join(requests.front(), *it)))
+            {
+                rows += it->m_rows;
+                requests.push_back(move(*it));
+                it = m_queue.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        m_queued_rows -= rows;
+
+        lock.unlock();
+        run_batch(requests, rows);
+        lock.lock();
+    }
+}
+
+void runtime::BatchingExecutor::run_batch(vector<Request>& requests, size_t rows)
+{
+    Clock::time_point started = Clock::now();
+    try
+    {
+        Batch& batch = *find_if(m_batches.begin(), m_batches.end(), [&](const Batch& b) {
+            return b.m_size >= rows;
+        });
+
+        vector<shared_ptr<Tensor>> inputs = batch.m_inputs;
+        vector<char> buffer;
+        for (size_t i = 0; i < inputs.size(); i++)
+        {
+            if (!m_batched_inputs[i])
+            {
+                inputs[i] = requests.front().m_inputs[i];
+                continue;
+            }
+            size_t offset = 0;
+            for (const Request& request : requests)
+            {
+                size_t size = request.m_inputs[i]->get_size_in_bytes();
+                buffer.resize(size);
+                request.m_inputs[i]->read(buffer.data(), 0, size);
+                inputs[i]->write(buffer.data(), offset, size);
+                offset += size;
+            }
+        }
+
+        m_backend.call(batch.m_function, batch.m_outputs, inputs);
+
+        for (size_t i = 0; i < batch.m_outputs.size(); i++)
+        {
+            size_t offset = 0;
+            for (const Request& request : requests)
+            {
+                size_t size = request.m_outputs[i]->get_size_in_bytes();
+                buffer.resize(size);
+                batch.m_outputs[i]->read(buffer.data(), offset, size);
+                request.m_outputs[i]->write(buffer.data(), 0, size);
+                offset += size;
+            }
+        }
+    }
+    catch (...)
+    {
+        for (Request& request : requests)
+        {
+            request.m_promise.set_exception(current_exception());
+        }
+        return;
+    }
+
+    Clock::time_point finished = Clock::now();
+    for (Request& request : requests)
+    {
+        Latency latency;
+        latency.m_queue_microseconds = static_cast<size_t>(
+            chrono::duration_cast<chrono::microseconds>(started - request.m_submitted).count());
+        latency.m_total_microseconds = static_cast<size_t>(
+            chrono::duration_cast<chrono::microseconds>(finished - request.m_submitted).count());
+        latency.m_batch_rows = rows;
+        request.m_promise.set_value(latency);
+    }
+}
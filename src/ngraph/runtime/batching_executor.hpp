@@ -0,0 +1,129 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class BatchingExecutor;
+    }
+}
+
+/// \brief Coalesces concurrent requests to a Function into batches.
+///
+/// Parameters and results whose first dimension is dynamic are batched along that axis; the
+/// other parameters are passed through, and only requests sharing those tensors are batched
+/// together. The function is compiled once per batch size with preallocated batch tensors.
+/// A worker thread waits until max_batch_size rows are queued or the oldest request has waited
+/// max_delay, copies the queued inputs into the smallest batch that fits, runs it and copies
+/// each request's rows of the outputs back. Rows past the queued ones are left as they are,
+/// so batching is only correct when rows are computed independently.
+class ngraph::runtime::BatchingExecutor
+{
+public:
+    /// \brief Timing of a completed request
+    struct Latency
+    {
+        /// Microseconds from submit() until the request's batch started
+        size_t m_queue_microseconds;
+        /// Microseconds from submit() until the outputs were written
+        size_t m_total_microseconds;
+        /// Number of queued rows that ran in the same batch
+        size_t m_batch_rows;
+    };
+
+    /// \param backend The backend to compile and run on, it must outlive the executor.
+    /// \param function The function to run, batched parameters and results must have a dynamic
+    ///     first dimension and static other dimensions.
+    /// \param max_batch_size The largest number of rows run at once.
+    /// \param max_delay How long the oldest request may wait for a batch to fill up.
+    /// \param batch_sizes The batch sizes to compile, by default the powers of two below
+    ///     max_batch_size and max_batch_size itself.
+    BatchingExecutor(Backend& backend,
+                     const std::shared_ptr<Function>& function,
+                     size_t max_batch_size,
+                     std::chrono::microseconds max_delay,
+                     std::vector<size_t> batch_sizes = {});
+    ~BatchingExecutor();
+
+    /// \brief Queues a request. Batched tensors have the same number of rows in their first
+    ///     dimension, at most max_batch_size. The tensors must not be used until the returned
+    ///     future is ready, which rethrows any error of the batch the request ran in.
+    std::future<Latency> submit(const std::vector<std::shared_ptr<Tensor>>& outputs,
+                                const std::vector<std::shared_ptr<Tensor>>& inputs);
+
+    /// \brief Queues a request and waits for it
+    Latency call(const std::vector<std::shared_ptr<Tensor>>& outputs,
+                 const std::vector<std::shared_ptr<Tensor>>& inputs);
+
+private:
+    BatchingExecutor(const BatchingExecutor&) = delete;
+    BatchingExecutor& operator=(const BatchingExecutor&) = delete;
+
+    using Clock = std::chrono::steady_clock;
+
+    struct Request
+    {
+        std::vector<std::shared_ptr<Tensor>> m_outputs;
+        std::vector<std::shared_ptr<Tensor>> m_inputs;
+        size_t m_rows;
+        Clock::time_point m_submitted;
+        std::promise<Latency> m_promise;
+    };
+
+    // The function compiled for one batch size, with its batch tensors
+    struct Batch
+    {
+        size_t m_size;
+        std::shared_ptr<Function> m_function;
+        std::vector<std::shared_ptr<Tensor>> m_inputs;
+        std::vector<std::shared_ptr<Tensor>> m_outputs;
+    };
+
+    void run();
+    void run_batch(std::vector<Request>& requests, size_t rows);
+    bool can_join(const Request& first, const Request& request) const;
+
+    Backend& m_backend;
+    std::shared_ptr<Function> m_function;
+    size_t m_max_batch_size;
+    std::chrono::microseconds m_max_delay;
+    std::vector<bool> m_batched_inputs;
+    // Ordered by size
+    std::vector<Batch> m_batches;
+
+    std::mutex m_mutex;
+    std::condition_variable m_queue_changed;
+    std::deque<Request> m_queue;
+    size_t m_queued_rows = 0;
+    bool m_stopping = false;
+    std::thread m_worker;
+};
@@ -18,8 +18,6 @@
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
-#include "ngraph/runtime/cpu/op/group_conv.hpp"
-#include "ngraph/runtime/cpu/op/group_conv_bias.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -35,46 +33,21 @@ namespace ngraph
             {
                 auto& functors = external_function->get_functors();
 
+                if (external_function->is_precomputed_constant(out[0].get_name()))
+                {
+                    // The reordered weights were computed once at build time
+                    functors.emplace_back([](CPURuntimeContext*, CPUExecutionContext*) {});
+                    return;
+                }
+
                 auto& arg_tensor = external_function->get_tensor_data(args[0].get_name());
                 auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
 
                 auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
 
-                auto input_desc = mkldnn_utils::get_input_mkldnn_md(node, 0);
+                auto input_desc = mkldnn_utils::get_convert_layout_input_md(node);
                 auto result_desc = mkldnn_utils::get_output_mkldnn_md(node, 0);
 
-                if (input_desc.data.format == mkldnn_nchw &&
-                    result_desc.data.format == mkldnn_goihw)
-                {
-                    //becomes a copy
-                    input_desc = result_desc;
-                }
-                else if (input_desc.data.format == mkldnn_nchw && input_desc.data.ndims == 4 &&
-                         result_desc.data.ndims == 5 && node->get_users().size() == 1)
-                {
-                    Shape weights_shape_groups;
-                    if (auto gconv = std::dynamic_pointer_cast<ngraph::op::GroupConvolution>(
-                            node->get_users()[0]))
-                    {
-                        weights_shape_groups = gconv->get_weights_dimensions();
-                    }
-                    else if (auto gconvb =
-                                 std::dynamic_pointer_cast<ngraph::op::GroupConvolutionBias>(
-                                     node->get_users()[0]))
-                    {
-                        weights_shape_groups = gconvb->get_weights_dimensions();
-                    }
-                    else
-                    {
-                        throw ngraph_error("Incompatible input/output shape in ConvertLayout op");
-                    }
-                    input_desc = mkldnn::memory::desc(
-                        mkldnn::memory::dims(weights_shape_groups.begin(),
-                                             weights_shape_groups.end()),
-                        mkldnn_utils::get_mkldnn_data_type(args[0].get_element_type()),
-                        mkldnn::memory::format::goihw);
-                }
-
                 size_t reorder_index = mkldnn_emitter->build_reorder(input_desc, result_desc);
 
                 auto& deps = mkldnn_emitter->get_primitive_deps(reorder_index);
@@ -70,7 +70,17 @@ shared_ptr<runtime::Tensor> runtime::cpu::CPU_Backend::create_tensor(
 runtime::Handle runtime::cpu::CPU_Backend::compile(shared_ptr<Function> func)
 {
     FunctionInstance& instance = m_function_map[func];
-    if (instance.m_external_function == nullptr)
+    if (instance.m_specializations == nullptr && SpecializationCache::is_dynamic(*func))
+    {
+        instance.m_specializations =
+            make_shared<SpecializationCache>(func, instance.m_specialization_capacity);
+        for (const auto& entry : instance.m_shape_buckets)
+        {
+            instance.m_specializations->set_buckets(
+                entry.first.first, entry.first.second, entry.second);
+        }
+    }
+    else if (instance.m_external_function == nullptr && instance.m_specializations == nullptr)
     {
         instance.m_external_function = make_shared<CPU_ExternalFunction>(func);
         instance.m_external_function->m_emit_timing = instance.m_performance_counters_enabled;
@@ -84,6 +94,10 @@ std::shared_ptr<ngraph::runtime::cpu::CPU_CallFrame>
     runtime::cpu::CPU_Backend::get_call_frame(std::shared_ptr<Function> func)
 {
     FunctionInstance& instance = m_function_map[func];
+    if (SpecializationCache::is_dynamic(*func))
+    {
+        throw ngraph_error("A function with dynamic shapes has no single call frame");
+    }
     if (instance.m_external_function == nullptr)
     {
         auto rc = compile(func);
@@ -103,6 +117,10 @@ bool runtime::cpu::CPU_Backend::call(shared_ptr<Function> func,
     bool rc = true;
 
     FunctionInstance& instance = m_function_map[func];
+    if (instance.m_specializations != nullptr)
+    {
+        return instance.m_specializations->call(*this, outputs, inputs);
+    }
     if (instance.m_external_function == nullptr)
     {
         throw runtime_error("compile() must be called before call().");
@@ -115,6 +133,13 @@ bool runtime::cpu::CPU_Backend::call(shared_ptr<Function> func,
 
 void runtime::cpu::CPU_Backend::remove_compiled_function(shared_ptr<Function> func)
 {
+    auto it = m_function_map.find(func);
+    if (it != m_function_map.end() && it->second.m_specializations != nullptr)
+    {
+        // Keep the cache alive while it removes its specializations from m_function_map
+        shared_ptr<SpecializationCache> specializations = it->second.m_specializations;
+        specializations->clear(*this);
+    }
     m_function_map.erase(func);
 }
 
@@ -146,6 +171,30 @@ vector<runtime::PerformanceCounter>
     return rc;
 }
 
+void runtime::cpu::CPU_Backend::set_shape_buckets(shared_ptr<Function> func,
+                                                  size_t param_index,
+                                                  size_t axis,
+                                                  const vector<size_t>& buckets)
+{
+    FunctionInstance& instance = m_function_map[func];
+    instance.m_shape_buckets[{param_index, axis}] = buckets;
+    if (instance.m_specializations != nullptr)
+    {
+        instance.m_specializations->set_buckets(param_index, axis, buckets);
+    }
+}
+
+void runtime::cpu::CPU_Backend::set_specialization_capacity(shared_ptr<Function> func,
+                                                            size_t capacity)
+{
+    FunctionInstance& instance = m_function_map[func];
+    instance.m_specialization_capacity = capacity;
+    if (instance.m_specializations != nullptr)
+    {
+        instance.m_specializations->set_capacity(capacity);
+    }
+}
+
 bool runtime::cpu::CPU_Backend::is_supported(const Node& op) const
 {
     return true;
@@ -18,8 +18,11 @@
 
 #include <map>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/specialization_cache.hpp"
 
 namespace ngraph
 {
@@ -61,6 +64,17 @@ namespace ngraph
                 bool is_supported(const Node& node) const override;
                 bool is_supported_property(const Property prop) const override;
 
+                /// \brief Sets the sizes the batch axis `axis` of parameter `param_index` of func
+                /// is rounded up to when it is specialized for the shapes of call()'s inputs.
+                /// See SpecializationCache.
+                void set_shape_buckets(std::shared_ptr<Function> func,
+                                       size_t param_index,
+                                       size_t axis,
+                                       const std::vector<size_t>& buckets);
+
+                /// \brief Sets how many shape specializations of func are kept compiled
+                void set_specialization_capacity(std::shared_ptr<Function> func, size_t capacity);
+
             private:
                 class FunctionInstance
                 {
@@ -68,6 +82,10 @@ namespace ngraph
                     std::shared_ptr<CPU_ExternalFunction> m_external_function;
                     std::shared_ptr<CPU_CallFrame> m_call_frame;
                     bool m_performance_counters_enabled = false;
+                    // Functions with dynamic shapes are compiled per input shapes on call()
+                    std::shared_ptr<SpecializationCache> m_specializations;
+                    std::map<std::pair<size_t, size_t>, std::vector<size_t>> m_shape_buckets;
+                    size_t m_specialization_capacity = 16;
                 };
 
                 std::map<std::shared_ptr<Function>, FunctionInstance> m_function_map;
@@ -49,13 +49,19 @@ void runtime::cpu::CPU_CallFrame::inner_call(
     vector<void*> inputs;
     vector<void*> outputs;
 
+    // Recorded only once the call succeeds, so a failed call reruns everything
+    vector<pair<weak_ptr<runtime::Tensor>, uint64_t>> input_versions;
+    m_input_versions.resize(input_tvs.size());
     for (size_t i = 0; i < input_tvs.size(); i++)
     {
         shared_ptr<runtime::cpu::CPUTensorView> tv =
             static_pointer_cast<runtime::cpu::CPUTensorView>(input_tvs[i]);
-        ctx->p_en[i] = tv->get_stale();
+        const pair<weak_ptr<runtime::Tensor>, uint64_t>& key = m_input_versions[i];
+        ctx->p_en[i] = key.first.lock() != input_tvs[i] || key.second != tv->get_version();
+        input_versions.emplace_back(input_tvs[i], tv->get_version());
         inputs.push_back(tv->get_data_ptr());
     }
+    m_input_versions.clear();
     for (size_t i = 0; i < output_tvs.size(); i++)
     {
         shared_ptr<runtime::cpu::CPUTensorView> tv =
@@ -73,6 +79,12 @@ void runtime::cpu::CPU_CallFrame::inner_call(
         m_external_function->get_executor()(ctx, inputs, outputs);
     }
 
+    m_input_versions = move(input_versions);
+    for (const shared_ptr<runtime::Tensor>& output : output_tvs)
+    {
+        output->mark_modified();
+    }
+
     if (runtime::cpu::IsTracingEnabled())
     {
         GenerateTimeline(m_external_function->get_op_attrs(),
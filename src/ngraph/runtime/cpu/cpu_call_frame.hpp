@@ -19,6 +19,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "ngraph/function.hpp"
@@ -73,6 +74,9 @@ namespace ngraph
                 std::shared_ptr<CPU_ExternalFunction> m_external_function;
                 EntryPoint m_compiled_function;
                 CPURuntimeContext* ctx;
+                // The tensor bound to each input and its version on the previous call; ops
+                // depending only on cacheable inputs rerun when either changes
+                std::vector<std::pair<std::weak_ptr<runtime::Tensor>, uint64_t>> m_input_versions;
             };
         }
     }
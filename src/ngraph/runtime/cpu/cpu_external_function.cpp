@@ -14,9 +14,12 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <cstdlib>
+#include <deque>
 #include <fstream>
 #include <memory>
+#include <set>
 #include <string>
 #include <tuple>
 #include <typeindex>
@@ -33,6 +36,7 @@
 #include "ngraph/codegen/execution_engine.hpp"
 #endif
 
+#include "ngraph/constant_store.hpp"
 #include "ngraph/descriptor/input.hpp"
 #include "ngraph/descriptor/output.hpp"
 #include "ngraph/file_util.hpp"
@@ -115,6 +119,7 @@
 #include "ngraph/op/tan.hpp"
 #include "ngraph/op/tanh.hpp"
 #include "ngraph/op/topk.hpp"
+#include "ngraph/parallel.hpp"
 #include "ngraph/pass/algebraic_simplification.hpp"
 #include "ngraph/pass/common_function_collection.hpp"
 #include "ngraph/pass/constant_folding.hpp"
@@ -139,6 +144,7 @@
 #include "ngraph/runtime/cpu/cpu_emitter.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_model_cache.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
 #include "ngraph/runtime/cpu/cpu_tracing.hpp"
@@ -225,6 +231,9 @@ runtime::cpu::CPU_ExternalFunction::CPU_ExternalFunction(
     , m_function_name(function->get_name())
     , m_is_built(false)
 {
+#if !defined(NGRAPH_DEX_ONLY)
+    m_max_codegen_shards = get_parallelism() - 1;
+#endif
 }
 
 runtime::cpu::CPU_ExternalFunction::~CPU_ExternalFunction()
@@ -245,6 +254,10 @@ public:
 
 static const string s_output_dir = "cpu_codegen";
 
+// Each shard repeats the generated header, so only split off shards with enough functions
+// to be worth a separate compile
+static const size_t s_min_functions_per_shard = 8;
+
 static string emit_string_array(const vector<string>& s, size_t max_line_length)
 {
     stringstream ss;
@@ -277,6 +290,163 @@ static string emit_string_array(const vector<string>& s, size_t max_line_length)
     return ss.str();
 }
 
+// Writes the bytes of a constant as the elements of an unsigned char array
+static void emit_constant_data(codegen::CodeWriter& writer, const void* data, size_t size)
+{
+    const size_t bytes_per_line = 16;
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; i += bytes_per_line)
+    {
+        stringstream line;
+        for (size_t j = i; j < min(size, i + bytes_per_line); j++)
+        {
+            line << static_cast<unsigned int>(bytes[j]) << ",";
+        }
+        writer << line.str() << "\n";
+    }
+}
+
+// Returns source with the names in the keys of names, which look like "<prefix>_<id>",
+// replaced by their values. Names embedded in longer identifiers, such as the
+// "<node>_<output>" names of tensors, are replaced as well. String and character literals are
+// left alone.
+static string replace_names(const string& source, const unordered_map<string, string>& names)
+{
+    // Longest prefix first, so that the longest name ending at an id wins
+    set<size_t, greater<size_t>> prefix_lengths;
+    for (const auto& name : names)
+    {
+        prefix_lengths.insert(name.first.rfind('_'));
+    }
+
+    string rc;
+    rc.reserve(source.size());
+    // The source before copied is already in rc
+    size_t copied = 0;
+    bool in_line_comment = false;
+    bool in_block_comment = false;
+    size_t i = 0;
+    while (i < source.size())
+    {
+        char c = source[i];
+        char next = (i + 1 < source.size() ? source[i + 1] : '\0');
+        if (in_line_comment || in_block_comment)
+        {
+            if ((in_line_comment && c == '\n') || (in_block_comment && c == '*' && next == '/'))
+            {
+                in_line_comment = false;
+                in_block_comment = false;
+            }
+        }
+        else if (c == '/' && (next == '/' || next == '*'))
+        {
+            in_line_comment = (next == '/');
+            in_block_comment = (next == '*');
+            i += 2;
+            continue;
+        }
+        else if (c == '"' || c == '\'')
+        {
+            for (i++; i < source.size() && source[i] != c; i++)
+            {
+                if (source[i] == '\\')
+                {
+                    i++;
+                }
+            }
+        }
+        if (c == '_' && isdigit(next))
+        {
+            size_t end = i + 1;
+            while (end < source.size() && isdigit(source[end]))
+            {
+                end++;
+            }
+            for (size_t prefix_length : prefix_lengths)
+            {
+                if (prefix_length > i || i - prefix_length < copied)
+                {
+                    continue;
+                }
+                size_t start = i - prefix_length;
+                auto it = names.find(source.substr(start, end - start));
+                if (it != names.end())
+                {
+                    rc.append(source, copied, start - copied);
+                    rc.append(it->second);
+                    copied = end;
+                    break;
+                }
+            }
+            i = end;
+            continue;
+        }
+        i++;
+    }
+    rc.append(source, copied, string::npos);
+    return rc;
+}
+
+// Writes the exported entry point of standalone code, which sets up the runtime context the
+// CPU call frame would otherwise provide
+static void emit_standalone_entry(codegen::CodeWriter& writer,
+                                  const string& entry_name,
+                                  const string& function_name,
+                                  size_t parameter_count,
+                                  const vector<size_t>& memory_buffer_sizes,
+                                  size_t memory_buffer_alignment)
+{
+    writer << "extern \"C\" void " << entry_name << "(void** inputs, void** outputs)\n";
+    writer << "{\n";
+    writer.indent++;
+    writer << "// Each thread keeps its own context and temporary buffers across calls\n";
+    writer << "struct Context\n";
+    writer << "{\n";
+    writer.indent++;
+    writer << "Context()\n";
+    writer << "{\n";
+    writer.indent++;
+    writer << "ctx.op_durations = nullptr;\n";
+    writer << "ctx.p_en = p_en;\n";
+    writer << "ctx.mkldnn_primitives = nullptr;\n";
+    writer << "ctx.mkldnn_workspaces = nullptr;\n";
+    writer << "ctx.G = nullptr;\n";
+    writer << "ctx.c = nullptr;\n";
+    writer << "ctx.states = nullptr;\n";
+    writer << "ctx.pc = 0;\n";
+    for (size_t size : memory_buffer_sizes)
+    {
+        writer << "ctx.memory_buffers.push_back(new AlignedBuffer(" << size << ", "
+               << memory_buffer_alignment << "));\n";
+    }
+    writer.indent--;
+    writer << "}\n";
+    writer << "~Context()\n";
+    writer << "{\n";
+    writer.indent++;
+    writer << "for (AlignedBuffer* buffer : ctx.memory_buffers)\n";
+    writer << "{\n";
+    writer << "    delete buffer;\n";
+    writer << "}\n";
+    writer.indent--;
+    writer << "}\n";
+    writer << "cpu::CPURuntimeContext ctx;\n";
+    writer << "bool p_en[" << max(parameter_count, size_t(1)) << "];\n";
+    writer.indent--;
+    writer << "};\n";
+    writer << "thread_local Context context;\n";
+    writer << "\n";
+    writer << "// Inputs are not tracked between calls so every op runs\n";
+    writer << "for (bool& enable : context.p_en)\n";
+    writer << "{\n";
+    writer << "    enable = true;\n";
+    writer << "}\n";
+    writer << "context.ctx.first_iteration = true;\n";
+    writer << function_name << "(inputs, outputs, &context.ctx);\n";
+    writer.indent--;
+    writer << "}\n";
+}
+
 static StaticInitializers s_static_initializers(s_output_dir);
 
 #define TI(x) type_index(typeid(x))
@@ -426,6 +596,19 @@ static void
     writer << "}\n";
 }
 
+string runtime::cpu::CPU_ExternalFunction::emit_standalone_source(const string& entry_name)
+{
+    // The passes have already rewritten the function
+    if (m_is_compiled || !m_standalone_source.empty())
+    {
+        throw ngraph_error("CPU Backend: Function " + m_function_name + " is already compiled");
+    }
+    m_standalone_entry_name = entry_name;
+    compile();
+    m_standalone_entry_name.clear();
+    return m_standalone_source;
+}
+
 void runtime::cpu::CPU_ExternalFunction::compile()
 {
     if (m_is_compiled)
@@ -434,17 +617,35 @@ void runtime::cpu::CPU_ExternalFunction::compile()
     }
 
     m_mkldnn_emitter.reset(new MKLDNNEmitter());
+    bool standalone = !m_standalone_entry_name.empty();
 
     ngraph::pass::Manager pass_manager;
+    if (standalone)
+    {
+        // MKLDNN primitives are created by the backend at runtime so standalone code sticks to
+        // the kernels it can call on its own
+        for (const char* name : {"LSTMFusion",
+                                 "RNNFusion",
+                                 "MultiLayerRNNFusion",
+                                 "CPUFusion",
+                                 "CPUHorizontalFusion",
+                                 "HalideSubgraphExtraction",
+                                 "CPUWorkspaceInsertion",
+                                 "CPUAssignment"})
+        {
+            pass_manager.get_pass_config().set_pass_enable(name, false);
+        }
+    }
     register_common_passes(pass_manager);
     unordered_map<Node*, Node*> node_function_map;
     string common_function_string;
+    vector<string> common_functions;
     auto femitter = bind(&ngraph::runtime::cpu::CPU_ExternalFunction::emit_op_as_function,
                          this,
                          placeholders::_1,
                          placeholders::_2);
     pass_manager.register_pass<ngraph::pass::CommonFunctionCollection>(
-        femitter, node_function_map, common_function_string);
+        femitter, node_function_map, common_function_string, common_functions);
     pass_manager.register_pass<ngraph::pass::Liveness>();
     pass_manager.register_pass<ngraph::pass::PropagateCacheability>(
         runtime::cpu::get_annotations_factory());
@@ -462,6 +663,10 @@ void runtime::cpu::CPU_ExternalFunction::compile()
     writer << "// Generated by the nGraph CPU backend\n";
     if (m_use_tbb)
     {
+        if (standalone)
+        {
+            throw ngraph_error("CPU Backend: Standalone code can not use TBB flow graphs");
+        }
         if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
         {
             throw ngraph_error(
@@ -535,7 +740,11 @@ using namespace ngraph::runtime;
     // to register cleanup handlers. We use it, and not atexit(), because
     // atexit() happens too late, when the JIT is no longer alive
 
-    writer << "void *__dso_handle = 0;\n\n";
+    // A shared library gets it from the C runtime instead
+    if (!standalone)
+    {
+        writer << "void *__dso_handle = 0;\n\n";
+    }
 
     if (m_emit_timing)
     {
@@ -602,14 +811,46 @@ using namespace ngraph::runtime;
                 m_active_constants.push_back(node);
                 shared_ptr<descriptor::Tensor> tv = node->get_outputs()[0].get_tensor_ptr();
                 string type = tv->get_element_type().c_type_string();
-                writer << "static " << type << "* " << tv->get_name() << " = ((" << type << "*)("
-                       << c->get_data_ptr() << "));\n";
+                if (standalone && tv->size() > 0)
+                {
+                    // Aligned for the vectorized kernels reading it
+                    writer << "alignas(64) static const unsigned char " << tv->get_name()
+                           << "_data[] = {\n";
+                    writer.indent++;
+                    emit_constant_data(writer, c->get_data_ptr(), tv->size());
+                    writer.indent--;
+                    writer << "};\n";
+                    writer << "static " << type << "* " << tv->get_name() << " = (" << type
+                           << "*)" << tv->get_name() << "_data;\n";
+                }
+                else
+                {
+                    writer << "static " << type << "* " << tv->get_name() << ";\n";
+                }
                 m_variable_name_map[tv->get_name()] = tv->get_name();
                 m_tensor_roles[tv->get_name()] = CPUTensorRole::CONSTANT;
             }
         }
     }
 
+    // Constant data is passed in once the code is loaded so that the source, and the code
+    // cached for it, do not depend on where the constants live
+    if (!standalone)
+    {
+        writer << "extern \"C\" void set_constants(void** constants)\n";
+        writer << "{\n";
+        writer.indent++;
+        for (size_t i = 0; i < m_active_constants.size(); i++)
+        {
+            shared_ptr<descriptor::Tensor> tv = m_active_constants[i]->get_output_tensor_ptr();
+            string type = tv->get_element_type().c_type_string();
+            writer << tv->get_name() << " = static_cast<" << type << "*>(constants[" << i
+                   << "]);\n";
+        }
+        writer.indent--;
+        writer << "}\n\n";
+    }
+
     writer << "// Declare all functions\n";
     for (shared_ptr<Function> f : pass_manager.get_state().get_functions())
     {
@@ -618,7 +859,44 @@ using namespace ngraph::runtime;
     }
     writer << "\n";
 
-    writer << common_function_string << "\n";
+    // The shared op functions only depend on their arguments, so when compiling in parallel
+    // they are split into shards compiled alongside the module holding the entry points
+    size_t shard_count = 0;
+    if (!standalone)
+    {
+        shard_count =
+            min(m_max_codegen_shards, common_functions.size() / s_min_functions_per_shard);
+    }
+    m_codegen_shard_count = shard_count;
+    vector<string> shard_sources;
+    if (shard_count == 0)
+    {
+        writer << common_function_string << "\n";
+    }
+    else
+    {
+        // Balance the shards by code size, placing the largest functions first
+        stable_sort(common_functions.begin(),
+                    common_functions.end(),
+                    [](const string& a, const string& b) { return a.size() > b.size(); });
+        shard_sources.assign(shard_count, pch_header_source);
+        vector<size_t> shard_sizes(shard_count, 0);
+        const string static_prefix = "static ";
+        for (string function : common_functions)
+        {
+            // The functions are called across modules so they can not be static
+            if (function.compare(0, static_prefix.size(), static_prefix) == 0)
+            {
+                function.erase(0, static_prefix.size());
+            }
+            size_t shard =
+                min_element(shard_sizes.begin(), shard_sizes.end()) - shard_sizes.begin();
+            shard_sources[shard] += function + "\n";
+            shard_sizes[shard] += function.size();
+            writer << function.substr(0, function.find("\n{")) << ";\n";
+        }
+        writer << "\n";
+    }
 
     for (shared_ptr<Function> current_function : pass_manager.get_state().get_functions())
     {
@@ -677,7 +955,9 @@ using namespace ngraph::runtime;
         // In place concatenation optimization
         process_in_place_concat(ordered_ops);
 
-        writer << "bool " << current_function->get_name() << "_t_en[" << tensor_index << "];\n";
+        // Standalone code may be called from several threads at once
+        writer << (standalone ? "thread_local bool " : "bool ") << current_function->get_name()
+               << "_t_en[" << tensor_index << "];\n";
 
         writer << "extern \"C\" void " << current_function->get_name();
         writer << "(void** inputs, void** outputs, cpu::CPURuntimeContext* ctx)\n";
@@ -1015,31 +1295,103 @@ using namespace ngraph::runtime;
         writer += "}\n\n";
     }
 
+    if (standalone)
+    {
+        if (!m_mkldnn_emitter->get_mkldnn_primitives().empty() || !m_states.empty())
+        {
+            throw ngraph_error("CPU Backend: Function " + m_function_name +
+                               " needs runtime state that standalone code can not own");
+        }
+        emit_standalone_entry(writer,
+                              m_standalone_entry_name,
+                              m_function_name,
+                              m_function->get_parameters().size(),
+                              m_memory_buffer_sizes,
+                              s_memory_pool_alignment);
+        m_standalone_source = writer.get_code();
+        return;
+    }
+
+    string code = writer.get_code();
+    string entry_name = m_function_name;
+    if (codegen::Compiler::is_cache_enabled())
+    {
+        // Node and function names carry instance ids, which differ between processes. Cached
+        // code is keyed by its source, so name them by their position instead.
+        unordered_map<string, string> names;
+        size_t function_index = 0;
+        size_t node_index = 0;
+        for (shared_ptr<Function> current_function : pass_manager.get_state().get_functions())
+        {
+            names[current_function->get_name()] = "Function_f" + to_string(function_index++);
+            for (shared_ptr<Node> node : function_ordered_ops.at(current_function))
+            {
+                names[node->get_name()] = node->description() + "_n" + to_string(node_index++);
+            }
+        }
+        entry_name = names.at(m_function_name);
+        code = replace_names(code, names);
+        for (string& shard_source : shard_sources)
+        {
+            shard_source = replace_names(shard_source, names);
+        }
+    }
+
     // TODO: Cleanup and make this a utility function
     string filename = file_util::path_join(s_output_dir, m_function_name + "_codegen.cpp");
-    string code = writer.get_code();
-    runtime::cpu::CPU_ExternalFunction::write_to_file(writer.get_code(), s_output_dir, filename);
+    runtime::cpu::CPU_ExternalFunction::write_to_file(code, s_output_dir, filename);
+    vector<string> sources{code};
+    for (size_t i = 0; i < shard_sources.size(); i++)
+    {
+        string shard_filename = file_util::path_join(
+            s_output_dir, m_function_name + "_codegen_" + to_string(i + 1) + ".cpp");
+        runtime::cpu::CPU_ExternalFunction::write_to_file(
+            shard_sources[i], s_output_dir, shard_filename);
+        sources.push_back(shard_sources[i]);
+    }
 
-    m_compiler.reset(new codegen::Compiler());
+    m_compilers.clear();
     m_execution_engine.reset(new codegen::ExecutionEngine());
 
-    m_compiler->set_precompiled_header_source(pch_header_source);
-
-    auto codegen_module = m_compiler->compile(code);
+    vector<unique_ptr<codegen::Module>> codegen_modules(sources.size());
+    for (size_t i = 0; i < sources.size(); i++)
+    {
+        m_compilers.emplace_back(new codegen::Compiler());
+        m_compilers.back()->set_precompiled_header_source(pch_header_source);
+    }
+    parallel_for(0, sources.size(), [&](size_t i) {
+        codegen_modules[i] = m_compilers[i]->compile(sources[i]);
+    });
 
-    if (codegen_module == nullptr)
+    for (unique_ptr<codegen::Module>& codegen_module : codegen_modules)
     {
-        throw runtime_error("function failed to compile");
+        if (codegen_module == nullptr)
+        {
+            throw runtime_error("function failed to compile");
+        }
+        m_execution_engine->add_module(codegen_module);
     }
-    m_execution_engine->add_module(codegen_module);
     m_execution_engine->finalize();
-    m_compiled_function = m_execution_engine->find_function<EntryPoint_t>(m_function_name);
+    m_compiled_function = m_execution_engine->find_function<EntryPoint_t>(entry_name);
 
     if (m_compiled_function == nullptr)
     {
         throw runtime_error("could not find compiled function");
     }
 
+    auto set_constants = m_execution_engine->find_function<void(void**)>("set_constants");
+    if (set_constants == nullptr)
+    {
+        throw runtime_error("could not find compiled function set_constants");
+    }
+    vector<void*> constants;
+    for (shared_ptr<Node> node : m_active_constants)
+    {
+        auto c = static_pointer_cast<ngraph::op::Constant>(node);
+        constants.push_back(const_cast<void*>(c->get_data_ptr()));
+    }
+    set_constants(constants.data());
+
     // Store layouts assigned for arguments
     for (const auto& parameter : m_function->get_parameters())
     {
@@ -1111,7 +1463,7 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(ngraph::pass::Ma
     NodeVector nv_cwi; // We dont need CPUWorkspaceInsertion to return list of indices
     REGISTER_KNOBBED_PASS_WITH_ARGS(CPUWorkspaceInsertion, true, runtime::cpu::pass, nv_cwi, false);
     REGISTER_KNOBBED_PASS_WITH_ARGS(CPUAssignment, true, runtime::cpu::pass, this);
-    REGISTER_KNOBBED_PASS(ConstantFolding, false, ngraph::pass);
+    REGISTER_KNOBBED_PASS_WITH_ARGS(ConstantFolding, true, ngraph::pass, "CPU");
     REGISTER_KNOBBED_PASS_WITH_ARGS(CPULayout, true, runtime::cpu::pass, this);
     REGISTER_KNOBBED_PASS_WITH_ARGS(
         CommonSubexpressionElimination, true, ngraph::pass, runtime::cpu::get_cse_handlers_map());
@@ -1121,6 +1473,55 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(ngraph::pass::Ma
     pass_manager.get_state().set_visualize_tree_ops_map(runtime::cpu::get_visualize_tree_ops_map());
 }
 
+void runtime::cpu::CPU_ExternalFunction::precompute_constant_layouts()
+{
+    for (auto& node : m_function->get_ordered_ops())
+    {
+        if (!dynamic_pointer_cast<runtime::cpu::op::ConvertLayout>(node))
+        {
+            continue;
+        }
+        auto constant = dynamic_pointer_cast<ngraph::op::Constant>(node->get_argument(0));
+        if (!constant || !constant->get_data_buffer())
+        {
+            continue;
+        }
+        // Results and in-place concats need the reordered data in their own buffers
+        bool needs_copy = false;
+        for (auto user : node->get_users())
+        {
+            needs_copy |= user->is_output() || dynamic_pointer_cast<ngraph::op::Concat>(user);
+        }
+        if (needs_copy)
+        {
+            continue;
+        }
+
+        auto input_desc = mkldnn_utils::get_convert_layout_input_md(node.get());
+        auto result_desc = mkldnn_utils::get_output_mkldnn_md(node.get(), 0);
+        string layout(reinterpret_cast<const char*>(&input_desc.data), sizeof(input_desc.data));
+        layout.append(reinterpret_cast<const char*>(&result_desc.data), sizeof(result_desc.data));
+
+        auto tv = node->get_output_tensor_ptr(0);
+        auto& store = ConstantStore::get_instance();
+        auto source = store.intern(constant->get_data_buffer(), constant->get_data_size());
+        auto buffer = store.get_transformed(
+            source, layout, tv->size(), [&](const void* input, void* output) {
+                mkldnn_utils::reorder(input_desc, result_desc, input, output);
+            });
+
+        m_precomputed_constants[tv->get_name()] = buffer;
+        tensor_data[tv->get_name()] = buffer.get();
+        m_tensor_roles[tv->get_name()] = CPUTensorRole::CONSTANT;
+        propagate_in_place_constant(&node->get_outputs().at(0), tv->get_name(), true);
+    }
+}
+
+bool runtime::cpu::CPU_ExternalFunction::is_precomputed_constant(const std::string& name) const
+{
+    return m_precomputed_constants.find(name) != m_precomputed_constants.end();
+}
+
 bool runtime::cpu::CPU_ExternalFunction::computes_result(Node* node)
 {
     for (size_t i = 0; i < node->get_output_size(); i++)
@@ -1545,14 +1946,41 @@ void runtime::cpu::CPU_ExternalFunction::build()
     static const string s_debug_dir = "cpu_codegen";
     static StaticInitializers s_static_initializers(s_debug_dir);
     m_mkldnn_emitter.reset(new MKLDNNEmitter());
+
+    // A function compiled before is loaded from the model cache with its annotations and
+    // layouts, and only the memory planning passes are run on it
+    string cache_signature;
+    bool is_cached = false;
+    if (runtime::cpu::model_cache::is_enabled())
+    {
+        cache_signature = runtime::cpu::model_cache::get_signature(m_function);
+        if (!cache_signature.empty())
+        {
+            if (auto cached_function =
+                    runtime::cpu::model_cache::load(cache_signature, m_function))
+            {
+                m_function = cached_function;
+                is_cached = true;
+            }
+        }
+    }
+
     ngraph::pass::Manager pass_manager;
-    register_common_passes(pass_manager);
+    if (!is_cached)
+    {
+        register_common_passes(pass_manager);
+    }
     pass_manager.register_pass<ngraph::pass::Liveness>();
     pass_manager.register_pass<ngraph::pass::PropagateCacheability>(
         runtime::cpu::get_annotations_factory());
     pass_manager.register_pass<ngraph::pass::MemoryLayout>(size_t(s_memory_pool_alignment), true);
     pass_manager.run_passes(m_function, false);
 
+    if (!cache_signature.empty() && !is_cached)
+    {
+        runtime::cpu::model_cache::save(cache_signature, m_function);
+    }
+
     // Store layouts assigned for arguments
     for (const auto& parameter : m_function->get_parameters())
     {
@@ -1594,6 +2022,10 @@ void runtime::cpu::CPU_ExternalFunction::build()
     // In place concatenation optimization
     process_in_place_concat(m_function->get_ordered_ops());
 
+    // Weights reordered into MKLDNN layouts are computed once here rather than on every call
+    // and are shared, per layout, with every other function compiled against the same weights
+    precompute_constant_layouts();
+
     // Constants
     for (auto& node : m_function->get_ordered_ops())
     {
@@ -131,6 +131,8 @@ namespace ngraph
                 static constexpr size_t s_memory_pool_alignment = 4096;
 
                 std::vector<CPUKernelFunctor>& get_functors() { return functors; }
+                /// \brief Returns true if the tensor holds constant data computed at build time
+                bool is_precomputed_constant(const std::string& name) const;
                 std::unordered_map<std::string, void*>& get_tensor_data() { return tensor_data; }
                 void*& get_tensor_data(const std::string& name);
                 std::function<void(CPURuntimeContext*, std::vector<void*>&, std::vector<void*>&)>&
@@ -150,6 +152,23 @@ namespace ngraph
 
                 const std::vector<PerformanceCounter>& get_perf_counters();
 
+#if !defined(NGRAPH_DEX_ONLY)
+                /// \brief Runs the codegen pipeline and returns the generated code as a single
+                ///        source for compiling ahead of time, instead of JIT compiling it.
+                ///        The source exports `extern "C" void <entry_name>(void** inputs,
+                ///        void** outputs)` and holds the constants as read-only data. Passes
+                ///        producing MKLDNN kernels are disabled since their primitives are
+                ///        built at runtime by the backend.
+                std::string emit_standalone_source(const std::string& entry_name);
+
+                /// \brief Sets the most modules the op functions shared by generated code are
+                ///        split into to compile them in parallel. Defaults to one less than
+                ///        get_parallelism().
+                void set_max_codegen_shards(size_t shards) { m_max_codegen_shards = shards; }
+                /// \return The number of modules the shared op functions were split into
+                size_t get_codegen_shard_count() const { return m_codegen_shard_count; }
+#endif
+
 #if defined(NGRAPH_HALIDE)
                 std::unordered_map<std::string, Halide::Func>& get_halide_functions()
                 {
@@ -215,6 +234,9 @@ namespace ngraph
                                               size_t input_index,
                                               size_t input_offset);
 
+                // Reorder constant weights feeding ConvertLayout ops at build time
+                void precompute_constant_layouts();
+
                 bool computes_result(Node* node);
                 void release_function() { m_function = nullptr; }
 #if !defined(NGRAPH_DEX_ONLY)
@@ -238,7 +260,13 @@ namespace ngraph
                 std::string emit_op_as_function(const Node&, const std::string& function_name);
                 std::string strip_comments(const std::string&);
 
-                std::unique_ptr<codegen::Compiler> m_compiler;
+                // One compiler per generated module, each owns the context of its module
+                std::vector<std::unique_ptr<codegen::Compiler>> m_compilers;
+                size_t m_max_codegen_shards;
+                size_t m_codegen_shard_count = 0;
+                // Set by emit_standalone_source to have compile() stop after emitting code
+                std::string m_standalone_entry_name;
+                std::string m_standalone_source;
                 std::unique_ptr<codegen::ExecutionEngine> m_execution_engine;
 
                 std::map<std::string, size_t> m_name_index_map;
@@ -264,6 +292,8 @@ namespace ngraph
                     m_variable_input_index_offset_map;
 
                 std::unordered_map<std::string, CPUTensorRole> m_tensor_roles;
+                // Constant tensors computed at build time, shared through the ConstantStore
+                std::unordered_map<std::string, std::shared_ptr<void>> m_precomputed_constants;
 
                 LayoutDescriptorPtrs parameter_layout_descriptors;
                 LayoutDescriptorPtrs result_layout_descriptors;
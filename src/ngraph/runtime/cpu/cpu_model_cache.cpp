@@ -0,0 +1,728 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <array>
+#include <cpuid.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <unistd.h>
+
+#include <mkldnn.hpp>
+
+#include "ngraph/file_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
+#include "ngraph/runtime/cpu/cpu_model_cache.hpp"
+#include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
+#include "ngraph/runtime/cpu/op/batch_dot.hpp"
+#include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
+#include "ngraph/runtime/cpu/op/bounded_relu.hpp"
+#include "ngraph/runtime/cpu/op/conv_add.hpp"
+#include "ngraph/runtime/cpu/op/conv_bias.hpp"
+#include "ngraph/runtime/cpu/op/conv_relu.hpp"
+#include "ngraph/runtime/cpu/op/convert_layout.hpp"
+#include "ngraph/runtime/cpu/op/group_conv.hpp"
+#include "ngraph/runtime/cpu/op/group_conv_bias.hpp"
+#include "ngraph/runtime/cpu/op/leaky_relu.hpp"
+#include "ngraph/runtime/cpu/op/lstm.hpp"
+#include "ngraph/runtime/cpu/op/matmul_bias.hpp"
+#include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
+#include "ngraph/runtime/cpu/op/rnn.hpp"
+#include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
+#include "ngraph/runtime/cpu/op/update_slice.hpp"
+#include "ngraph/serializer_extension.hpp"
+#include "ngraph/util.hpp"
+#include "nlohmann/json.hpp"
+
+using namespace ngraph;
+using namespace std;
+using json = nlohmann::json;
+
+// Bumped whenever the contents of a cache entry change
+static const uint64_t s_cache_format_version = 2;
+
+static json write_mkldnn_md(const mkldnn::memory::desc& md)
+{
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(&md.data);
+    return vector<uint8_t>(data, data + sizeof(md.data));
+}
+
+static mkldnn::memory::desc read_mkldnn_md(const json& j)
+{
+    vector<uint8_t> bytes = j.get<vector<uint8_t>>();
+    mkldnn_memory_desc_t data;
+    if (bytes.size() != sizeof(data))
+    {
+        throw ngraph_error("Cached MKLDNN memory descriptor has the wrong size");
+    }
+    memcpy(&data, bytes.data(), sizeof(data));
+    return mkldnn::memory::desc(data);
+}
+
+// The attributes shared by the convolution ops
+template <typename T>
+static void write_convolution(const T& conv, json& j)
+{
+    j["window_movement_strides"] = conv.get_window_movement_strides();
+    j["window_dilation_strides"] = conv.get_window_dilation_strides();
+    j["padding_below"] = conv.get_padding_below();
+    j["padding_above"] = conv.get_padding_above();
+    j["data_dilation_strides"] = conv.get_data_dilation_strides();
+}
+
+template <typename T>
+static void write_max_pool(const T& pool, json& j)
+{
+    j["window_shape"] = pool.get_window_shape();
+    j["window_movement_strides"] = pool.get_window_movement_strides();
+    j["padding_below"] = pool.get_padding_below();
+    j["padding_above"] = pool.get_padding_above();
+}
+
+template <typename T>
+static void register_op(const string& description,
+                        function<void(const T&, json&)> writer,
+                        serializer::OpReader reader)
+{
+    serializer::register_op(
+        description,
+        [writer](const Node& n, json& j) { writer(static_cast<const T&>(n), j); },
+        reader);
+}
+
+// Registers the serialization of the ops the CPU passes add to a graph. HalideOp and
+// LoopKernel hold subgraphs and functions containing them are not cached.
+static void register_op_serializers()
+{
+    register_op<op::BatchDot>(
+        "BatchDot",
+        [](const op::BatchDot& n, json& j) {
+            j["transpose_a"] = n.get_is_a_transposed();
+            j["transpose_b"] = n.get_is_b_transposed();
+        },
+        [](const json& j, const NodeVector& args) {
+            return make_shared<op::BatchDot>(args.at(0),
+                                             args.at(1),
+                                             j.at("transpose_a").get<bool>(),
+                                             j.at("transpose_b").get<bool>());
+        });
+    register_op<op::BatchNormTrainingRelu>(
+        "BatchNormTrainingRelu",
+        [](const op::BatchNormTrainingRelu& n, json& j) { j["eps"] = n.get_eps_value(); },
+        [](const json& j, const NodeVector& args) {
+            return make_shared<op::BatchNormTrainingRelu>(
+                j.at("eps").get<double>(), args.at(0), args.at(1), args.at(2));
+        });
+    register_op<op::BatchNormInferenceRelu>(
+        "BatchNormInferenceRelu",
+        [](const op::BatchNormInferenceRelu& n, json& j) { j["eps"] = n.get_eps_value(); },
+        [](const json& j, const NodeVector& args) {
+            return make_shared<op::BatchNormInferenceRelu>(j.at("eps").get<double>(),
+                                                           args.at(0),
+                                                           args.at(1),
+                                                           args.at(2),
+                                                           args.at(3),
+                                                           args.at(4));
+        });
+    register_op<op::BoundedRelu>(
+        "BoundedRelu",
+        [](const op::BoundedRelu& n, json& j) { j["alpha"] = n.get_alpha(); },
+        [](const json& j, const NodeVector& args) {
+            return make_shared<op::BoundedRelu>(args.at(0), j.at("alpha").get<float>());
+        });
+    register_op<op::ConvolutionAdd>(
+        "ConvolutionAdd",
+        [](const op::ConvolutionAdd& n, json& j) {
+            write_convolution(n, j);
+            j["with_relu"] = n.with_relu();
+        },
+        [](const json& j, const NodeVector& args) {
+            return make_shared<op::ConvolutionAdd>(
+                args.at(0),
+                args.at(1),
+                args.at(2),
+                j.at("window_movement_strides").get<vector<size_t>>(),
+                j.at("window_dilation_strides").get<vector<size_t>>(),
+                j.at("padding_below").get<vector<std::ptrdiff_t>>(),
+                j.at("padding_above").get<vector<std::ptrdiff_t>>(),
+                j.at("data_dilation_strides").get<vector<size_t>>(),
+                j.at("with_relu").get<bool>());
+        });
+    register_op<op::ConvolutionBias>(
+        "ConvolutionBias",
+        [](const op::ConvolutionBias& n, json& j) {
+            write_convolution(n, j);
+            j["with_relu"] = n.with_relu();
+        },
+        [](const json& j, const NodeVector& args) {
+            return make_shared<op::ConvolutionBias>(
+                args.at(0),
+                args.at(1),
+                args.at(2),
+                j.at("window_movement_strides").get<vector<size_t>>(),
+                j.at("window_dilation_strides").get<vector<size_t>>(),
+                j.at("padding_below").get<vector<std::ptrdiff_t>>(),
+                j.at("padding_above").get<vector<std::ptrdiff_t>>(),
+                j.at("data_dilation_strides").get<vector<size_t>>(),
+                j.at("with_relu").get<bool>());
+        });
+    register_op<op::ConvolutionBiasAdd>(
+        "ConvolutionBiasAdd",
+        [](const op::ConvolutionBiasAdd& n, json& j) {
+            write_convolution(n, j);
+            j["with_relu"] = n.with_relu();
+        },
+        [](const json& j, const NodeVector& args) {
+            return make_shared<op::ConvolutionBiasAdd>(
+                args.at(0),
+                args.at(1),
+                args.at(2),
+                args.at(3),
+                j.at("window_movement_strides").get<vector<size_t>>(),
+                j.at("window_dilation_strides").get<vector<size_t>>(),
+                j.at("padding_below").get<vector<std::ptrdiff_t>>(),
+                j.at("padding_above").get<vector<std::ptrdiff_t>>(),
+                j.at("data_dilation_strides").get<vector<size_t>>(),
+                j.at("with_relu").get<bool>());
+        });
+    register_op<op::ConvolutionBiasBackpropFiltersBias>(
+        "ConvolutionBiasBackpropFiltersBias",
+        [](const op::ConvolutionBiasBackpropFiltersBias& n, json& j) {
+            j["filters_shape"] = n.get_filters_shape();
+            j["bias_shape"] = n.get_bias_shape();
+            j["window_movement_strides_forward"] = n.get_window_movement_strides_forward();
+            j["window_dilation_strides_forward"] = n.get_window_dilation_strides_forward();
+            j["padding_below_forward"] = n.get_padding_below_forward();
+            j["padding_above_forward"] = n.get_padding_above_forward();
+            j["data_dilation_strides_forward"] = n.get_data_dilation_strides_forward();
+        },
+        [](const json& j, const NodeVector& args) {
+            return make_shared<op::ConvolutionBiasBackpropFiltersBias>(
+                args.at(0),
+                j.at("filters_shape").get<vector<size_t>>(),
+                j.at("bias_shape").get<vector<size_t>>(),
+                args.at(1),
+                j.at("window_movement_strides_forward").get<vector<size_t>>(),
+                j.at("window_dilation_strides_forward").get<vector<size_t>>(),
+                j.at("padding_below_forward").get<vector<std::ptrdiff_t>>(),
+                j.at("padding_above_forward").get<vector<std::ptrdiff_t>>(),
+                j.at("data_dilation_strides_forward").get<vector<size_t>>());
+        });
+    register_op<op::ConvolutionRelu>(
+        "ConvolutionRelu",
+        [](const op::ConvolutionRelu& n, json& j) { write_convolution(n, j); },
+        [](const json& j, const NodeVector& args) {
+            return make_shared<op::ConvolutionRelu>(
+                args.at(0),
+                args.at(1),
+                j.at("window_movement_strides").get<vector<size_t>>(),
+                j.at("window_dilation_strides").get<vector<size_t>>(),
+                j.at("padding_below").get<vector<std::ptrdiff_t>>(),
+                j.at("padding_above").get<vector<std::ptrdiff_t>>(),
+                j.at("data_dilation_strides").get<vector<size_t>>());
+        });
+    register_op<runtime::cpu::op::ConvertLayout>(
+        "ConvertLayout",
+        [](const runtime::cpu::op::ConvertLayout& n, json& j) {
+            const auto& layout = n.get_output_layout();
+            j["arg_output_index"] = n.get_arg_output_index();
+            j["output_layout"] = layout->is_mkldnn_layout()
+                                     ? write_mkldnn_md(layout->get_mkldnn_md())
+                                     : json(nullptr);
+        },
+        [](const json& j, const NodeVector& args) {
+            size_t output_index = j.at("arg_output_index").get<size_t>();
+            auto layout = make_shared<runtime::cpu::LayoutDescriptor>(
+                args.at(0)->get_output_tensor(output_index));
+            if (!j.at("output_layout").is_null())
+            {
+                layout->set_mkldnn_md(read_mkldnn_md(j.at("output_layout")));
+            }
+            return make_shared<runtime::cpu::op::ConvertLayout>(args.at(0), output_index, layout);
+        });
+    register_op<op::GroupConvolution>(
+        "GroupConvolution",
+        [](const op::GroupConvolution& n, json& j) {
+            write_convolution(n, j);
+            j["groups"] = n.get_groups();
+            j["output_shape"] = n.get_shape();
+        },
+        [](const json& j, const NodeVector& args) {
+            return make_shared<op::GroupConvolution>(
+                args.at(0),
+                args.at(1),
+                j.at("window_movement_strides").get<vector<size_t>>(),
+                j.at("window_dilation_strides").get<vector<size_t>>(),
+                j.at("padding_below").get<vector<std::ptrdiff_t>>(),
+                j.at("padding_above").get<vector<std::ptrdiff_t>>(),
+                j.at("data_dilation_strides").get<vector<size_t>>(),
+                j.at("groups").get<size_t>(),
+                j.at("output_shape").get<vector<size_t>>());
+        });
+    register_op<op::GroupConvolutionBias>(
+        "GroupConvolutionBias",
+        [](const op::GroupConvolutionBias& n, json& j) {
+            write_convolution(n, j);
+            j["groups"] = n.get_groups();
+            j["output_shape"] = n.get_shape();
+            j["with_relu"] = n.with_relu();
+            j["alpha"] = n.get_alpha();
+        },
+        [](const json& j, const NodeVector& args) {
+            return make_shared<op::GroupConvolutionBias>(
+                args.at(0),
+                args.at(1),
+                args.at(2),
+                j.at("window_movement_strides").get<vector<size_t>>(),
+                j.at("window_dilation_strides").get<vector<size_t>>(),
+                j.at("padding_below").get<vector<std::ptrdiff_t>>(),
+                j.at("padding_above").get<vector<std::ptrdiff_t>>(),
+                j.at("data_dilation_strides").get<vector<size_t>>(),
+                j.at("groups").get<size_t>(),
+                j.at("output_shape").get<vector<size_t>>(),
+                j.at("with_relu").get<bool>(),
+                j.at("alpha").get<float>());
+        });
+    register_op<op::LeakyRelu>(
+        "LeakyRelu",
+        [](const op::LeakyRelu& n, json& j) { j["alpha"] = n.get_alpha(); },
+        [](const json& j, const NodeVector& args) {
+            return make_shared<op::LeakyRelu>(args.at(0), j.at("alpha").get<float>());
+        });
+    register_op<op::Lstm>("Lstm",
+                          [](const op::Lstm&, json&) {},
+                          [](const json& j, const NodeVector& args) {
+                              return make_shared<op::Lstm>(
+                                  args.at(0), args.at(1), args.at(2), args.at(3), args.at(4));
+                          });
+    register_op<op::MatmulBias>(
+        "MatmulBias",
+        [](const op::MatmulBias& n, json& j) {
+            j["shape_w"] = n.get_a_shape();
+            j["shape_x"] = n.get_b_shape();
+            j["transpose_w"] = n.get_is_a_transposed();
+            j["transpose_x"] = n.get_is_b_transposed();
+            j["broadcast_axes"] = n.get_broadcast_axes();
+        },
+        [](const json& j, const NodeVector& args) {
+            return make_shared<op::MatmulBias>(args.at(0),
+                                               args.at(1),
+                                               args.size() == 3 ? args.at(2) : nullptr,
+                                               j.at("shape_w").get<vector<size_t>>(),
+                                               j.at("shape_x").get<vector<size_t>>(),
+                                               j.at("transpose_w").get<bool>(),
+                                               j.at("transpose_x").get<bool>(),
+                                               j.at("broadcast_axes").get<set<size_t>>());
+        });
+    register_op<op::MaxPoolWithIndices>(
+        "MaxPoolWithIndices",
+        [](const op::MaxPoolWithIndices& n, json& j) { write_max_pool(n, j); },
+        [](const json& j, const NodeVector& args) {
+            return make_shared<op::MaxPoolWithIndices>(
+                args.at(0),
+                j.at("window_shape").get<vector<size_t>>(),
+                j.at("window_movement_strides").get<vector<size_t>>(),
+                j.at("padding_below").get<vector<size_t>>(),
+                j.at("padding_above").get<vector<size_t>>());
+        });
+    register_op<op::MaxPoolWithIndicesBackprop>(
+        "MaxPoolWithIndicesBackprop",
+        [](const op::MaxPoolWithIndicesBackprop& n, json& j) { write_max_pool(n, j); },
+        [](const json& j, const NodeVector& args) {
+            return make_shared<op::MaxPoolWithIndicesBackprop>(
+                args.at(0),
+                args.at(1),
+                args.at(2),
+                j.at("window_shape").get<vector<size_t>>(),
+                j.at("window_movement_strides").get<vector<size_t>>(),
+                j.at("padding_below").get<vector<size_t>>(),
+                j.at("padding_above").get<vector<size_t>>());
+        });
+    register_op<op::Rnn>(
+        "Rnn",
+        [](const op::Rnn& n, json& j) {
+            j["num_timesteps"] = n.get_num_timesteps();
+            j["num_gates_per_cell"] = n.get_gates_per_cell();
+            j["src_sequence_length"] = n.get_src_sequence_length();
+            j["num_cell_states"] = n.get_num_cell_states();
+            j["direction"] = n.get_direction();
+            j["num_fused_layers"] = n.get_num_fused_layers();
+        },
+        [](const json& j, const NodeVector& args) {
+            return make_shared<op::Rnn>(args.at(0),
+                                        args.at(1),
+                                        args.at(2),
+                                        args.at(3),
+                                        args.at(4),
+                                        j.at("num_timesteps").get<size_t>(),
+                                        j.at("num_gates_per_cell").get<size_t>(),
+                                        j.at("src_sequence_length").get<size_t>(),
+                                        j.at("num_cell_states").get<size_t>(),
+                                        j.at("direction").get<size_t>(),
+                                        j.at("num_fused_layers").get<size_t>());
+        });
+    register_op<op::SigmoidMultiply>(
+        "SigmoidMultiply",
+        [](const op::SigmoidMultiply& n, json& j) {
+            j["input_types"] = {static_cast<size_t>(n.get_input_func_type(0)),
+                                static_cast<size_t>(n.get_input_func_type(1))};
+        },
+        [](const json& j, const NodeVector& args) {
+            auto input_types = j.at("input_types").get<vector<size_t>>();
+            return make_shared<op::SigmoidMultiply>(
+                args.at(0),
+                args.at(1),
+                static_cast<op::SigmoidMultiply::FunctionType>(input_types.at(0)),
+                static_cast<op::SigmoidMultiply::FunctionType>(input_types.at(1)));
+        });
+    register_op<op::SigmoidMultiplyBackprop>(
+        "SigmoidMultiplyBackprop",
+        [](const op::SigmoidMultiplyBackprop& n, json& j) {
+            j["input_types"] = {static_cast<size_t>(n.get_input_func_type(0)),
+                                static_cast<size_t>(n.get_input_func_type(1))};
+        },
+        [](const json& j, const NodeVector& args) {
+            using FunctionType = op::SigmoidMultiplyBackprop::FunctionType;
+            auto input_types = j.at("input_types").get<vector<size_t>>();
+            return make_shared<op::SigmoidMultiplyBackprop>(
+                args.at(0),
+                args.at(1),
+                args.at(2),
+                array<FunctionType, 2>{{static_cast<FunctionType>(input_types.at(0)),
+                                        static_cast<FunctionType>(input_types.at(1))}});
+        });
+    register_op<op::UpdateSlice>(
+        "UpdateSlice",
+        [](const op::UpdateSlice& n, json& j) {
+            j["lower_bounds"] = n.get_lower_bounds();
+            j["upper_bounds"] = n.get_upper_bounds();
+            j["strides"] = n.get_strides();
+        },
+        [](const json& j, const NodeVector& args) {
+            return make_shared<op::UpdateSlice>(args.at(0),
+                                                args.at(1),
+                                                j.at("lower_bounds").get<vector<size_t>>(),
+                                                j.at("upper_bounds").get<vector<size_t>>(),
+                                                j.at("strides").get<vector<size_t>>());
+        });
+}
+
+// Saves the annotations of ops and the layouts of their outputs
+static void write_cpu_state(const Node& n, json& j)
+{
+    json state;
+    if (auto op = dynamic_cast<const ngraph::op::Op*>(&n))
+    {
+        if (auto annotations = op->get_op_annotations())
+        {
+            json in_place = json::array();
+            for (const auto& oi : annotations->get_in_place_oi_pairs())
+            {
+                in_place.push_back({oi.output, oi.input, oi.destructive});
+            }
+            auto cpu_annotations =
+                dynamic_pointer_cast<runtime::cpu::CPUOpAnnotations>(annotations);
+            state["mkldnn_op"] = cpu_annotations && cpu_annotations->is_mkldnn_op();
+            state["cacheable"] = annotations->is_cacheable();
+            state["in_place"] = in_place;
+        }
+    }
+
+    json layouts = json::array();
+    for (size_t i = 0; i < n.get_output_size(); i++)
+    {
+        const auto& tensor_layout = n.get_output_tensor(i).get_tensor_layout();
+        auto layout = dynamic_pointer_cast<runtime::cpu::LayoutDescriptor>(tensor_layout);
+        if (layout && layout->is_mkldnn_layout())
+        {
+            layouts.push_back(write_mkldnn_md(layout->get_mkldnn_md()));
+        }
+        else if (layout)
+        {
+            layouts.push_back(json::array());
+        }
+        else if (tensor_layout)
+        {
+            throw ngraph_error("Unsupported tensor layout on " + n.get_name());
+        }
+        else
+        {
+            layouts.push_back(nullptr);
+        }
+    }
+    state["layouts"] = layouts;
+    j["cpu_state"] = state;
+}
+
+static void read_cpu_state(Node& n, const json& j)
+{
+    const json& state = j.at("cpu_state");
+    if (state.count("mkldnn_op") != 0)
+    {
+        auto op = dynamic_cast<ngraph::op::Op*>(&n);
+        if (op == nullptr)
+        {
+            throw ngraph_error("Annotations on a node that is not an op: " + n.get_name());
+        }
+        auto annotations = make_shared<runtime::cpu::CPUOpAnnotations>();
+        annotations->set_mkldnn_op(state.at("mkldnn_op").get<bool>());
+        annotations->set_cacheable(state.at("cacheable").get<bool>());
+        for (const json& oi : state.at("in_place"))
+        {
+            annotations->add_in_place_oi_pair(
+                {oi.at(0).get<size_t>(), oi.at(1).get<size_t>(), oi.at(2).get<bool>()});
+        }
+        op->set_op_annotations(annotations);
+    }
+
+    const json& layouts = state.at("layouts");
+    for (size_t i = 0; i < n.get_output_size() && i < layouts.size(); i++)
+    {
+        descriptor::Tensor& tensor = n.get_output_tensor(i);
+        // ConvertLayout sets its output layout when it is built
+        if (layouts[i].is_null() || tensor.get_tensor_layout())
+        {
+            continue;
+        }
+        auto layout = make_shared<runtime::cpu::LayoutDescriptor>(tensor);
+        if (layouts[i].size() != 0)
+        {
+            layout->set_mkldnn_md(read_mkldnn_md(layouts[i]));
+        }
+        tensor.set_tensor_layout(layout);
+    }
+}
+
+static serializer::NodeHooks get_node_hooks()
+{
+    static once_flag s_register_flag;
+    call_once(s_register_flag, register_op_serializers);
+
+    serializer::NodeHooks hooks;
+    hooks.write = write_cpu_state;
+    hooks.read = read_cpu_state;
+    return hooks;
+}
+
+// MKLDNN picks layouts and kernels from the instruction sets it detects, which it reads from
+// cpuid leaves 1 and 7 and from the register state the OS enables in XCR0
+static string get_cpu_features()
+{
+    stringstream ss;
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    unsigned int eax, ebx, ecx, edx;
+    ss << hex;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+    {
+        ss << "cpuid1:" << ecx;
+        if ((ecx & bit_OSXSAVE) != 0)
+        {
+            unsigned int xcr0_low, xcr0_high;
+            __asm__ __volatile__("xgetbv" : "=a"(xcr0_low), "=d"(xcr0_high) : "c"(0));
+            ss << ";xcr0:" << xcr0_low;
+        }
+    }
+    if (__get_cpuid_max(0, nullptr) >= 7)
+    {
+        __cpuid_count(7, 0, eax, ebx, ecx, edx);
+        // The other bits of edx report microcode mitigations rather than instruction sets
+        ss << ";cpuid7:" << ebx << "," << ecx << "," << (edx & 0xc);
+    }
+#endif
+    return ss.str();
+}
+
+// An entry is the serialized function followed by the signature it was saved with and the
+// size of that signature. The archive reader ignores anything after the archive.
+static string get_key(const string& signature)
+{
+    stringstream ss;
+    ss << hex << setw(16) << setfill('0') << hash_bytes(signature.data(), signature.size());
+    return ss.str();
+}
+
+static string get_cache_path(const string& key)
+{
+    return file_util::path_join(getenv("NGRAPH_CPU_CACHE_DIR"), key + ".ngcpu");
+}
+
+bool runtime::cpu::model_cache::is_enabled()
+{
+    return getenv("NGRAPH_CPU_CACHE_DIR") != nullptr;
+}
+
+string runtime::cpu::model_cache::get_signature(const shared_ptr<Function>& func)
+{
+    // The ops of the function are checked against the registered ones when it is hashed
+    get_node_hooks();
+
+    stringstream config;
+    config << NGRAPH_VERSION << ";" << s_cache_format_version << ";"
+           << sizeof(mkldnn_memory_desc_t) << ";" << get_cpu_features();
+    // Environment variables read by the CPU passes
+    for (const char* name :
+         {"NGRAPH_PASS_ENABLES", "NGRAPH_PASS_CPU_LAYOUT_ELTWISE", "NGRAPH_DISABLED_FUSIONS"})
+    {
+        const char* value = getenv(name);
+        config << ";" << name << "=" << (value ? value : "");
+    }
+    config << '\0';
+
+    string rc;
+    try
+    {
+        rc = config.str() + serializer::signature(func);
+    }
+    catch (const exception& e)
+    {
+        NGRAPH_DEBUG << "Function " << func->get_name() << " is not cached: " << e.what();
+    }
+    return rc;
+}
+
+static bool same_outputs(const Node& a, const Node& b)
+{
+    if (a.get_output_size() != b.get_output_size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < a.get_output_size(); i++)
+    {
+        if (a.get_output_element_type(i) != b.get_output_element_type(i) ||
+            a.get_output_shape(i) != b.get_output_shape(i))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+shared_ptr<Function> runtime::cpu::model_cache::load(const string& signature,
+                                                     const shared_ptr<Function>& func)
+{
+    string key = get_key(signature);
+    shared_ptr<Function> rc;
+    ifstream in(get_cache_path(key), ios_base::binary | ios_base::in);
+    if (in)
+    {
+        try
+        {
+            // Check the signature first so that a colliding key never loads the function
+            uint64_t signature_size = 0;
+            in.seekg(-static_cast<streamoff>(sizeof(signature_size)), ios_base::end);
+            streamoff signature_end = in.tellg();
+            in.read(reinterpret_cast<char*>(&signature_size), sizeof(signature_size));
+            if (!in || signature_size != signature.size() ||
+                signature_end < static_cast<streamoff>(signature_size))
+            {
+                throw ngraph_error("signature mismatch");
+            }
+            string stored_signature(signature_size, '\0');
+            in.seekg(signature_end - static_cast<streamoff>(signature_size), ios_base::beg);
+            in.read(&stored_signature[0], signature_size);
+            if (!in || stored_signature != signature)
+            {
+                throw ngraph_error("signature mismatch");
+            }
+
+            in.seekg(0, ios_base::beg);
+            rc = serializer::deserialize(in, get_node_hooks());
+            const ParameterVector& parameters = func->get_parameters();
+            const ResultVector& results = func->get_results();
+            if (rc->get_parameters().size() != parameters.size() ||
+                rc->get_results().size() != results.size())
+            {
+                throw ngraph_error("parameters or results do not match");
+            }
+            for (size_t i = 0; i < parameters.size(); i++)
+            {
+                if (!same_outputs(*rc->get_parameters()[i], *parameters[i]))
+                {
+                    throw ngraph_error("parameters do not match");
+                }
+            }
+            for (size_t i = 0; i < results.size(); i++)
+            {
+                if (!same_outputs(*rc->get_results()[i], *results[i]))
+                {
+                    throw ngraph_error("results do not match");
+                }
+            }
+        }
+        catch (const exception& e)
+        {
+            NGRAPH_WARN << "Ignoring invalid CPU cache entry " << key << ": " << e.what();
+            rc = nullptr;
+        }
+    }
+    return rc;
+}
+
+void runtime::cpu::model_cache::save(const string& signature, const shared_ptr<Function>& func)
+{
+    string key = get_key(signature);
+    serializer::NodeHooks hooks = get_node_hooks();
+    for (auto node : func->get_ops())
+    {
+        if (!serializer::is_supported_op(node->description()))
+        {
+            NGRAPH_DEBUG << "Function " << func->get_name() << " is not cached, "
+                         << node->description() << " cannot be serialized";
+            return;
+        }
+    }
+
+    // Entries are written to a temporary file and renamed so that processes sharing the
+    // cache never see a partial entry
+    string path = get_cache_path(key);
+    stringstream tmp_path;
+    tmp_path << path << "." << getpid() << "." << hash<thread::id>()(this_thread::get_id())
+             << ".tmp";
+    try
+    {
+        {
+            ofstream out(tmp_path.str(), ios_base::binary | ios_base::out);
+            if (!out)
+            {
+                throw ngraph_error("unable to create " + tmp_path.str());
+            }
+            serializer::serialize(out, func, hooks);
+            uint64_t signature_size = signature.size();
+            out.write(signature.data(), signature_size);
+            out.write(reinterpret_cast<const char*>(&signature_size), sizeof(signature_size));
+            if (!out)
+            {
+                throw ngraph_error("unable to write " + tmp_path.str());
+            }
+        }
+        if (rename(tmp_path.str().c_str(), path.c_str()) != 0)
+        {
+            throw ngraph_error("unable to rename " + tmp_path.str());
+        }
+    }
+    catch (const exception& e)
+    {
+        NGRAPH_WARN << "Unable to save CPU cache entry " << key << ": " << e.what();
+        remove(tmp_path.str().c_str());
+    }
+}
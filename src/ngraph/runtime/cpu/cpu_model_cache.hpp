@@ -0,0 +1,57 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "ngraph/function.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief A persistent cache of functions compiled by the CPU backend, enabled by
+            ///        setting NGRAPH_CPU_CACHE_DIR to a directory. An entry holds a function
+            ///        after the CPU passes have run, with its op annotations and tensor
+            ///        layouts, so loading it skips fusion, assignment and layout selection.
+            namespace model_cache
+            {
+                /// \brief Returns true if NGRAPH_CPU_CACHE_DIR is set
+                bool is_enabled();
+
+                /// \brief Returns the signature of a function that has not been compiled yet.
+                ///        The signature covers the graph and its constants, the pass
+                ///        configuration, the nGraph version and the host CPU features. Returns
+                ///        an empty string if the function cannot be cached.
+                std::string get_signature(const std::shared_ptr<Function>& func);
+
+                /// \brief Returns the compiled function stored for signature, or nullptr. An
+                ///        entry is only used if it was saved with the same signature and its
+                ///        parameters and results have the types and shapes of those of func.
+                std::shared_ptr<Function> load(const std::string& signature,
+                                               const std::shared_ptr<Function>& func);
+
+                /// \brief Stores a compiled function for signature. Functions containing
+                ///        ops that cannot be serialized are not stored.
+                void save(const std::string& signature, const std::shared_ptr<Function>& func);
+            }
+        }
+    }
+}
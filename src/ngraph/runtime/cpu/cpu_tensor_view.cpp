@@ -103,6 +103,7 @@ void runtime::cpu::CPUTensorView::write(const void* source, size_t tensor_offset
     }
     char* target = get_data_ptr();
     memcpy(&target[tensor_offset], source, n);
+    mark_modified();
 }
 
 void runtime::cpu::CPUTensorView::read(void* target, size_t tensor_offset, size_t n) const
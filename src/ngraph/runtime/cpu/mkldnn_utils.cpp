@@ -33,6 +33,8 @@
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
 #include "ngraph/runtime/cpu/op/conv_bias.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
+#include "ngraph/runtime/cpu/op/group_conv.hpp"
+#include "ngraph/runtime/cpu/op/group_conv_bias.hpp"
 #include "ngraph/type/element_type.hpp"
 
 #include "mkldnn_utils.hpp"
@@ -651,6 +653,56 @@ bool runtime::cpu::mkldnn_utils::is_mkldnn_padded_layout(const mkldnn::memory::d
     return false;
 }
 
+mkldnn::memory::desc
+    runtime::cpu::mkldnn_utils::get_convert_layout_input_md(const ngraph::Node* node)
+{
+    auto input_desc = get_input_mkldnn_md(node, 0);
+    auto result_desc = get_output_mkldnn_md(node, 0);
+
+    if (input_desc.data.format == mkldnn_nchw && result_desc.data.format == mkldnn_goihw)
+    {
+        //becomes a copy
+        input_desc = result_desc;
+    }
+    else if (input_desc.data.format == mkldnn_nchw && input_desc.data.ndims == 4 &&
+             result_desc.data.ndims == 5 && node->get_users().size() == 1)
+    {
+        Shape weights_shape_groups;
+        if (auto gconv =
+                std::dynamic_pointer_cast<ngraph::op::GroupConvolution>(node->get_users()[0]))
+        {
+            weights_shape_groups = gconv->get_weights_dimensions();
+        }
+        else if (auto gconvb = std::dynamic_pointer_cast<ngraph::op::GroupConvolutionBias>(
+                     node->get_users()[0]))
+        {
+            weights_shape_groups = gconvb->get_weights_dimensions();
+        }
+        else
+        {
+            throw ngraph_error("Incompatible input/output shape in ConvertLayout op");
+        }
+        input_desc =
+            mkldnn::memory::desc(mkldnn::memory::dims(weights_shape_groups.begin(),
+                                                      weights_shape_groups.end()),
+                                 get_mkldnn_data_type(node->get_input_element_type(0)),
+                                 mkldnn::memory::format::goihw);
+    }
+    return input_desc;
+}
+
+void runtime::cpu::mkldnn_utils::reorder(const mkldnn::memory::desc& input_desc,
+                                         const mkldnn::memory::desc& result_desc,
+                                         const void* input,
+                                         void* output)
+{
+    mkldnn::memory in{{input_desc, global_cpu_engine}, const_cast<void*>(input)};
+    mkldnn::memory out{{result_desc, global_cpu_engine}, output};
+    mkldnn::reorder reorder_prim(in, out);
+    mkldnn::stream s(mkldnn::stream::kind::eager);
+    s.submit({reorder_prim}).wait();
+}
+
 bool runtime::cpu::mkldnn_utils::use_mkldnn_kernel(const ngraph::Node* node)
 {
     auto op_annotations = static_cast<const ngraph::op::Op*>(node)->get_op_annotations();
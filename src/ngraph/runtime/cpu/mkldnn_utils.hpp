@@ -74,6 +74,16 @@ namespace ngraph
                 bool can_use_mkldnn_batchnorm_fprop(const ngraph::Node* node);
                 bool can_use_mkldnn_batchnorm_bprop(const ngraph::Node* node);
 
+                /// \brief Returns the descriptor a ConvertLayout node reorders from. Grouped
+                ///        convolution weights are reinterpreted with their group dimension.
+                mkldnn::memory::desc get_convert_layout_input_md(const ngraph::Node* node);
+                /// \brief Eagerly reorders input, laid out as input_desc, into output, laid
+                ///        out as result_desc.
+                void reorder(const mkldnn::memory::desc& input_desc,
+                             const mkldnn::memory::desc& result_desc,
+                             const void* input,
+                             void* output);
+
                 bool use_mkldnn_kernel(const ngraph::Node* node);
                 void assign_mkldnn_kernel(Node* node);
 
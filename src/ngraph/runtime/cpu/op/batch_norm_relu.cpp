@@ -25,6 +25,7 @@ ngraph::op::BatchNormTrainingRelu::BatchNormTrainingRelu(double eps,
     : Op("BatchNormTrainingRelu", check_single_output_args({gamma, beta, input}))
     , m_epsilon(eps)
 {
+    set_output_size(3);
     constructor_validate_and_infer_types();
 
     auto bn_input_shape = get_input_shape(INPUT);
@@ -70,7 +71,6 @@ ngraph::op::BatchNormTrainingRelu::BatchNormTrainingRelu(double eps,
         throw ngraph_error("gamma and beta element type does not match");
     }
 
-    set_output_size(3);
     set_output_type(0, input->get_element_type(), bn_input_shape);
     set_output_type(1, input->get_element_type(), channel_shape);
     set_output_type(2, input->get_element_type(), channel_shape);
@@ -204,6 +204,7 @@ op::ConvolutionBiasBackpropFiltersBias::ConvolutionBiasBackpropFiltersBias(
     , m_padding_above_forward(padding_above_forward)
     , m_data_dilation_strides_forward(data_dilation_strides_forward)
 {
+    set_output_size(2);
     constructor_validate_and_infer_types();
 
     auto& data_batch_shape = get_input_shape(0);
@@ -243,7 +244,6 @@ op::ConvolutionBiasBackpropFiltersBias::ConvolutionBiasBackpropFiltersBias(
         m_data_dilation_strides_backward.push_back(data_dilation_strides_forward[i]);
     }
 
-    set_output_size(2);
     set_output_type(0, data_batch_et, filters_shape);
     set_output_type(1, data_batch_et, bias_shape);
 }
@@ -48,6 +48,13 @@ namespace ngraph
                     virtual std::shared_ptr<Node>
                         copy_with_new_args(const NodeVector& new_args) const override;
 
+                    size_t get_arg_output_index() const { return arg_output_index; }
+                    const std::shared_ptr<ngraph::runtime::cpu::LayoutDescriptor>&
+                        get_output_layout() const
+                    {
+                        return output_layout;
+                    }
+
                 protected:
                     size_t arg_output_index;
                     std::shared_ptr<ngraph::runtime::cpu::LayoutDescriptor> output_layout;
@@ -48,6 +48,7 @@ op::Lstm::Lstm(std::shared_ptr<Node> src_layer,
     , m_direction(1)
     , m_num_fused_layers(1)
 {
+    set_output_size(2);
     constructor_validate_and_infer_types();
 
     if (src_layer->get_shape().size() != weights_layer->get_shape().size())
@@ -90,7 +91,6 @@ op::Lstm::Lstm(std::shared_ptr<Node> src_layer,
         }
     }
 
-    set_output_size(2);
     set_output_type(0,
                     src_layer->get_element_type(),
                     Shape{(m_num_timesteps * m_batch_size), m_src_iter_feature_size});
@@ -35,6 +35,7 @@ op::MaxPoolWithIndices::MaxPoolWithIndices(const shared_ptr<Node>& arg,
     , m_padding_below(padding_below)
     , m_padding_above(padding_above)
 {
+    set_output_size(2);
     constructor_validate_and_infer_types();
 
     auto& arg_shape = get_input_shape(0);
@@ -155,7 +156,6 @@ op::MaxPoolWithIndices::MaxPoolWithIndices(const shared_ptr<Node>& arg,
     result_shape[1] = channel_count;
     copy(output_item_shape.begin(), output_item_shape.end(), result_shape.begin() + 2);
 
-    set_output_size(2);
     set_output_type(0, get_input_element_type(0), result_shape);
     // MKLDNN can pick one of the two following datatypes
     // to store maximum indices: s32 and u8.
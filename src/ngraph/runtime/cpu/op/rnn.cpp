@@ -59,6 +59,7 @@ op::Rnn::Rnn(std::shared_ptr<Node> src_layer,
     , m_direction(direction)
     , m_num_fused_layers(num_fused_layers)
 {
+    set_output_size(2);
     constructor_validate_and_infer_types();
     if (src_layer->get_shape().size() != weights_layer->get_shape().size())
     {
@@ -105,7 +106,6 @@ op::Rnn::Rnn(std::shared_ptr<Node> src_layer,
         }
     }
 
-    set_output_size(2);
     set_output_type(0,
                     src_layer->get_element_type(),
                     Shape{(m_direction * m_num_timesteps * m_batch_size), m_src_iter_feature_size});
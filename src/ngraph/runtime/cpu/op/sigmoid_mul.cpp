@@ -112,6 +112,7 @@ op::SigmoidMultiplyBackprop::SigmoidMultiplyBackprop(std::shared_ptr<Node> input
     : Op("SigmoidMultiplyBackprop", check_single_output_args({input_0, input_1, delta}))
     , m_input_type(input_type)
 {
+    set_output_size(2);
     constructor_validate_and_infer_types();
 
     if (input_0->get_element_type() != input_1->get_element_type())
@@ -131,7 +132,6 @@ op::SigmoidMultiplyBackprop::SigmoidMultiplyBackprop(std::shared_ptr<Node> input
     {
         throw ngraph_error("Argument and delta shape for SigmoidMultiply backprop do not match");
     }
-    set_output_size(2);
     set_output_type(0, get_input_element_type(0), get_input_shape(0));
     set_output_type(1, get_input_element_type(1), get_input_shape(1));
 }
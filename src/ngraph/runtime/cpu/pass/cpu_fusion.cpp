@@ -1480,6 +1480,51 @@ void ngraph::runtime::cpu::pass::CPUFusion::construct_conv_bias_folded_batch_nor
     this->add_matcher(m);
 }
 
+// Check if values are being broadcast along channel (2nd) dimension
+static bool is_channel_bcast(const std::shared_ptr<ngraph::op::Broadcast>& bcast)
+{
+    if (bcast->get_argument(0)->get_shape().size() == 0)
+    {
+        return true;
+    }
+
+    if (bcast->get_argument(0)->get_shape().size() == 1 &&
+        bcast->get_broadcast_axes() == ngraph::AxisSet{0, 2, 3})
+    {
+        return true;
+    }
+
+    if (bcast->get_argument(0)->get_shape().size() == 2)
+    {
+        auto input_shape = bcast->get_argument(0)->get_shape();
+        if (input_shape[0] == 1 && bcast->get_broadcast_axes() == ngraph::AxisSet{2, 3})
+            return true;
+    }
+    return false;
+}
+
+static std::shared_ptr<ngraph::Node>
+    get_channel_bcast_input(const std::shared_ptr<ngraph::op::Broadcast>& bcast)
+{
+    if (bcast->get_argument(0)->get_shape().size() == 0)
+    {
+        ngraph::Shape bshape{bcast->get_shape()[1]};
+        return std::static_pointer_cast<ngraph::Node>(std::make_shared<ngraph::op::Broadcast>(
+            bcast->get_argument(0), bshape, ngraph::AxisSet{0}));
+    }
+    if (bcast->get_argument(0)->get_shape().size() == 1)
+    {
+        return bcast->get_argument(0);
+    }
+    if (bcast->get_argument(0)->get_shape().size() == 2)
+    {
+        ngraph::Shape bshape{bcast->get_argument(0)->get_shape()[1]};
+        return std::static_pointer_cast<ngraph::Node>(std::make_shared<ngraph::op::Reshape>(
+            bcast->get_argument(0), ngraph::AxisVector{0, 1}, bshape));
+    }
+    throw ngraph::ngraph_error("Unexpected shape for bcast input");
+}
+
 void ngraph::runtime::cpu::pass::CPUFusion::construct_conv_bias_affine_folding()
 {
     // A * ConvBias (input, filters, bias) + B -> ConvBias (input, filters * A_c)
@@ -1528,55 +1573,12 @@ void ngraph::runtime::cpu::pass::CPUFusion::construct_conv_bias_affine_folding()
 
         auto A_m = std::static_pointer_cast<op::Broadcast>(pattern_map[A_label]);
 
-        // Check if values are being broadcast along channel (2nd) dimension
-        auto is_channel_bcast = [](const std::shared_ptr<op::Broadcast>& bcast) {
-
-            if (bcast->get_argument(0)->get_shape().size() == 0)
-            {
-                return true;
-            }
-
-            if (bcast->get_argument(0)->get_shape().size() == 1 &&
-                bcast->get_broadcast_axes() == AxisSet{0, 2, 3})
-            {
-                return true;
-            }
-
-            if (bcast->get_argument(0)->get_shape().size() == 2)
-            {
-                auto input_shape = bcast->get_argument(0)->get_shape();
-                if (input_shape[0] == 1 && bcast->get_broadcast_axes() == AxisSet{2, 3})
-                    return true;
-            }
-            return false;
-        };
-
         if (!is_channel_bcast(A_m))
         {
             return false;
         }
 
-        auto get_bcast_input = [](const std::shared_ptr<op::Broadcast>& bcast) {
-            if (bcast->get_argument(0)->get_shape().size() == 0)
-            {
-                Shape bshape{bcast->get_shape()[1]};
-                return std::static_pointer_cast<ngraph::Node>(
-                    std::make_shared<op::Broadcast>(bcast->get_argument(0), bshape, AxisSet{0}));
-            }
-            if (bcast->get_argument(0)->get_shape().size() == 1)
-            {
-                return bcast->get_argument(0);
-            }
-            if (bcast->get_argument(0)->get_shape().size() == 2)
-            {
-                Shape bshape{bcast->get_argument(0)->get_shape()[1]};
-                return std::static_pointer_cast<ngraph::Node>(std::make_shared<op::Reshape>(
-                    bcast->get_argument(0), AxisVector{0, 1}, bshape));
-            }
-            throw ngraph_error("Unexpected shape for bcast input");
-        };
-
-        auto Ac_m = get_bcast_input(A_m);
+        auto Ac_m = get_channel_bcast_input(A_m);
 
         // new weights = old weights * Ac_m
         // new_bias = old_bias * Ac_m;
@@ -1704,6 +1706,266 @@ void ngraph::runtime::cpu::pass::CPUFusion::construct_groupconv_batchnorm_global
     this->add_matcher(m);
 }
 
+void ngraph::runtime::cpu::pass::CPUFusion::construct_groupconv_affine_folding()
+{
+    // A * GroupConv[Bias] (input, filters[, bias])
+    //     -> GroupConv[Bias] (input, filters * A_c[, bias * A_c])
+    auto is_groupconv = [](std::shared_ptr<Node> n) {
+        if (std::dynamic_pointer_cast<op::GroupConvolution>(n))
+        {
+            return true;
+        }
+        auto conv_bias = std::dynamic_pointer_cast<op::GroupConvolutionBias>(n);
+        return conv_bias && !conv_bias->with_relu();
+    };
+    auto conv_label =
+        std::make_shared<pattern::op::Label>(element::f32, Shape{1, 32, 2, 2}, is_groupconv);
+
+    auto Ac = std::make_shared<pattern::op::Label>(element::f32, Shape{32});
+    auto A = std::make_shared<op::Broadcast>(Ac, Shape{1, 32, 2, 2}, AxisSet{0, 2, 3});
+    auto A_label = std::make_shared<pattern::op::Label>(A, nullptr, NodeVector{A});
+    auto multiply = std::make_shared<op::Multiply>(conv_label, A_label);
+
+    ngraph::pattern::graph_rewrite_callback callback = [conv_label, A_label](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for groupconv affine folding against node = "
+                     << m.get_match_root()->get_name();
+        auto pattern_map = m.get_pattern_map();
+
+        auto conv_m = pattern_map[conv_label];
+        if (conv_m->get_users().size() > 1)
+        {
+            return false;
+        }
+
+        if (conv_m->get_shape().size() != 4)
+        {
+            return false;
+        }
+
+        auto A_m = std::static_pointer_cast<op::Broadcast>(pattern_map[A_label]);
+        if (!is_channel_bcast(A_m))
+        {
+            return false;
+        }
+
+        auto Ac_m = get_channel_bcast_input(A_m);
+
+        // new weights = old weights * Ac_m
+        // new bias = old bias * Ac_m
+
+        auto filters = conv_m->get_argument(1);
+        auto filters_n = std::make_shared<op::Multiply>(
+            filters,
+            std::make_shared<op::Broadcast>(Ac_m, filters->get_shape(), AxisSet{1, 2, 3}));
+
+        std::shared_ptr<Node> conv_n;
+        if (auto gconv = std::dynamic_pointer_cast<op::GroupConvolution>(conv_m))
+        {
+            conv_n = std::make_shared<op::GroupConvolution>(gconv->get_argument(0),
+                                                            filters_n,
+                                                            gconv->get_window_movement_strides(),
+                                                            gconv->get_window_dilation_strides(),
+                                                            gconv->get_padding_below(),
+                                                            gconv->get_padding_above(),
+                                                            gconv->get_data_dilation_strides(),
+                                                            gconv->get_groups(),
+                                                            gconv->get_shape());
+        }
+        else
+        {
+            auto gconv_bias = std::static_pointer_cast<op::GroupConvolutionBias>(conv_m);
+            auto bias_n = std::make_shared<op::Multiply>(gconv_bias->get_bias(), Ac_m);
+            conv_n = std::make_shared<op::GroupConvolutionBias>(
+                gconv_bias->get_argument(0),
+                filters_n,
+                bias_n,
+                gconv_bias->get_window_movement_strides(),
+                gconv_bias->get_window_dilation_strides(),
+                gconv_bias->get_padding_below(),
+                gconv_bias->get_padding_above(),
+                gconv_bias->get_data_dilation_strides(),
+                gconv_bias->get_groups(),
+                gconv_bias->get_shape(),
+                false,
+                gconv_bias->get_alpha());
+        }
+        ngraph::replace_node(m.get_match_root(), conv_n);
+
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(
+        multiply, callback, "CPUFusion.GroupconvAffineFolding");
+    this->add_matcher(m);
+}
+
+// Returns the values of a broadcast that varies along a single axis of a rank-2
+// MatmulBias output, and sets `axis` to that axis. Returns nullptr otherwise.
+static std::shared_ptr<ngraph::Node>
+    get_matmul_bcast_input(const std::shared_ptr<ngraph::Node>& node, size_t& axis)
+{
+    auto bcast = std::dynamic_pointer_cast<ngraph::op::Broadcast>(node);
+    if (!bcast || bcast->get_shape().size() != 2)
+    {
+        return nullptr;
+    }
+
+    auto arg = bcast->get_argument(0);
+    if (arg->get_shape().size() == 0)
+    {
+        axis = 1;
+        return std::make_shared<ngraph::op::Broadcast>(
+            arg, ngraph::Shape{bcast->get_shape()[1]}, ngraph::AxisSet{0});
+    }
+    if (arg->get_shape().size() == 1 && bcast->get_broadcast_axes().size() == 1)
+    {
+        axis = 1 - *bcast->get_broadcast_axes().begin();
+        return arg;
+    }
+    return nullptr;
+}
+
+// Returns the bias of `mmb` as a vector varying along `axis` of the output, a null
+// bias if `mmb` has none, or false if the bias varies along the other axis.
+static bool get_matmul_bias_along(const std::shared_ptr<ngraph::op::MatmulBias>& mmb,
+                                  size_t axis,
+                                  std::shared_ptr<ngraph::Node>& bias)
+{
+    bias = nullptr;
+    if (mmb->get_arguments().size() < 3)
+    {
+        return true;
+    }
+
+    bias = mmb->get_argument(2);
+    if (mmb->get_broadcast_axes() == ngraph::AxisSet{1 - axis})
+    {
+        return true;
+    }
+    if (mmb->get_broadcast_axes() == ngraph::AxisSet{0, 1})
+    {
+        bias = std::make_shared<ngraph::op::Broadcast>(
+            bias, ngraph::Shape{mmb->get_shape()[axis]}, ngraph::AxisSet{0});
+        return true;
+    }
+    return false;
+}
+
+void ngraph::runtime::cpu::pass::CPUFusion::construct_matmulbias_affine_folding()
+{
+    // A * MatmulBias (W, x[, b]) -> MatmulBias (W * A_r, x, b * A_r) for A varying by row
+    //                            -> MatmulBias (W, x * A_c, b * A_c) for A varying by column
+    auto mmb_label = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{2, 1}, pattern::has_class<op::MatmulBias>());
+    auto A = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{2, 1}, pattern::has_class<op::Broadcast>());
+    auto multiply = std::make_shared<op::Multiply>(mmb_label, A);
+
+    ngraph::pattern::graph_rewrite_callback callback = [mmb_label, A](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for matmulbias affine folding against node = "
+                     << m.get_match_root()->get_name();
+        auto pattern_map = m.get_pattern_map();
+
+        auto mmb = std::static_pointer_cast<op::MatmulBias>(pattern_map[mmb_label]);
+        if (mmb->get_users(true).size() > 1)
+        {
+            return false;
+        }
+
+        size_t axis;
+        auto A_m = get_matmul_bcast_input(pattern_map[A], axis);
+        std::shared_ptr<Node> bias;
+        if (!A_m || !get_matmul_bias_along(mmb, axis, bias))
+        {
+            return false;
+        }
+
+        // Rows of the product come from W and columns from x; scale the
+        // operand dimension that ends up along `axis`
+        auto W = mmb->get_argument(0);
+        auto x = mmb->get_argument(1);
+        if (axis == 0)
+        {
+            size_t w_axis = mmb->get_is_a_transposed() ? 1 : 0;
+            W = std::make_shared<op::Multiply>(
+                W, std::make_shared<op::Broadcast>(A_m, W->get_shape(), AxisSet{1 - w_axis}));
+        }
+        else
+        {
+            size_t x_axis = mmb->get_is_b_transposed() ? 0 : 1;
+            x = std::make_shared<op::Multiply>(
+                x, std::make_shared<op::Broadcast>(A_m, x->get_shape(), AxisSet{1 - x_axis}));
+        }
+        if (bias)
+        {
+            bias = std::make_shared<op::Multiply>(bias, A_m);
+        }
+
+        auto mmb_n = std::make_shared<op::MatmulBias>(W,
+                                                      x,
+                                                      bias,
+                                                      mmb->get_a_shape(),
+                                                      mmb->get_b_shape(),
+                                                      mmb->get_is_a_transposed(),
+                                                      mmb->get_is_b_transposed(),
+                                                      bias ? AxisSet{1 - axis} : AxisSet{});
+        ngraph::replace_node(m.get_match_root(), mmb_n);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(
+        multiply, callback, "CPUFusion.MatmulBiasAffineFolding");
+    this->add_matcher(m);
+}
+
+void ngraph::runtime::cpu::pass::CPUFusion::construct_matmulbias_add_folding()
+{
+    // MatmulBias (W, x, b) + B -> MatmulBias (W, x, b + B)
+    auto mmb_label = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{2, 1}, [](std::shared_ptr<Node> n) {
+            return std::dynamic_pointer_cast<op::MatmulBias>(n) &&
+                   n->get_arguments().size() == 3;
+        });
+    auto B = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{2, 1}, pattern::has_class<op::Broadcast>());
+    auto add = std::make_shared<op::Add>(mmb_label, B);
+
+    ngraph::pattern::graph_rewrite_callback callback = [mmb_label, B](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for matmulbias add folding against node = "
+                     << m.get_match_root()->get_name();
+        auto pattern_map = m.get_pattern_map();
+
+        auto mmb = std::static_pointer_cast<op::MatmulBias>(pattern_map[mmb_label]);
+        if (mmb->get_users(true).size() > 1)
+        {
+            return false;
+        }
+
+        size_t axis;
+        auto B_m = get_matmul_bcast_input(pattern_map[B], axis);
+        std::shared_ptr<Node> bias;
+        if (!B_m || !get_matmul_bias_along(mmb, axis, bias))
+        {
+            return false;
+        }
+
+        auto mmb_n = std::make_shared<op::MatmulBias>(mmb->get_argument(0),
+                                                      mmb->get_argument(1),
+                                                      std::make_shared<op::Add>(bias, B_m),
+                                                      mmb->get_a_shape(),
+                                                      mmb->get_b_shape(),
+                                                      mmb->get_is_a_transposed(),
+                                                      mmb->get_is_b_transposed(),
+                                                      AxisSet{1 - axis});
+        ngraph::replace_node(m.get_match_root(), mmb_n);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(
+        add, callback, "CPUFusion.MatmulBiasAddFolding");
+    this->add_matcher(m);
+}
+
 void ngraph::runtime::cpu::pass::CPUFusion::
     construct_groupconv_batchnorm_global_stats_folding_relu()
 {
@@ -48,6 +48,8 @@ public:
         {
             construct_matmul();
             construct_matmulbias();
+            construct_matmulbias_affine_folding();
+            construct_matmulbias_add_folding();
             construct_fprop_bn();
             construct_zero_padded_reshaped_conv();
             construct_zero_padded_conv();
@@ -56,6 +58,7 @@ public:
             construct_conv_bias_folded_batch_norm();
             construct_conv_bias_affine_folding();
             construct_groupconv_batchnorm_global_stats_folding();
+            construct_groupconv_affine_folding();
             construct_groupconv_batchnorm_global_stats_folding_relu();
             construct_batch_norm_relu();
             construct_batch_norm_relu_global_stats();
@@ -76,6 +79,8 @@ public:
 private:
     void construct_matmul();
     void construct_matmulbias();
+    void construct_matmulbias_affine_folding();
+    void construct_matmulbias_add_folding();
     void construct_conv_bias();
     void construct_conv_bias_bprop();
     void construct_fprop_bn();
@@ -96,6 +101,7 @@ private:
     void construct_conv_bias_folded_batch_norm();
     void construct_conv_bias_affine_folding();
     void construct_groupconv_batchnorm_global_stats_folding();
+    void construct_groupconv_affine_folding();
     void construct_groupconv_batchnorm_global_stats_folding_relu();
     void construct_update_slice();
     void construct_fuse_lstm_recurrent_state();
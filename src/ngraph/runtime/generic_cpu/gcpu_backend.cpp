@@ -15,14 +15,13 @@
 //*****************************************************************************
 
 #include "ngraph/runtime/generic_cpu/gcpu_backend.hpp"
-#include <omp.h>
 #include "ngraph/descriptor/layout/dense_tensor_layout.hpp"
 #include "ngraph/except.hpp"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/op/convert.hpp"
 #include "ngraph/op/select.hpp"
 #include "ngraph/op/util/binary_elementwise_comparison.hpp"
 #include "ngraph/pass/algebraic_simplification.hpp"
-#include "ngraph/pass/any_all_replacement.hpp"
 #include "ngraph/pass/assign_layout.hpp"
 #include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/pass/core_fusion.hpp"
@@ -83,7 +82,6 @@ runtime::Handle runtime::gcpu::GCPUBackend::compile(shared_ptr<Function> functio
     {
         instance.m_is_compiled = true;
         pass::Manager pass_manager;
-        // pass_manager.register_pass<pass::AnyAllReplacement>();
         pass_manager.register_pass<pass::LikeReplacement>();
         pass_manager.register_pass<pass::NopElimination>();
         pass_manager.register_pass<pass::ZeroDimTensorElimination>();
@@ -99,10 +97,56 @@ runtime::Handle runtime::gcpu::GCPUBackend::compile(shared_ptr<Function> functio
         size_t memory_pool_size = function->get_temporary_pool_size();
         instance.m_temporary_memory.reset(new AlignedBuffer(memory_pool_size, get_alignment()));
 
+        size_t input_count = 0;
+        for (auto param : function->get_parameters())
+        {
+            if (param->get_cacheable())
+            {
+                instance.m_cached_ops.insert(param.get());
+                for (size_t i = 0; i < param->get_output_size(); ++i)
+                {
+                    instance.m_cacheable_inputs.push_back(input_count + i);
+                }
+            }
+            input_count += param->get_output_size();
+        }
+        instance.m_cache_keys.assign(instance.m_cacheable_inputs.size(), {});
+
+        // Outputs of ops computed only from constants and cacheable parameters are kept out
+        // of the temporary pool so that they outlive the call
+        pass::MemoryManager cached_memory(get_alignment());
         for (const shared_ptr<Node>& node : function->get_ordered_ops())
         {
             instance.m_wrapped_nodes.emplace_back(node);
+            auto type_id = instance.m_wrapped_nodes.back().get_typeid();
+            if (type_id == OP_TYPEID::Constant)
+            {
+                instance.m_cached_ops.insert(node.get());
+            }
+            else if (type_id != OP_TYPEID::Parameter && type_id != OP_TYPEID::Result &&
+                     is_reusable(*node) && node->get_input_size() > 0)
+            {
+                bool is_cacheable = true;
+                for (const descriptor::Input& input : node->get_inputs())
+                {
+                    is_cacheable = is_cacheable &&
+                                   instance.m_cached_ops.count(
+                                       input.get_output().get_node().get()) != 0;
+                }
+                if (is_cacheable)
+                {
+                    instance.m_cached_ops.insert(node.get());
+                    for (size_t i = 0; i < node->get_output_size(); ++i)
+                    {
+                        descriptor::Tensor* tensor = node->get_output_tensor_ptr(i).get();
+                        instance.m_cached_offsets.insert(
+                            {tensor, cached_memory.allocate(tensor->size())});
+                    }
+                }
+            }
         }
+        instance.m_cached_memory.reset(
+            new AlignedBuffer(cached_memory.max_allocated(), get_alignment()));
     }
 
     return function;
@@ -165,6 +209,21 @@ bool runtime::gcpu::GCPUBackend::call(shared_ptr<Function> function,
         tensor_map.insert({tensor, func_outputs[output_count]});
     }
 
+    // Cached ops are skipped while every cacheable parameter is bound to the same tensor, at
+    // the same version, as when they last ran
+    bool use_cache = instance.m_cache_valid;
+    for (size_t i = 0; i < instance.m_cacheable_inputs.size(); i++)
+    {
+        const shared_ptr<runtime::Tensor>& tensor = inputs[instance.m_cacheable_inputs[i]];
+        pair<weak_ptr<runtime::Tensor>, uint64_t>& key = instance.m_cache_keys[i];
+        if (key.first.lock() != tensor || key.second != tensor->get_version())
+        {
+            use_cache = false;
+            key = {tensor, tensor->get_version()};
+        }
+    }
+    instance.m_cache_valid = false;
+
     // for each ordered op in the graph
     for (const NodeWrapper& wrapped : instance.m_wrapped_nodes)
     {
@@ -197,7 +256,13 @@ bool runtime::gcpu::GCPUBackend::call(shared_ptr<Function> function,
             descriptor::Tensor* tensor = op->get_output_tensor_ptr(i).get();
             void* host_tensor = nullptr;
             auto it = tensor_map.find(tensor);
-            if (it == tensor_map.end())
+            auto cached = instance.m_cached_offsets.find(tensor);
+            if (cached != instance.m_cached_offsets.end())
+            {
+                host_tensor = instance.m_cached_memory->get_ptr(cached->second);
+                tensor_map.insert({tensor, host_tensor});
+            }
+            else if (it == tensor_map.end())
             {
                 auto offset = op->get_output_tensor(i).get_pool_offset();
                 host_tensor = instance.get_temporary_pointer(offset);
@@ -211,6 +276,10 @@ bool runtime::gcpu::GCPUBackend::call(shared_ptr<Function> function,
             htv_outputs.push_back(make_shared<runtime::HostTensor>(
                 tensor->get_element_type(), tensor->get_shape(), host_tensor, this));
         }
+        if (use_cache && instance.m_cached_ops.count(op) != 0)
+        {
+            continue;
+        }
 
         // get op type
         element::Type type;
@@ -250,6 +319,13 @@ bool runtime::gcpu::GCPUBackend::call(shared_ptr<Function> function,
         }
     }
 
+    instance.m_cache_valid = true;
+
+    for (const shared_ptr<runtime::Tensor>& output : outputs)
+    {
+        output->mark_modified();
+    }
+
     return true;
 }
 
@@ -305,3 +381,13 @@ bool runtime::gcpu::GCPUBackend::is_supported(const Node& node) const
 {
     return m_unsupported_op_name_list.find(node.description()) == m_unsupported_op_name_list.end();
 }
+
+bool runtime::gcpu::GCPUBackend::is_supported_property(const Property prop) const
+{
+    if (prop == Property::memory_attach)
+    {
+        return true;
+    }
+
+    return false;
+}
@@ -20,6 +20,8 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "ngraph/op/all.hpp"
@@ -46,15 +48,11 @@
 #include "ngraph/op/pad.hpp"
 #include "ngraph/op/product.hpp"
 #include "ngraph/op/quantize.hpp"
-#include "ngraph/op/reduce.hpp"
-#include "ngraph/op/reduce_window.hpp"
 #include "ngraph/op/replace_slice.hpp"
 #include "ngraph/op/reshape.hpp"
 #include "ngraph/op/result.hpp"
 #include "ngraph/op/reverse.hpp"
 #include "ngraph/op/reverse_sequence.hpp"
-#include "ngraph/op/select_and_scatter.hpp"
-#include "ngraph/op/select_and_scatter.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/op/softmax.hpp"
 #include "ngraph/op/sum.hpp"
@@ -63,7 +61,9 @@
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/generic_cpu/kernel/broadcast.hpp"
 #include "ngraph/runtime/generic_cpu/kernel/dot.hpp"
+#include "ngraph/runtime/generic_cpu/kernel/elementwise.hpp"
 #include "ngraph/runtime/generic_cpu/kernel/reshape.hpp"
+#include "ngraph/runtime/generic_cpu/kernel/slice.hpp"
 #include "ngraph/runtime/generic_cpu/node_wrapper.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
 #include "ngraph/runtime/reference/abs.hpp"
@@ -114,21 +114,17 @@
 #include "ngraph/runtime/reference/power.hpp"
 #include "ngraph/runtime/reference/product.hpp"
 #include "ngraph/runtime/reference/quantize.hpp"
-#include "ngraph/runtime/reference/reduce.hpp"
-#include "ngraph/runtime/reference/reduce_window.hpp"
 #include "ngraph/runtime/reference/relu.hpp"
 #include "ngraph/runtime/reference/replace_slice.hpp"
 #include "ngraph/runtime/reference/result.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
 #include "ngraph/runtime/reference/reverse_sequence.hpp"
 #include "ngraph/runtime/reference/select.hpp"
-#include "ngraph/runtime/reference/select_and_scatter.hpp"
 #include "ngraph/runtime/reference/shape_of.hpp"
 #include "ngraph/runtime/reference/sigmoid.hpp"
 #include "ngraph/runtime/reference/sign.hpp"
 #include "ngraph/runtime/reference/sin.hpp"
 #include "ngraph/runtime/reference/sinh.hpp"
-#include "ngraph/runtime/reference/slice.hpp"
 #include "ngraph/runtime/reference/softmax.hpp"
 #include "ngraph/runtime/reference/sqrt.hpp"
 #include "ngraph/runtime/reference/subtract.hpp"
@@ -180,6 +176,8 @@ public:
 
     bool is_supported(const Node& node) const override;
 
+    bool is_supported_property(const Property prop) const override;
+
 private:
     int get_alignment() const { return 64; }
     class FunctionInstance
@@ -191,6 +189,17 @@ private:
         std::vector<NodeWrapper> m_wrapped_nodes;
         std::unordered_map<const Node*, std::shared_ptr<RNGState>> m_states;
         std::shared_ptr<AlignedBuffer> m_temporary_memory;
+        // Ops computed only from constants and cacheable parameters, and where their outputs
+        // live in m_cached_memory. They are skipped for as long as those parameters are
+        // unchanged.
+        std::unordered_set<const Node*> m_cached_ops;
+        std::unordered_map<const descriptor::Tensor*, size_t> m_cached_offsets;
+        std::shared_ptr<AlignedBuffer> m_cached_memory;
+        // Inputs of cacheable parameters, and the tensor and version each one had when the
+        // cached ops last ran
+        std::vector<size_t> m_cacheable_inputs;
+        std::vector<std::pair<std::weak_ptr<Tensor>, uint64_t>> m_cache_keys;
+        bool m_cache_valid = false;
 
         void* get_temporary_pointer(size_t offset) { return m_temporary_memory->get_ptr(offset); }
     };
@@ -238,10 +247,11 @@ private:
         case OP_TYPEID::Add:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::add<T>(static_cast<const T*>(args[0]),
-                              static_cast<const T*>(args[1]),
-                              static_cast<T*>(out[0]),
-                              element_count);
+            gcpu::kernel::binary_elementwise(static_cast<const T*>(args[0]),
+                                             static_cast<const T*>(args[1]),
+                                             static_cast<T*>(out[0]),
+                                             element_count,
+                                             [](T x, T y) { return x + y; });
             break;
         }
         case OP_TYPEID::All:
@@ -360,7 +370,8 @@ private:
                                    avg_pool->get_window_movement_strides(),
                                    avg_pool->get_padding_below(),
                                    avg_pool->get_padding_above(),
-                                   avg_pool->get_include_padding_in_avg_computation());
+                                   avg_pool->get_include_padding_in_avg_computation(),
+                                   true);
             break;
         }
         case OP_TYPEID::GenerateMask:
@@ -569,7 +580,8 @@ private:
                                       0,
                                       0,
                                       1,
-                                      false);
+                                      false,
+                                      true);
             break;
         }
         case OP_TYPEID::ConvolutionBackpropFilters:
@@ -593,7 +605,8 @@ private:
                                       1,
                                       1,
                                       0,
-                                      false);
+                                      false,
+                                      true);
             break;
         }
         case OP_TYPEID::ConvolutionBackpropData:
@@ -618,6 +631,7 @@ private:
                                       1,
                                       0,
                                       1,
+                                      true,
                                       true);
             break;
         }
@@ -747,8 +761,10 @@ private:
         case OP_TYPEID::Exp:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::exp<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            gcpu::kernel::unary_elementwise(static_cast<const T*>(args[0]),
+                                            static_cast<T*>(out[0]),
+                                            element_count,
+                                            [](T x) { return std::exp(x); });
             break;
         }
         case OP_TYPEID::Floor:
@@ -758,35 +774,6 @@ private:
                 static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
             break;
         }
-        case OP_TYPEID::FunctionCall:
-        {
-            std::shared_ptr<Function> function = node.get_functions()[0];
-
-            std::vector<std::shared_ptr<runtime::Tensor>> outputs;
-            for (size_t i = 0; i < function->get_output_size(); i++)
-            {
-                element::Type et = function->get_output_element_type(i);
-                Shape shape = function->get_output_shape(i);
-                auto host_tensor = std::make_shared<HostTensor>(et, shape, out[i], this);
-                outputs.push_back(std::static_pointer_cast<runtime::Tensor>(host_tensor));
-            }
-
-            std::vector<std::shared_ptr<runtime::Tensor>> inputs;
-            auto parameters = function->get_parameters();
-            for (size_t i = 0; i < parameters.size(); i++)
-            {
-                auto parameter = parameters[i];
-                element::Type et = parameter->get_element_type();
-                Shape shape = parameter->get_shape();
-                auto host_tensor =
-                    std::make_shared<HostTensor>(et, shape, const_cast<void*>(args[i]), this);
-                inputs.push_back(std::static_pointer_cast<runtime::Tensor>(host_tensor));
-            }
-
-            auto handle = compile(function);
-            call(handle, outputs, inputs);
-            break;
-        }
         case OP_TYPEID::Greater:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
@@ -826,8 +813,10 @@ private:
         case OP_TYPEID::Log:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::log<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            gcpu::kernel::unary_elementwise(static_cast<const T*>(args[0]),
+                                            static_cast<T*>(out[0]),
+                                            element_count,
+                                            [](T x) { return std::log(x); });
             break;
         }
         case OP_TYPEID::LRN:
@@ -845,20 +834,24 @@ private:
         case OP_TYPEID::Max:
         {
             const op::Max* max = static_cast<const op::Max*>(&node);
+            bool parallel =
+                shape_size(node.get_input_shape(0)) >= gcpu::kernel::parallel_grain;
             reference::max<T>(static_cast<const T*>(args[0]),
                               static_cast<T*>(out[0]),
                               node.get_input_shape(0),
                               node.get_output_shape(0),
-                              max->get_reduction_axes());
+                              max->get_reduction_axes(),
+                              parallel);
             break;
         }
         case OP_TYPEID::Maximum:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::maximum<T>(static_cast<const T*>(args[0]),
-                                  static_cast<const T*>(args[1]),
-                                  static_cast<T*>(out[0]),
-                                  element_count);
+            gcpu::kernel::binary_elementwise(static_cast<const T*>(args[0]),
+                                             static_cast<const T*>(args[1]),
+                                             static_cast<T*>(out[0]),
+                                             element_count,
+                                             [](T x, T y) { return x > y ? x : y; });
             break;
         }
         case OP_TYPEID::MaxPool:
@@ -872,7 +865,8 @@ private:
                                    max_pool->get_window_shape(),
                                    max_pool->get_window_movement_strides(),
                                    max_pool->get_padding_below(),
-                                   max_pool->get_padding_above());
+                                   max_pool->get_padding_above(),
+                                   true);
             break;
         }
         case OP_TYPEID::MaxPoolBackprop:
@@ -894,36 +888,43 @@ private:
         case OP_TYPEID::Min:
         {
             const op::Min* min = static_cast<const op::Min*>(&node);
+            bool parallel =
+                shape_size(node.get_input_shape(0)) >= gcpu::kernel::parallel_grain;
             reference::min<T>(static_cast<const T*>(args[0]),
                               static_cast<T*>(out[0]),
                               node.get_input_shape(0),
                               node.get_output_shape(0),
-                              min->get_reduction_axes());
+                              min->get_reduction_axes(),
+                              parallel);
             break;
         }
         case OP_TYPEID::Minimum:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::minimum<T>(static_cast<const T*>(args[0]),
-                                  static_cast<const T*>(args[1]),
-                                  static_cast<T*>(out[0]),
-                                  element_count);
+            gcpu::kernel::binary_elementwise(static_cast<const T*>(args[0]),
+                                             static_cast<const T*>(args[1]),
+                                             static_cast<T*>(out[0]),
+                                             element_count,
+                                             [](T x, T y) { return x < y ? x : y; });
             break;
         }
         case OP_TYPEID::Multiply:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::multiply<T>(static_cast<const T*>(args[0]),
-                                   static_cast<const T*>(args[1]),
-                                   static_cast<T*>(out[0]),
-                                   element_count);
+            gcpu::kernel::binary_elementwise(static_cast<const T*>(args[0]),
+                                             static_cast<const T*>(args[1]),
+                                             static_cast<T*>(out[0]),
+                                             element_count,
+                                             [](T x, T y) { return x * y; });
             break;
         }
         case OP_TYPEID::Negative:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::negate<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            gcpu::kernel::unary_elementwise(static_cast<const T*>(args[0]),
+                                            static_cast<T*>(out[0]),
+                                            element_count,
+                                            [](T x) { return -x; });
             break;
         }
         case OP_TYPEID::Not:
@@ -988,11 +989,14 @@ private:
         case OP_TYPEID::Product:
         {
             const op::Product* product = static_cast<const op::Product*>(&node);
+            bool parallel =
+                shape_size(node.get_input_shape(0)) >= gcpu::kernel::parallel_grain;
             reference::product<T>(static_cast<const T*>(args[0]),
                                   static_cast<T*>(out[0]),
                                   node.get_input_shape(0),
                                   node.get_output_shape(0),
-                                  product->get_reduction_axes());
+                                  product->get_reduction_axes(),
+                                  parallel);
             break;
         }
         case OP_TYPEID::Quantize:
@@ -1042,64 +1046,13 @@ private:
 
             break;
         }
-        case OP_TYPEID::Reduce:
-        {
-            const op::Reduce* reduce = static_cast<const op::Reduce*>(&node);
-            std::shared_ptr<Function> reduction_function = reduce->get_functions()[0];
-
-            std::function<T(T, T)> f = [this, &node, reduction_function](T x, T y) -> T {
-                auto tx = std::static_pointer_cast<HostTensor>(
-                    create_tensor(node.get_inputs().at(0).get_element_type(), Shape{}, &x));
-                auto ty = std::static_pointer_cast<HostTensor>(
-                    create_tensor(node.get_inputs().at(1).get_element_type(), Shape{}, &y));
-                auto tr = std::static_pointer_cast<HostTensor>(
-                    create_tensor(node.get_output_element_type(0), Shape{}));
-                auto handle = compile(reduction_function);
-                call(handle, {tr}, {tx, ty});
-                return *(tr->get_data_ptr<T>());
-            };
-
-            reference::reduce(static_cast<const T*>(args[0]),
-                              static_cast<const T*>(args[1]),
-                              static_cast<T*>(out[0]),
-                              node.get_inputs().at(0).get_shape(),
-                              node.get_output_shape(0),
-                              reduce->get_reduction_axes(),
-                              f);
-            break;
-        }
-        case OP_TYPEID::ReduceWindow:
-        {
-            const op::ReduceWindow* reduce_window = static_cast<const op::ReduceWindow*>(&node);
-            std::shared_ptr<Function> reduction_function = reduce_window->get_functions()[0];
-
-            std::function<T(T, T)> f = [this, &node, reduction_function](T x, T y) -> T {
-                auto tx = std::static_pointer_cast<HostTensor>(
-                    create_tensor(node.get_inputs().at(0).get_element_type(), Shape{}, &x));
-                auto ty = std::static_pointer_cast<HostTensor>(
-                    create_tensor(node.get_inputs().at(1).get_element_type(), Shape{}, &y));
-                auto tr = std::static_pointer_cast<HostTensor>(
-                    create_tensor(node.get_output_element_type(0), Shape{}));
-                auto handle = compile(reduction_function);
-                call(handle, {tr}, {tx, ty});
-                return *(tr->get_data_ptr<T>());
-            };
-
-            reference::reduce_window(static_cast<const T*>(args[0]),
-                                     static_cast<const T*>(args[1]),
-                                     static_cast<T*>(out[0]),
-                                     node.get_inputs().at(0).get_shape(),
-                                     node.get_output_shape(0),
-                                     f,
-                                     reduce_window->get_window_shape(),
-                                     reduce_window->get_window_movement_strides());
-            break;
-        }
         case OP_TYPEID::Relu:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::relu<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            gcpu::kernel::unary_elementwise(static_cast<const T*>(args[0]),
+                                            static_cast<T*>(out[0]),
+                                            element_count,
+                                            [](T x) { return x > T(0) ? x : T(0); });
             break;
         }
         case OP_TYPEID::ReluBackprop:
@@ -1181,53 +1134,6 @@ private:
                                  element_count);
             break;
         }
-        case OP_TYPEID::SelectAndScatter:
-        {
-            const ngraph::op::SelectAndScatter* select_and_scatter =
-                static_cast<const ngraph::op::SelectAndScatter*>(&node);
-
-            std::shared_ptr<ngraph::Function> selection_function =
-                select_and_scatter->get_functions()[0];
-            std::function<bool(T, T)> f_selection = [this, &node, selection_function](T x,
-                                                                                      T y) -> bool {
-                auto tx = std::static_pointer_cast<HostTensor>(
-                    create_tensor(node.get_inputs().at(0).get_element_type(), Shape{}, &x));
-                auto ty = std::static_pointer_cast<HostTensor>(
-                    create_tensor(node.get_inputs().at(1).get_element_type(), Shape{}, &y));
-                auto tr =
-                    std::static_pointer_cast<HostTensor>(create_tensor(element::boolean, Shape{}));
-                auto handle = compile(selection_function);
-                call(handle, {tr}, {tx, ty});
-                return *(tr->get_data_ptr<char>());
-            };
-
-            std::shared_ptr<ngraph::Function> scatter_function =
-                select_and_scatter->get_functions()[1];
-            std::function<T(T, T)> f_scatter = [this, &node, scatter_function](T x, T y) -> T {
-                auto tx = std::static_pointer_cast<HostTensor>(
-                    create_tensor(node.get_inputs().at(0).get_element_type(), Shape{}, &x));
-                auto ty = std::static_pointer_cast<HostTensor>(
-                    create_tensor(node.get_inputs().at(1).get_element_type(), Shape{}, &y));
-                auto tr = std::static_pointer_cast<HostTensor>(
-                    create_tensor(node.get_output_element_type(0), Shape{}));
-                auto handle = compile(scatter_function);
-                call(handle, {tr}, {tx, ty});
-                return *(tr->get_data_ptr<T>());
-            };
-
-            reference::select_and_scatter<T>(static_cast<const T*>(args[0]),
-                                             static_cast<const T*>(args[1]),
-                                             static_cast<const T*>(args[2]),
-                                             static_cast<T*>(out[0]),
-                                             node.get_input_shape(0),
-                                             node.get_input_shape(1),
-                                             node.get_output_shape(0),
-                                             f_selection,
-                                             f_scatter,
-                                             select_and_scatter->get_window_shape(),
-                                             select_and_scatter->get_window_movement_strides());
-            break;
-        }
         case OP_TYPEID::ShapeOf:
         {
             reference::shape_of(node.get_input_shape(0), static_cast<uint64_t*>(out[0]));
@@ -1236,8 +1142,13 @@ private:
         case OP_TYPEID::Sigmoid:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::sigmoid<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            gcpu::kernel::unary_elementwise(static_cast<const T*>(args[0]),
+                                            static_cast<T*>(out[0]),
+                                            element_count,
+                                            [](T x) {
+                                                T exp_value = std::exp(-x);
+                                                return 1 / (1 + exp_value);
+                                            });
             break;
         }
         case OP_TYPEID::SigmoidBackprop:
@@ -1273,13 +1184,12 @@ private:
         case OP_TYPEID::Slice:
         {
             const op::Slice* slice = static_cast<const op::Slice*>(&node);
-            reference::slice<T>(static_cast<const T*>(args[0]),
-                                static_cast<T*>(out[0]),
-                                node.get_input_shape(0),
-                                slice->get_lower_bounds(),
-                                slice->get_upper_bounds(),
-                                slice->get_strides(),
-                                node.get_output_shape(0));
+            gcpu::kernel::slice<T>(static_cast<const T*>(args[0]),
+                                   static_cast<T*>(out[0]),
+                                   node.get_input_shape(0),
+                                   slice->get_lower_bounds(),
+                                   slice->get_strides(),
+                                   node.get_output_shape(0));
             break;
         }
         case OP_TYPEID::Softmax:
@@ -1294,8 +1204,10 @@ private:
         case OP_TYPEID::Sqrt:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::sqrt<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            gcpu::kernel::unary_elementwise(static_cast<const T*>(args[0]),
+                                            static_cast<T*>(out[0]),
+                                            element_count,
+                                            [](T x) { return std::sqrt(x); });
             break;
         }
         case OP_TYPEID::StopGradient: { throw unsupported_op("Unsupported op 'StopGradient'");
@@ -1303,20 +1215,24 @@ private:
         case OP_TYPEID::Subtract:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::subtract<T>(static_cast<const T*>(args[0]),
-                                   static_cast<const T*>(args[1]),
-                                   static_cast<T*>(out[0]),
-                                   element_count);
+            gcpu::kernel::binary_elementwise(static_cast<const T*>(args[0]),
+                                             static_cast<const T*>(args[1]),
+                                             static_cast<T*>(out[0]),
+                                             element_count,
+                                             [](T x, T y) { return x - y; });
             break;
         }
         case OP_TYPEID::Sum:
         {
             const op::Sum* sum = static_cast<const op::Sum*>(&node);
+            bool parallel =
+                shape_size(node.get_input_shape(0)) >= gcpu::kernel::parallel_grain;
             reference::sum<T>(static_cast<const T*>(args[0]),
                               static_cast<T*>(out[0]),
                               node.get_input_shape(0),
                               node.get_output_shape(0),
-                              sum->get_reduction_axes());
+                              sum->get_reduction_axes(),
+                              parallel);
             break;
         }
         case OP_TYPEID::Tan:
@@ -1329,8 +1245,10 @@ private:
         case OP_TYPEID::Tanh:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::tanh<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            gcpu::kernel::unary_elementwise(static_cast<const T*>(args[0]),
+                                            static_cast<T*>(out[0]),
+                                            element_count,
+                                            [](T x) { return std::tanh(x); });
             break;
         }
         case OP_TYPEID::TopK:
@@ -0,0 +1,59 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+
+#include "ngraph/runtime/generic_cpu/kernel/for_each_range.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gcpu
+        {
+            namespace kernel
+            {
+                // The inner loops are kept free of calls and branches other than func so the
+                // compiler can vectorize them once func is inlined.
+
+                template <typename T, typename U, typename F>
+                void unary_elementwise(const T* arg, U* out, size_t count, const F& func)
+                {
+                    for_each_range(count, [&](size_t begin, size_t end) {
+                        for (size_t i = begin; i < end; i++)
+                        {
+                            out[i] = func(arg[i]);
+                        }
+                    });
+                }
+
+                template <typename T, typename U, typename F>
+                void binary_elementwise(
+                    const T* arg0, const T* arg1, U* out, size_t count, const F& func)
+                {
+                    for_each_range(count, [&](size_t begin, size_t end) {
+                        for (size_t i = begin; i < end; i++)
+                        {
+                            out[i] = func(arg0[i], arg1[i]);
+                        }
+                    });
+                }
+            }
+        }
+    }
+}
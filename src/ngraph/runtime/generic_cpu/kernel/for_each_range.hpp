@@ -0,0 +1,53 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+
+#include "ngraph/parallel.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gcpu
+        {
+            namespace kernel
+            {
+                /// \brief Kernels touching fewer elements than this run on the calling thread,
+                ///        handing them to the pool costs more than it saves.
+                constexpr size_t parallel_grain = 32768;
+
+                /// \brief Calls func(begin, end) over contiguous ranges that cover [0, count).
+                ///        When count is at least parallel_grain the ranges are run on the
+                ///        ngraph thread pool, otherwise func(0, count) is called directly.
+                template <typename F>
+                void for_each_range(size_t count, const F& func)
+                {
+                    if (count < parallel_grain)
+                    {
+                        func(0, count);
+                    }
+                    else
+                    {
+                        parallel_for_ranges(0, count, func);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -16,11 +16,8 @@
 
 #pragma once
 
-#define EIGEN_USE_THREADS
-#include <unsupported/Eigen/CXX11/Tensor>
-
 #include "ngraph/axis_vector.hpp"
-#include "ngraph/runtime/reference/reshape.hpp"
+#include "ngraph/runtime/generic_cpu/kernel/strided_copy.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -31,203 +28,6 @@ namespace ngraph
         {
             namespace kernel
             {
-                template <typename T>
-                void reshape_in0(const T* in,
-                                 T* out,
-                                 const Shape& in_shape,
-                                 const AxisVector& in_axis_order,
-                                 const Shape& out_shape)
-                {
-                    *out = *in;
-                }
-
-                template <typename T>
-                void reshape_in1(const T* in,
-                                 T* out,
-                                 const Shape& in_shape,
-                                 const AxisVector& in_axis_order,
-                                 const Shape& out_shape)
-                {
-                    size_t size[1];
-                    size_t in_index[1];
-                    size_t* map_index[1];
-                    for (size_t i = 0; i < 1; i++)
-                    {
-                        size[i] = in_shape[in_axis_order[i]];
-                        map_index[in_axis_order[i]] = &in_index[i];
-                    }
-                    for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
-                    {
-                        *out++ = in[*map_index[0]];
-                    }
-                }
-
-                template <typename T>
-                void reshape_in2(const T* in,
-                                 T* out,
-                                 const Shape& in_shape,
-                                 const AxisVector& in_axis_order,
-                                 const Shape& out_shape)
-                {
-                    size_t size[2];
-                    size_t in_index[2];
-                    size_t* map_index[2];
-                    for (size_t i = 0; i < 2; i++)
-                    {
-                        size[i] = in_shape[in_axis_order[i]];
-                        map_index[in_axis_order[i]] = &in_index[i];
-                    }
-                    for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
-                    {
-                        for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
-                        {
-                            *out++ = in[*map_index[0] * in_shape[1] + *map_index[1]];
-                        }
-                    }
-                }
-
-                template <typename T>
-                void reshape_in3(const T* in,
-                                 T* out,
-                                 const Shape& in_shape,
-                                 const AxisVector& in_axis_order,
-                                 const Shape& out_shape)
-                {
-                    size_t size[3];
-                    size_t in_index[3];
-                    size_t* map_index[3];
-                    for (size_t i = 0; i < 3; i++)
-                    {
-                        size[i] = in_shape[in_axis_order[i]];
-                        map_index[in_axis_order[i]] = &in_index[i];
-                    }
-                    for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
-                    {
-                        for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
-                        {
-                            for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
-                            {
-                                *out++ = in[*map_index[0] * in_shape[1] * in_shape[2] +
-                                            *map_index[1] * in_shape[2] + *map_index[2]];
-                            }
-                        }
-                    }
-                }
-
-                template <typename T>
-                void reshape_in4(const T* in,
-                                 T* out,
-                                 const Shape& in_shape,
-                                 const AxisVector& in_axis_order,
-                                 const Shape& out_shape)
-                {
-                    size_t size[4];
-                    size_t in_index[4];
-                    size_t* map_index[4];
-                    for (size_t i = 0; i < 4; i++)
-                    {
-                        size[i] = in_shape[in_axis_order[i]];
-                        map_index[in_axis_order[i]] = &in_index[i];
-                    }
-                    for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
-                    {
-                        for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
-                        {
-                            for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
-                            {
-                                for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3])
-                                {
-                                    *out++ =
-                                        in[*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] +
-                                           *map_index[1] * in_shape[2] * in_shape[3] +
-                                           *map_index[2] * in_shape[3] + *map_index[3]];
-                                }
-                            }
-                        }
-                    }
-                }
-
-                template <typename T>
-                void reshape_in5(const T* in,
-                                 T* out,
-                                 const Shape& in_shape,
-                                 const AxisVector& in_axis_order,
-                                 const Shape& out_shape)
-                {
-                    size_t size[5];
-                    size_t in_index[5];
-                    size_t* map_index[5];
-                    for (size_t i = 0; i < 5; i++)
-                    {
-                        size[i] = in_shape[in_axis_order[i]];
-                        map_index[in_axis_order[i]] = &in_index[i];
-                    }
-                    for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
-                    {
-                        for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
-                        {
-                            for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
-                            {
-                                for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3])
-                                {
-                                    for (in_index[4] = 0; in_index[4] < size[4]; ++in_index[4])
-                                    {
-                                        *out++ = in[*map_index[0] * in_shape[1] * in_shape[2] *
-                                                        in_shape[3] * in_shape[4] +
-                                                    *map_index[1] * in_shape[2] * in_shape[3] *
-                                                        in_shape[4] +
-                                                    *map_index[2] * in_shape[3] * in_shape[4] +
-                                                    *map_index[3] * in_shape[4] + *map_index[4]];
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-
-                template <typename T>
-                void reshape_in6(const T* in,
-                                 T* out,
-                                 const Shape& in_shape,
-                                 const AxisVector& in_axis_order,
-                                 const Shape& out_shape)
-                {
-                    size_t size[6];
-                    size_t in_index[6];
-                    size_t* map_index[6];
-                    for (size_t i = 0; i < 6; i++)
-                    {
-                        size[i] = in_shape[in_axis_order[i]];
-                        map_index[in_axis_order[i]] = &in_index[i];
-                    }
-                    for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
-                    {
-                        for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
-                        {
-                            for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
-                            {
-                                for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3])
-                                {
-                                    for (in_index[4] = 0; in_index[4] < size[4]; ++in_index[4])
-                                    {
-                                        for (in_index[5] = 0; in_index[5] < size[5]; ++in_index[5])
-                                        {
-                                            *out++ =
-                                                in[*map_index[0] * in_shape[1] * in_shape[2] *
-                                                       in_shape[3] * in_shape[4] * in_shape[5] +
-                                                   *map_index[1] * in_shape[2] * in_shape[3] *
-                                                       in_shape[4] * in_shape[5] +
-                                                   *map_index[2] * in_shape[3] * in_shape[4] *
-                                                       in_shape[5] +
-                                                   *map_index[3] * in_shape[4] * in_shape[5] +
-                                                   *map_index[4] * in_shape[5] + *map_index[5]];
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
                 template <typename T>
                 void reshape(const T* in,
                              T* out,
@@ -235,20 +35,17 @@ namespace ngraph
                              const AxisVector& in_axis_order,
                              const Shape& out_shape)
                 {
-                    switch (in_shape.size())
+                    // Walk the input in the permuted order, the output shape only regroups
+                    // the same row-major sequence of elements
+                    Strides in_strides = row_major_strides(in_shape);
+                    Shape shape(in_axis_order.size());
+                    Strides strides(in_axis_order.size());
+                    for (size_t i = 0; i < in_axis_order.size(); i++)
                     {
-                    case 0: reshape_in0<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                    case 1: reshape_in1<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                    case 2: reshape_in2<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                    case 3: reshape_in3<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                    case 4: reshape_in4<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                    case 5: reshape_in5<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                    case 6: reshape_in6<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                    default:
-                        NGRAPH_INFO << "reference::reshape";
-                        reference::reshape(in, out, in_shape, in_axis_order, out_shape);
-                        break;
+                        shape[i] = in_shape[in_axis_order[i]];
+                        strides[i] = in_strides[in_axis_order[i]];
                     }
+                    strided_copy(in, out, shape, strides);
                 }
             }
         }
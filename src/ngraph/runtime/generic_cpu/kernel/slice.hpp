@@ -0,0 +1,53 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/coordinate.hpp"
+#include "ngraph/runtime/generic_cpu/kernel/strided_copy.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gcpu
+        {
+            namespace kernel
+            {
+                template <typename T>
+                void slice(const T* in,
+                           T* out,
+                           const Shape& in_shape,
+                           const Coordinate& lower_bounds,
+                           const Strides& slice_strides,
+                           const Shape& out_shape)
+                {
+                    // Start at the lower corner and step over the skipped elements of each axis
+                    Strides in_strides = row_major_strides(in_shape);
+                    Strides strides(out_shape.size());
+                    size_t offset = 0;
+                    for (size_t axis = 0; axis < out_shape.size(); axis++)
+                    {
+                        offset += lower_bounds[axis] * in_strides[axis];
+                        strides[axis] = in_strides[axis] * slice_strides[axis];
+                    }
+                    strided_copy(in + offset, out, out_shape, strides);
+                }
+            }
+        }
+    }
+}
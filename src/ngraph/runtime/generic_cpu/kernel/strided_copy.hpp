@@ -0,0 +1,137 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "ngraph/runtime/generic_cpu/kernel/for_each_range.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gcpu
+        {
+            namespace kernel
+            {
+                /// \brief Fills the row-major tensor out of shape `shape` with
+                ///        out[c] = in[sum(c[i] * in_strides[i])]. A stride of zero repeats the
+                ///        input along that axis, which is how broadcast is expressed, and a
+                ///        permutation of the input strides is a transpose.
+                ///
+                ///        Adjacent axes that step through the input contiguously are merged
+                ///        first, so the innermost loop is as long as possible and is either a
+                ///        copy, a fill or a single strided gather. The output is split between
+                ///        threads in contiguous ranges.
+                template <typename T>
+                void strided_copy(const T* in,
+                                  T* out,
+                                  const Shape& shape,
+                                  const Strides& in_strides)
+                {
+                    size_t count = shape_size(shape);
+                    if (count == 0)
+                    {
+                        return;
+                    }
+
+                    std::vector<size_t> sizes;
+                    std::vector<size_t> strides;
+                    for (size_t axis = 0; axis < shape.size(); axis++)
+                    {
+                        if (shape[axis] == 1)
+                        {
+                            continue;
+                        }
+                        if (!sizes.empty() && strides.back() == in_strides[axis] * shape[axis])
+                        {
+                            sizes.back() *= shape[axis];
+                            strides.back() = in_strides[axis];
+                        }
+                        else
+                        {
+                            sizes.push_back(shape[axis]);
+                            strides.push_back(in_strides[axis]);
+                        }
+                    }
+                    if (sizes.empty())
+                    {
+                        *out = *in;
+                        return;
+                    }
+
+                    size_t rank = sizes.size();
+                    size_t row_size = sizes.back();
+                    size_t row_stride = strides.back();
+                    for_each_range(count, [&](size_t begin, size_t end) {
+                        std::vector<size_t> index(rank);
+                        size_t in_offset = 0;
+                        size_t remainder = begin;
+                        for (size_t axis = rank; axis-- > 0;)
+                        {
+                            index[axis] = remainder % sizes[axis];
+                            remainder /= sizes[axis];
+                            in_offset += index[axis] * strides[axis];
+                        }
+
+                        size_t out_offset = begin;
+                        while (out_offset < end)
+                        {
+                            size_t n = std::min(row_size - index[rank - 1], end - out_offset);
+                            const T* src = in + in_offset;
+                            T* dst = out + out_offset;
+                            if (row_stride == 1)
+                            {
+                                std::copy(src, src + n, dst);
+                            }
+                            else if (row_stride == 0)
+                            {
+                                std::fill(dst, dst + n, *src);
+                            }
+                            else
+                            {
+                                for (size_t i = 0; i < n; i++)
+                                {
+                                    dst[i] = src[i * row_stride];
+                                }
+                            }
+                            out_offset += n;
+
+                            // Step to the start of the next row
+                            in_offset -= index[rank - 1] * row_stride;
+                            index[rank - 1] = 0;
+                            for (size_t axis = rank - 1; axis-- > 0;)
+                            {
+                                in_offset += strides[axis];
+                                if (++index[axis] < sizes[axis])
+                                {
+                                    break;
+                                }
+                                in_offset -= index[axis] * strides[axis];
+                                index[axis] = 0;
+                            }
+                        }
+                    });
+                }
+            }
+        }
+    }
+}
@@ -172,6 +172,11 @@ bool runtime::gpu::GPU_Backend::call(shared_ptr<Function> func,
     auto ctx = m_context->m_runtime_context.get();
     instance.m_runtime(instance.m_inputs.data(), instance.m_outputs.data(), ctx);
 
+    for (const shared_ptr<runtime::Tensor>& output : outputs)
+    {
+        output->mark_modified();
+    }
+
     return true;
 }
 
@@ -19,6 +19,7 @@
 #include <cuda.h>
 #include <cuda_runtime.h>
 #include <cudnn.h>
+#include <deque>
 #include <fstream>
 #include <mutex>
 #include <string>
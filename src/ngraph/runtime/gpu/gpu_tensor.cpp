@@ -68,6 +68,7 @@ runtime::gpu::GPUTensor::~GPUTensor()
 void runtime::gpu::GPUTensor::write(const void* source, size_t tensor_offset, size_t n)
 {
     CUDA_RT_SAFE_CALL(cudaMemcpy(m_allocated_buffer_pool, source, n, cudaMemcpyHostToDevice));
+    mark_modified();
 }
 
 void runtime::gpu::GPUTensor::read(void* target, size_t tensor_offset, size_t n) const
@@ -58,6 +58,7 @@ op::gpu::Rnn::Rnn(std::shared_ptr<Node> src_layer,
     , m_direction(direction)
     , m_num_fused_layers(num_fused_layers)
 {
+    set_output_size(3);
     NGRAPH_ASSERT(src_layer->get_shape().size() == 2) << "src_layer doesnt have a rank 2";
 
     m_batch_size = static_cast<int>(src_layer->get_shape()[0] / num_timesteps);
@@ -75,7 +76,6 @@ op::gpu::Rnn::Rnn(std::shared_ptr<Node> src_layer,
         }
     }
 
-    set_output_size(3);
     set_output_type(0,
                     src_layer->get_element_type(),
                     Shape{static_cast<unsigned long>(m_direction * m_num_timesteps * m_batch_size),
@@ -106,6 +106,7 @@ void runtime::HostTensor::write(const void* source, size_t tensor_offset, size_t
     }
     char* target = get_data_ptr();
     memcpy(&target[tensor_offset], source, n);
+    mark_modified();
 }
 
 void runtime::HostTensor::read(void* target, size_t tensor_offset, size_t n) const
@@ -0,0 +1,166 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <unordered_map>
+
+#include "ngraph/runtime/hybrid/cost_model.hpp"
+#include "ngraph/shape_util.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+static size_t output_element_count(const Node& node)
+{
+    size_t count = 0;
+    for (size_t i = 0; i < node.get_output_size(); i++)
+    {
+        count += shape_size(node.get_output_shape(i));
+    }
+    return count;
+}
+
+runtime::hybrid::CostModel::CostModel(size_t backend_count)
+    : m_default_op_costs(backend_count, 0.001)
+    , m_op_costs(backend_count)
+    , m_measurements(backend_count)
+{
+}
+
+void runtime::hybrid::CostModel::set_op_cost(size_t placement,
+                                             const string& op_name,
+                                             double cost_per_element)
+{
+    m_op_costs.at(placement)[op_name] = cost_per_element;
+}
+
+void runtime::hybrid::CostModel::set_default_op_cost(size_t placement, double cost_per_element)
+{
+    m_default_op_costs.at(placement) = cost_per_element;
+}
+
+void runtime::hybrid::CostModel::set_transfer_cost(double latency, double cost_per_byte)
+{
+    m_transfer_latency = latency;
+    m_transfer_cost_per_byte = cost_per_byte;
+}
+
+void runtime::hybrid::CostModel::add_performance_data(
+    size_t placement,
+    const shared_ptr<Function>& func,
+    const vector<PerformanceCounter>& performance_data)
+{
+    // Performance counters are keyed by node name
+    unordered_map<string, shared_ptr<Node>> nodes;
+    for (const shared_ptr<Node>& node : func->get_ops())
+    {
+        nodes[node->get_name()] = node;
+    }
+
+    map<string, Measurement>& measurements = m_measurements.at(placement);
+    for (const PerformanceCounter& counter : performance_data)
+    {
+        auto it = nodes.find(counter.name());
+        if (it == nodes.end() || counter.call_count() == 0)
+        {
+            continue;
+        }
+        // Totals rather than the integer per-call average, which is zero for fast ops
+        Measurement& measurement = measurements[it->second->description()];
+        measurement.m_microseconds += static_cast<double>(counter.total_microseconds());
+        measurement.m_elements += static_cast<double>(output_element_count(*it->second)) *
+                                  static_cast<double>(counter.call_count());
+    }
+}
+
+double runtime::hybrid::CostModel::get_op_cost(const Node& node, size_t placement) const
+{
+    if (node.is_parameter() || node.is_constant())
+    {
+        return 0;
+    }
+
+    double cost_per_element = m_default_op_costs.at(placement);
+    const map<string, double>& op_costs = m_op_costs.at(placement);
+    const map<string, Measurement>& measurements = m_measurements.at(placement);
+    auto op_cost = op_costs.find(node.description());
+    auto measurement = measurements.find(node.description());
+    if (op_cost != op_costs.end())
+    {
+        cost_per_element = op_cost->second;
+    }
+    else if (measurement != measurements.end() && measurement->second.m_elements > 0)
+    {
+        cost_per_element = measurement->second.m_microseconds / measurement->second.m_elements;
+    }
+    return cost_per_element * output_element_count(node);
+}
+
+double runtime::hybrid::CostModel::get_transfer_cost(const descriptor::Tensor& tensor) const
+{
+    size_t bytes = shape_size(tensor.get_shape()) * tensor.get_element_type().size();
+    return m_transfer_latency + m_transfer_cost_per_byte * bytes;
+}
+
+runtime::hybrid::CostModel::Estimate
+    runtime::hybrid::CostModel::estimate(const Function& func) const
+{
+    Estimate estimate;
+    estimate.m_backend_costs.resize(get_backend_count(), 0);
+    estimate.m_backend_node_counts.resize(get_backend_count(), 0);
+
+    auto add_boundary = [&](const descriptor::Tensor& tensor) {
+        estimate.m_boundary_count++;
+        estimate.m_transfer_cost += get_transfer_cost(tensor);
+    };
+
+    for (const shared_ptr<Node>& node : func.get_ops())
+    {
+        size_t placement = node->get_placement_index();
+        estimate.m_backend_costs.at(placement) += get_op_cost(*node, placement);
+        estimate.m_backend_node_counts.at(placement)++;
+        for (const descriptor::Input& input : node->get_inputs())
+        {
+            if (input.get_output().get_node()->get_placement_index() != placement)
+            {
+                add_boundary(input.get_tensor());
+            }
+        }
+        if ((node->is_parameter() || node->is_output()) && placement != 0)
+        {
+            add_boundary(node->get_output_tensor(0));
+        }
+    }
+
+    estimate.m_total_cost = estimate.m_transfer_cost;
+    for (double cost : estimate.m_backend_costs)
+    {
+        estimate.m_total_cost += cost;
+    }
+    return estimate;
+}
+
+ostream& runtime::hybrid::operator<<(ostream& out, const CostModel::Estimate& estimate)
+{
+    for (size_t i = 0; i < estimate.m_backend_costs.size(); i++)
+    {
+        out << "backend " << i << ": " << estimate.m_backend_node_counts[i] << " nodes, "
+            << estimate.m_backend_costs[i] << "us\n";
+    }
+    out << estimate.m_boundary_count << " boundary tensors, " << estimate.m_transfer_cost
+        << "us\n";
+    out << "total " << estimate.m_total_cost << "us";
+    return out;
+}
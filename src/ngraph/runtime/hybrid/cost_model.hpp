@@ -0,0 +1,104 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/performance_counter.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace hybrid
+        {
+            class CostModel;
+        }
+    }
+}
+
+/// \brief Estimates, in microseconds, how long an op takes on each backend of a HybridBackend
+///        and how long it takes to move a tensor between two backends. Op costs are per
+///        output element and come from a table, which can be filled in by hand or learned
+///        from the performance data of a function that ran on a backend.
+class ngraph::runtime::hybrid::CostModel
+{
+public:
+    /// \brief Estimated cost of each backend, of the tensors crossing backends and in total
+    struct Estimate
+    {
+        std::vector<double> m_backend_costs;
+        std::vector<size_t> m_backend_node_counts;
+        size_t m_boundary_count = 0;
+        double m_transfer_cost = 0;
+        double m_total_cost = 0;
+    };
+
+    /// \brief Every op costs the same on every backend until told otherwise, so placement
+    ///        is driven by the number and size of tensors that cross backends.
+    CostModel(size_t backend_count);
+
+    void set_op_cost(size_t placement, const std::string& op_name, double cost_per_element);
+    void set_default_op_cost(size_t placement, double cost_per_element);
+
+    /// \brief Moving a tensor between two backends costs latency + bytes * cost_per_byte
+    void set_transfer_cost(double latency, double cost_per_byte);
+
+    /// \brief Learns the per element cost of each op type in func from performance data
+    ///        collected on the backend at `placement`. Repeated calls accumulate.
+    void add_performance_data(size_t placement,
+                              const std::shared_ptr<Function>& func,
+                              const std::vector<PerformanceCounter>& performance_data);
+
+    size_t get_backend_count() const { return m_default_op_costs.size(); }
+    double get_op_cost(const Node& node, size_t placement) const;
+    double get_transfer_cost(const descriptor::Tensor& tensor) const;
+
+    /// \brief Cost of func with the placement currently assigned to its nodes. Function
+    ///        inputs and outputs count as living on backend 0, where HybridBackend creates
+    ///        the caller's tensors.
+    Estimate estimate(const Function& func) const;
+
+private:
+    struct Measurement
+    {
+        double m_microseconds = 0;
+        double m_elements = 0;
+    };
+
+    std::vector<double> m_default_op_costs;
+    std::vector<std::map<std::string, double>> m_op_costs;
+    std::vector<std::map<std::string, Measurement>> m_measurements;
+    double m_transfer_latency = 10;
+    double m_transfer_cost_per_byte = 0.001;
+};
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace hybrid
+        {
+            std::ostream& operator<<(std::ostream& out, const CostModel::Estimate& estimate);
+        }
+    }
+}
@@ -15,6 +15,8 @@
 //*****************************************************************************
 
 #include "ngraph/runtime/hybrid/hybrid_backend.hpp"
+#include <future>
+#include <unordered_set>
 #include "ngraph/graph_util.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
@@ -33,6 +35,7 @@ using namespace std;
 runtime::hybrid::HybridBackend::HybridBackend(
     const std::vector<std::shared_ptr<runtime::Backend>>& backend_list)
     : m_backend_list{backend_list}
+    , m_cost_model{backend_list.size()}
 {
 }
 
@@ -67,12 +70,13 @@ runtime::Handle runtime::hybrid::HybridBackend::compile(shared_ptr<Function> fun
     if (m_function_map.find(func) == m_function_map.end())
     {
         // Clone function
-        FunctionInstance instance;
+        FunctionInstance& instance = m_function_map[func];
         instance.m_function = clone_function(*func);
 
         // Run placement pass
         ngraph::pass::Manager pass_manager;
-        pass_manager.register_pass<runtime::hybrid::pass::AssignPlacement>(m_backend_list);
+        pass_manager.register_pass<runtime::hybrid::pass::AssignPlacement>(m_backend_list,
+                                                                             m_cost_model);
         pass_manager.register_pass<runtime::hybrid::pass::FixGetOutputElement>();
         pass_manager.register_pass<runtime::hybrid::pass::Liveness>();
         pass_manager.register_pass<runtime::hybrid::pass::Dump>("graph.dump");
@@ -86,7 +90,8 @@ runtime::Handle runtime::hybrid::HybridBackend::compile(shared_ptr<Function> fun
         // Split function to sub_functions
         tie(instance.m_sub_functions, instance.m_map_parameter_to_result) =
             runtime::hybrid::split_function_by_placement(instance.m_function);
-        m_function_map.insert({func, instance});
+
+        vector<bool> cached = mark_cacheable(instance);
 
         // Compile subfunctions in corresponding backends
         size_t subfunction_number = 0;
@@ -111,117 +116,418 @@ runtime::Handle runtime::hybrid::HybridBackend::compile(shared_ptr<Function> fun
                 op->set_placement_index(placement);
             }
         }
+
+        build_plan(instance, cached);
+        add_tensor_set(instance);
     }
 
     return func;
 }
 
+vector<bool> runtime::hybrid::HybridBackend::mark_cacheable(FunctionInstance& instance)
+{
+    // A sub-function is cached when it only computes values of constants and cacheable
+    // parameters and writes no output of the function. Its results then keep their versions
+    // while it is skipped, so the parameters they feed are cacheable for the consumer's
+    // backend as well.
+    const ResultVector& function_results = instance.m_function->get_results();
+    unordered_set<shared_ptr<Node>> outputs(function_results.begin(), function_results.end());
+    unordered_set<shared_ptr<Node>> cached_results;
+    vector<bool> cached;
+    for (const shared_ptr<Function>& sub_function : instance.m_sub_functions)
+    {
+        bool is_cached = true;
+        for (const shared_ptr<op::Parameter>& parameter : sub_function->get_parameters())
+        {
+            auto it = instance.m_map_parameter_to_result.find(parameter);
+            if (it == instance.m_map_parameter_to_result.end())
+            {
+                is_cached = is_cached && parameter->get_cacheable();
+            }
+            else if (cached_results.count(it->second) != 0)
+            {
+                parameter->set_cacheable(true);
+            }
+            else
+            {
+                is_cached = false;
+            }
+        }
+        for (const shared_ptr<Node>& op : sub_function->get_ops())
+        {
+            is_cached = is_cached && is_reusable(*op) && outputs.count(op) == 0;
+        }
+        if (is_cached)
+        {
+            const ResultVector& results = sub_function->get_results();
+            cached_results.insert(results.begin(), results.end());
+        }
+        cached.push_back(is_cached);
+    }
+    return cached;
+}
+
+void runtime::hybrid::HybridBackend::build_plan(FunctionInstance& instance,
+                                                const vector<bool>& cached)
+{
+    unordered_map<shared_ptr<Node>, size_t> input_index;
+    const ParameterVector& function_parameters = instance.m_function->get_parameters();
+    for (size_t i = 0; i < function_parameters.size(); i++)
+    {
+        input_index[function_parameters[i]] = i;
+        if (function_parameters[i]->get_cacheable())
+        {
+            instance.m_cacheable_inputs.push_back(i);
+        }
+    }
+    unordered_map<shared_ptr<Node>, size_t> output_index;
+    const ResultVector& function_results = instance.m_function->get_results();
+    for (size_t i = 0; i < function_results.size(); i++)
+    {
+        output_index[function_results[i]] = i;
+    }
+
+    // The sub-functions are in topological order, so every boundary result is seen before
+    // the parameter it feeds
+    unordered_map<shared_ptr<Node>, pair<size_t, size_t>> producers;
+    for (size_t i = 0; i < instance.m_sub_functions.size(); i++)
+    {
+        SubFunction sub;
+        sub.m_function = instance.m_sub_functions[i];
+        sub.m_placement = runtime::hybrid::get_colocated_function_placement(sub.m_function);
+        sub.m_wave = 0;
+        sub.m_cached = cached[i];
+
+        const ParameterVector& parameters = sub.m_function->get_parameters();
+        for (size_t j = 0; j < parameters.size(); j++)
+        {
+            auto it = input_index.find(parameters[j]);
+            if (it != input_index.end())
+            {
+                sub.m_parameters.push_back({Slot::Kind::Input, it->second});
+                continue;
+            }
+
+            auto producer = producers.at(instance.m_map_parameter_to_result.at(parameters[j]));
+            SubFunction& producer_sub = instance.m_plan[producer.first];
+            Boundary boundary;
+            boundary.m_producer = producer.first;
+            boundary.m_result = producer.second;
+            boundary.m_consumer = i;
+            boundary.m_parameter = j;
+            boundary.m_copy =
+                producer_sub.m_placement != sub.m_placement &&
+                !(m_backend_list[producer_sub.m_placement]->is_supported_property(
+                      Property::memory_attach) &&
+                  m_backend_list[sub.m_placement]->is_supported_property(Property::memory_attach));
+
+            producer_sub.m_results[producer.second].m_index = instance.m_boundaries.size();
+            sub.m_parameters.push_back({Slot::Kind::Boundary, instance.m_boundaries.size()});
+            sub.m_wave = max(sub.m_wave, producer_sub.m_wave + 1);
+            instance.m_boundaries.push_back(boundary);
+        }
+
+        const ResultVector& results = sub.m_function->get_results();
+        for (size_t j = 0; j < results.size(); j++)
+        {
+            auto it = output_index.find(results[j]);
+            if (it != output_index.end())
+            {
+                sub.m_results.push_back({Slot::Kind::Output, it->second});
+            }
+            else
+            {
+                // The boundary index is filled in when the consumer is reached
+                producers[results[j]] = {i, j};
+                sub.m_results.push_back({Slot::Kind::Boundary, 0});
+            }
+        }
+
+        if (instance.m_waves.size() <= sub.m_wave)
+        {
+            instance.m_waves.resize(sub.m_wave + 1,
+                                    vector<vector<size_t>>(m_backend_list.size()));
+        }
+        instance.m_waves[sub.m_wave][sub.m_placement].push_back(i);
+        instance.m_plan.push_back(sub);
+    }
+}
+
+void runtime::hybrid::HybridBackend::add_tensor_set(FunctionInstance& instance)
+{
+    instance.m_tensor_sets.emplace_back();
+    TensorSet& tensor_set = instance.m_tensor_sets.back();
+    for (const SubFunction& sub : instance.m_plan)
+    {
+        tensor_set.m_parameters.emplace_back(sub.m_parameters.size());
+        tensor_set.m_staging_parameters.emplace_back(sub.m_parameters.size());
+        tensor_set.m_results.emplace_back(sub.m_results.size());
+        tensor_set.m_staging_results.emplace_back(sub.m_results.size());
+    }
+
+    for (const Boundary& boundary : instance.m_boundaries)
+    {
+        const SubFunction& producer = instance.m_plan[boundary.m_producer];
+        const SubFunction& consumer = instance.m_plan[boundary.m_consumer];
+        auto result_node = producer.m_function->get_results()[boundary.m_result];
+        const element::Type& element_type = result_node->get_element_type();
+        const Shape& shape = result_node->get_shape();
+        auto producer_backend = m_backend_list[producer.m_placement];
+        auto consumer_backend = m_backend_list[consumer.m_placement];
+
+        shared_ptr<runtime::Tensor> produced;
+        shared_ptr<runtime::Tensor> consumed;
+        if (producer.m_placement == consumer.m_placement)
+        {
+            produced = producer_backend->create_tensor(element_type, shape);
+            consumed = produced;
+        }
+        else if (!boundary.m_copy)
+        {
+            // Both backends work on host memory, so they can share a single buffer
+            auto buffer = make_shared<AlignedBuffer>(shape_size(shape) * element_type.size(),
+                                                     get_alignment());
+            tensor_set.m_buffers.push_back(buffer);
+            produced = producer_backend->create_tensor(element_type, shape, buffer->get_ptr());
+            consumed = consumer_backend->create_tensor(element_type, shape, buffer->get_ptr());
+        }
+        else
+        {
+            produced = producer_backend->create_tensor(element_type, shape);
+            consumed = consumer_backend->create_tensor(element_type, shape);
+        }
+        tensor_set.m_results[boundary.m_producer][boundary.m_result] = produced;
+        tensor_set.m_parameters[boundary.m_consumer][boundary.m_parameter] = consumed;
+    }
+}
+
 bool runtime::hybrid::HybridBackend::call(shared_ptr<Function> func,
                                           const vector<shared_ptr<runtime::Tensor>>& outputs,
                                           const vector<shared_ptr<runtime::Tensor>>& inputs)
 {
-    // Get FunctionInstance
-    bool rc = true;
-
-    using node_map_t = unordered_map<shared_ptr<Node>, shared_ptr<runtime::Tensor>>;
+    return call_pipelined(func, {outputs}, {inputs});
+}
 
+bool runtime::hybrid::HybridBackend::call_pipelined(
+    shared_ptr<Function> func,
+    const vector<vector<shared_ptr<runtime::Tensor>>>& outputs,
+    const vector<vector<shared_ptr<runtime::Tensor>>>& inputs)
+{
     auto fit = m_function_map.find(func);
     if (fit == m_function_map.end())
     {
         throw runtime_error("compile() must be called before call().");
     }
     FunctionInstance& instance = fit->second;
-
-    // Parameter and result node in sub_function maps to one Tensor
-    node_map_t map_node_to_tensor;
-    for (size_t i = 0; i < inputs.size(); ++i)
+    if (outputs.size() != inputs.size())
     {
-        map_node_to_tensor[instance.m_function->get_parameters()[i]] = inputs[i];
+        throw ngraph_error("call_pipelined() needs one list of outputs per list of inputs");
     }
-    for (size_t i = 0; i < outputs.size(); ++i)
+    size_t requests = inputs.size();
+    size_t waves = instance.m_waves.size();
+    if (requests == 0)
     {
-        map_node_to_tensor[instance.m_function->get_results()[i]] = outputs[i];
+        return true;
     }
 
-    // Call subfunctions
-    for (const shared_ptr<Function>& sub_function : instance.m_sub_functions)
+    // Request r runs wave t - r at step t, so at most one request per wave is in flight and
+    // a tensor set is free again once the request using it has run its last wave
+    size_t set_count = min(requests, waves);
+    while (instance.m_tensor_sets.size() < set_count)
     {
-        // Init backend
-        size_t placement = runtime::hybrid::get_colocated_function_placement(sub_function);
-        auto backend = m_backend_list[placement];
+        add_tensor_set(instance);
+    }
 
-        // Prepare parameter Tensors
-        vector<shared_ptr<runtime::Tensor>> parameters;
-        for (const shared_ptr<op::Parameter>& parameter_node : sub_function->get_parameters())
+    for (size_t step = 0; step + 1 < requests + waves; step++)
+    {
+        size_t first = step < waves ? 0 : step - waves + 1;
+        size_t last = min(step + 1, requests);
+        if (step < requests)
         {
-            auto it = map_node_to_tensor.find(parameter_node);
-            if (it != map_node_to_tensor.end())
+            bind(instance, instance.m_tensor_sets[step % set_count], outputs[step], inputs[step]);
+        }
+
+        // A backend runs its share of the step in request order
+        auto run_placement = [&](size_t placement) {
+            for (size_t request = first; request < last; request++)
             {
-                if (it->second->get_parent() == backend.get())
+                for (size_t index : instance.m_waves[step - request][placement])
                 {
-                    parameters.push_back(it->second);
-                }
-                else
-                {
-                    auto parameter = backend->create_tensor(parameter_node->get_element_type(),
-                                                            parameter_node->get_shape());
-                    parameter->copy_from(*(it->second));
-                    parameters.push_back(parameter);
+                    run_sub_function(instance,
+                                     index,
+                                     instance.m_tensor_sets[request % set_count],
+                                     outputs[request],
+                                     inputs[request]);
                 }
             }
-            else
+        };
+        vector<size_t> busy;
+        for (size_t placement = 0; placement < m_backend_list.size(); placement++)
+        {
+            for (size_t request = first; request < last; request++)
             {
-                // Handle temporary tensors that go between subgraphs
-                auto result_node = instance.m_map_parameter_to_result.at(parameter_node);
-                auto result = map_node_to_tensor.at(result_node);
-                auto parameter = backend->create_tensor(parameter_node->get_element_type(),
-                                                        parameter_node->get_shape());
-                parameter->copy_from(*result);
-                map_node_to_tensor[parameter_node] = parameter;
-                parameters.push_back(parameter);
+                if (!instance.m_waves[step - request][placement].empty())
+                {
+                    busy.push_back(placement);
+                    break;
+                }
             }
         }
 
-        // Prepare result Tensors
-        vector<shared_ptr<runtime::Tensor>> results;
-        map<runtime::Tensor*, runtime::Tensor*> copy_back;
-        for (const shared_ptr<op::Result>& result_node : sub_function->get_results())
+        // Kernels split their loops on the shared thread pool, so different backends run
+        // on threads of their own, and the calling thread takes the first one
+        vector<future<void>> others;
+        for (size_t i = 1; i < busy.size(); i++)
+        {
+            others.push_back(async(launch::async, run_placement, busy[i]));
+        }
+        if (!busy.empty())
+        {
+            run_placement(busy[0]);
+        }
+        for (future<void>& other : others)
+        {
+            other.get();
+        }
+
+        // The oldest request in flight has now run its last wave
+        if (step + 1 >= waves)
+        {
+            instance.m_tensor_sets[(step + 1 - waves) % set_count].m_cache_valid = true;
+        }
+    }
+    for (const vector<shared_ptr<runtime::Tensor>>& request_outputs : outputs)
+    {
+        for (const shared_ptr<runtime::Tensor>& output : request_outputs)
+        {
+            output->mark_modified();
+        }
+    }
+    return true;
+}
+
+void runtime::hybrid::HybridBackend::bind(FunctionInstance& instance,
+                                          TensorSet& tensor_set,
+                                          const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                          const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    // Cached sub-functions are skipped while every cacheable input is bound to the same
+    // tensor, at the same version, as when they last ran with this tensor set
+    tensor_set.m_cache_keys.resize(instance.m_cacheable_inputs.size());
+    tensor_set.m_use_cache = tensor_set.m_cache_valid;
+    for (size_t i = 0; i < instance.m_cacheable_inputs.size(); i++)
+    {
+        const shared_ptr<runtime::Tensor>& tensor = inputs.at(instance.m_cacheable_inputs[i]);
+        pair<weak_ptr<runtime::Tensor>, uint64_t>& key = tensor_set.m_cache_keys[i];
+        if (key.first.lock() != tensor || key.second != tensor->get_version())
+        {
+            tensor_set.m_use_cache = false;
+            key = {tensor, tensor->get_version()};
+        }
+    }
+    tensor_set.m_cache_valid = false;
+
+    for (size_t i = 0; i < instance.m_plan.size(); i++)
+    {
+        const SubFunction& sub = instance.m_plan[i];
+        auto backend = m_backend_list[sub.m_placement];
+
+        // Tensors that live on another backend go through a staging tensor that is kept for
+        // later calls
+        for (size_t j = 0; j < sub.m_parameters.size(); j++)
         {
-            auto it = map_node_to_tensor.find(result_node);
-            if (it != map_node_to_tensor.end())
+            if (sub.m_parameters[j].m_kind == Slot::Kind::Input)
             {
-                if (it->second->get_parent() == backend.get())
+                const shared_ptr<runtime::Tensor>& input = inputs.at(sub.m_parameters[j].m_index);
+                shared_ptr<runtime::Tensor>& staging = tensor_set.m_staging_parameters[i][j];
+                if (input->get_parent() == backend.get())
                 {
-                    results.push_back(it->second);
+                    tensor_set.m_parameters[i][j] = input;
                 }
                 else
                 {
-                    auto result = backend->create_tensor(result_node->get_element_type(),
-                                                         result_node->get_shape());
-                    results.push_back(result);
-                    copy_back.insert({result.get(), it->second.get()});
+                    if (!staging)
+                    {
+                        auto parameter_node = sub.m_function->get_parameters()[j];
+                        staging = backend->create_tensor(parameter_node->get_element_type(),
+                                                         parameter_node->get_shape());
+                    }
+                    tensor_set.m_parameters[i][j] = staging;
                 }
             }
-            else
+        }
+        for (size_t j = 0; j < sub.m_results.size(); j++)
+        {
+            if (sub.m_results[j].m_kind == Slot::Kind::Output)
             {
-                // Handle temporary tensors that go between subgraphs
-                auto result = backend->create_tensor(result_node->get_element_type(),
-                                                     result_node->get_shape());
-                map_node_to_tensor[result_node] = result;
-                results.push_back(result);
+                const shared_ptr<runtime::Tensor>& output = outputs.at(sub.m_results[j].m_index);
+                shared_ptr<runtime::Tensor>& staging = tensor_set.m_staging_results[i][j];
+                if (output->get_parent() == backend.get())
+                {
+                    tensor_set.m_results[i][j] = output;
+                }
+                else
+                {
+                    if (!staging)
+                    {
+                        auto result_node = sub.m_function->get_results()[j];
+                        staging = backend->create_tensor(result_node->get_element_type(),
+                                                         result_node->get_shape());
+                    }
+                    tensor_set.m_results[i][j] = staging;
+                }
             }
         }
+    }
+}
+
+void runtime::hybrid::HybridBackend::run_sub_function(
+    FunctionInstance& instance,
+    size_t index,
+    TensorSet& tensor_set,
+    const vector<shared_ptr<runtime::Tensor>>& outputs,
+    const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    const SubFunction& sub = instance.m_plan[index];
+    vector<shared_ptr<runtime::Tensor>>& parameters = tensor_set.m_parameters[index];
+    vector<shared_ptr<runtime::Tensor>>& results = tensor_set.m_results[index];
+    if (tensor_set.m_use_cache && sub.m_cached)
+    {
+        return;
+    }
+
+    // Copies of unchanged cacheable values are skipped too, so that the backend sees the
+    // same versions and can reuse what it derived from them
+    for (size_t j = 0; j < sub.m_parameters.size(); j++)
+    {
+        const Slot& slot = sub.m_parameters[j];
+        bool unchanged =
+            tensor_set.m_use_cache && sub.m_function->get_parameters()[j]->get_cacheable();
+        if (slot.m_kind == Slot::Kind::Input && parameters[j] != inputs[slot.m_index] &&
+            !unchanged)
+        {
+            parameters[j]->copy_from(*inputs[slot.m_index]);
+        }
+        else if (slot.m_kind == Slot::Kind::Boundary &&
+                 instance.m_boundaries[slot.m_index].m_copy && !unchanged)
+        {
+            const Boundary& boundary = instance.m_boundaries[slot.m_index];
+            parameters[j]->copy_from(
+                *tensor_set.m_results[boundary.m_producer][boundary.m_result]);
+        }
+    }
 
-        // Call
-        backend->call(sub_function, results, parameters);
+    m_backend_list[sub.m_placement]->call(sub.m_function, results, parameters);
 
-        // Need to copy any results to the correct device
-        for (const auto& p : copy_back)
+    // Need to copy any results to the correct device
+    for (size_t j = 0; j < sub.m_results.size(); j++)
+    {
+        const Slot& slot = sub.m_results[j];
+        if (slot.m_kind == Slot::Kind::Output && results[j] != outputs[slot.m_index])
         {
-            p.second->copy_from(*p.first);
+            outputs[slot.m_index]->copy_from(*results[j]);
         }
     }
-    return rc;
 }
 
 bool runtime::hybrid::HybridBackend::is_supported(const Node& node) const
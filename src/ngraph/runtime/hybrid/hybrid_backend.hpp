@@ -19,9 +19,12 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/hybrid/cost_model.hpp"
 
 namespace ngraph
 {
@@ -54,10 +57,78 @@ public:
               const std::vector<std::shared_ptr<ngraph::runtime::Tensor>>& outputs,
               const std::vector<std::shared_ptr<ngraph::runtime::Tensor>>& inputs) override;
 
+    /// \brief Runs func once for each entry of outputs and inputs. The requests are
+    ///        pipelined: while one backend works on a sub-function of request N, the other
+    ///        backends may already work on request N + 1.
+    bool call_pipelined(
+        std::shared_ptr<ngraph::Function> func,
+        const std::vector<std::vector<std::shared_ptr<ngraph::runtime::Tensor>>>& outputs,
+        const std::vector<std::vector<std::shared_ptr<ngraph::runtime::Tensor>>>& inputs);
+
     bool is_supported(const ngraph::Node& node) const override;
 
     void set_debug_enabled(bool flag) { m_debug_enabled = flag; }
+    /// \brief Sets the cost model used to place the functions compiled from now on
+    void set_cost_model(const CostModel& cost_model) { m_cost_model = cost_model; }
 private:
+    /// \brief Where a sub-function parameter or result gets its tensor from: the m_index'th
+    /// input or output of the whole function, or the m_index'th boundary
+    struct Slot
+    {
+        enum class Kind
+        {
+            Input,
+            Output,
+            Boundary
+        };
+        Kind m_kind;
+        size_t m_index;
+    };
+
+    /// \brief Result m_result of sub-function m_producer feeds parameter m_parameter of
+    /// sub-function m_consumer. m_copy is set when the two sides cannot share memory.
+    struct Boundary
+    {
+        size_t m_producer;
+        size_t m_result;
+        size_t m_consumer;
+        size_t m_parameter;
+        bool m_copy;
+    };
+
+    struct SubFunction
+    {
+        std::shared_ptr<ngraph::Function> m_function;
+        size_t m_placement;
+        // Sub-functions of the same wave do not depend on each other
+        size_t m_wave;
+        std::vector<Slot> m_parameters;
+        std::vector<Slot> m_results;
+        // Only computes values of constants and cacheable parameters, and is skipped while
+        // those are unchanged
+        bool m_cached;
+    };
+
+    /// \brief The tensors used by one request in flight, indexed by sub-function and
+    /// parameter or result. Boundary tensors are created at compile time; the entries for
+    /// function inputs and outputs are filled in by each call, pointing either at the
+    /// caller's tensor or at a staging tensor on the sub-function's backend.
+    class TensorSet
+    {
+    public:
+        std::vector<std::vector<std::shared_ptr<ngraph::runtime::Tensor>>> m_parameters;
+        std::vector<std::vector<std::shared_ptr<ngraph::runtime::Tensor>>> m_results;
+        std::vector<std::vector<std::shared_ptr<ngraph::runtime::Tensor>>> m_staging_parameters;
+        std::vector<std::vector<std::shared_ptr<ngraph::runtime::Tensor>>> m_staging_results;
+        // Host memory shared by boundaries whose backends both attach memory
+        std::vector<std::shared_ptr<AlignedBuffer>> m_buffers;
+        // The tensor and version bound to each cacheable input when the cached sub-functions
+        // last ran with this set
+        std::vector<std::pair<std::weak_ptr<ngraph::runtime::Tensor>, uint64_t>> m_cache_keys;
+        bool m_cache_valid = false;
+        bool m_use_cache = false;
+    };
+
     class FunctionInstance
     {
     public:
@@ -66,11 +137,33 @@ private:
         std::unordered_map<std::shared_ptr<ngraph::op::Parameter>,
                            std::shared_ptr<ngraph::op::Result>>
             m_map_parameter_to_result;
+        std::vector<SubFunction> m_plan;
+        std::vector<Boundary> m_boundaries;
+        // m_waves[wave][placement] lists the sub-functions to run
+        std::vector<std::vector<std::vector<size_t>>> m_waves;
+        std::vector<TensorSet> m_tensor_sets;
+        // Indices of the function inputs bound to cacheable parameters
+        std::vector<size_t> m_cacheable_inputs;
     };
 
     std::map<std::shared_ptr<ngraph::Function>, FunctionInstance> m_function_map;
     std::vector<std::shared_ptr<runtime::Backend>> m_backend_list;
     bool m_debug_enabled = false;
+    CostModel m_cost_model;
 
+    size_t get_alignment() const { return 64; }
     size_t get_placement(const runtime::Tensor* t);
+
+    std::vector<bool> mark_cacheable(FunctionInstance& instance);
+    void build_plan(FunctionInstance& instance, const std::vector<bool>& cached);
+    void add_tensor_set(FunctionInstance& instance);
+    void bind(FunctionInstance& instance,
+              TensorSet& tensor_set,
+              const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+              const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+    void run_sub_function(FunctionInstance& instance,
+                          size_t index,
+                          TensorSet& tensor_set,
+                          const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                          const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
 };
@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <deque>
+
 #include "ngraph/runtime/hybrid/hybrid_util.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
@@ -14,6 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <unordered_map>
+#include <unordered_set>
+
 #include "ngraph/runtime/hybrid/pass/assign_placement.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/node.hpp"
@@ -23,23 +26,192 @@
 using namespace ngraph;
 using namespace std;
 
+// Moves that gain less than this, in microseconds, are rounding noise
+static const double s_min_gain = 1e-6;
+
+// Estimated cost of placing all of `group` on `placement`: the ops themselves plus every
+// tensor crossing between a member and a non-member placed elsewhere
+static double group_cost(const runtime::hybrid::CostModel& cost_model,
+                         const vector<Node*>& group,
+                         const unordered_set<Node*>& members,
+                         size_t placement)
+{
+    double cost = 0;
+    for (Node* node : group)
+    {
+        cost += cost_model.get_op_cost(*node, placement);
+        for (const descriptor::Input& input : node->get_inputs())
+        {
+            Node* arg = input.get_output().get_node().get();
+            if (members.count(arg) == 0 && arg->get_placement_index() != placement)
+            {
+                cost += cost_model.get_transfer_cost(input.get_tensor());
+            }
+        }
+        for (const descriptor::Output& output : node->get_outputs())
+        {
+            for (const descriptor::Input* input : output.get_inputs())
+            {
+                Node* user = input->get_node().get();
+                if (members.count(user) == 0 && user->get_placement_index() != placement)
+                {
+                    cost += cost_model.get_transfer_cost(output.get_tensor());
+                }
+            }
+        }
+        // The caller's tensors live on the first backend
+        if ((node->is_parameter() || node->is_output()) && placement != 0)
+        {
+            cost += cost_model.get_transfer_cost(node->get_output_tensor(0));
+        }
+    }
+    return cost;
+}
+
 runtime::hybrid::pass::AssignPlacement::AssignPlacement(
     const vector<shared_ptr<runtime::Backend>>& placement_backends)
+    : AssignPlacement(placement_backends, CostModel(placement_backends.size()))
+{
+}
+
+runtime::hybrid::pass::AssignPlacement::AssignPlacement(
+    const vector<shared_ptr<runtime::Backend>>& placement_backends,
+    const CostModel& cost_model)
     : m_placement_backends(placement_backends)
+    , m_cost_model(cost_model)
 {
 }
 
-bool runtime::hybrid::pass::AssignPlacement::run_on_node(shared_ptr<Node> node)
+bool runtime::hybrid::pass::AssignPlacement::run_on_function(shared_ptr<Function> function)
 {
-    size_t backend_index = 0;
-    for (auto backend : m_placement_backends)
+    size_t backend_count = m_placement_backends.size();
+    vector<Node*> nodes;
+    unordered_map<Node*, vector<bool>> supported;
+    for (const shared_ptr<Node>& node : function->get_ordered_ops())
     {
-        if (backend->is_supported(*node))
+        vector<bool>& node_supported = supported[node.get()];
+        node_supported.resize(backend_count, false);
+        size_t cheapest = backend_count;
+        for (size_t i = 0; i < backend_count; i++)
+        {
+            if (m_placement_backends[i]->is_supported(*node))
+            {
+                node_supported[i] = true;
+                if (cheapest == backend_count || m_cost_model.get_op_cost(*node, i) <
+                                                     m_cost_model.get_op_cost(*node, cheapest))
+                {
+                    cheapest = i;
+                }
+            }
+        }
+        if (cheapest == backend_count)
         {
-            node->set_placement_index(backend_index);
-            return false;
+            throw runtime_error("Node " + node->get_name() + " not supported by any backend");
         }
-        backend_index++;
+        node->set_placement_index(cheapest);
+        nodes.push_back(node.get());
     }
-    throw runtime_error("Node " + node->get_name() + " not supported by any backend");
+
+    // Every move strictly lowers the estimate, so this terminates; the bound only guards
+    // against a pathological cost table
+    bool changed = true;
+    for (size_t round = 0; changed && round < nodes.size(); round++)
+    {
+        changed = false;
+
+        // Single nodes
+        for (Node* node : nodes)
+        {
+            vector<Node*> group{node};
+            unordered_set<Node*> members{node};
+            size_t current = node->get_placement_index();
+            size_t best = current;
+            double best_cost = group_cost(m_cost_model, group, members, current);
+            for (size_t i = 0; i < backend_count; i++)
+            {
+                double cost = supported[node][i]
+                                  ? group_cost(m_cost_model, group, members, i)
+                                  : best_cost;
+                if (cost + s_min_gain < best_cost)
+                {
+                    best = i;
+                    best_cost = cost;
+                }
+            }
+            if (best != current)
+            {
+                node->set_placement_index(best);
+                changed = true;
+            }
+        }
+
+        // Clusters of connected nodes on one backend, which is what becomes a sub-function
+        unordered_set<Node*> visited;
+        for (Node* root : nodes)
+        {
+            if (visited.count(root) != 0)
+            {
+                continue;
+            }
+            size_t current = root->get_placement_index();
+            vector<Node*> cluster{root};
+            unordered_set<Node*> members{root};
+            visited.insert(root);
+            for (size_t i = 0; i < cluster.size(); i++)
+            {
+                vector<Node*> neighbors;
+                for (const descriptor::Input& input : cluster[i]->get_inputs())
+                {
+                    neighbors.push_back(input.get_output().get_node().get());
+                }
+                for (const descriptor::Output& output : cluster[i]->get_outputs())
+                {
+                    for (const descriptor::Input* input : output.get_inputs())
+                    {
+                        neighbors.push_back(input->get_node().get());
+                    }
+                }
+                for (Node* neighbor : neighbors)
+                {
+                    if (neighbor->get_placement_index() == current &&
+                        members.count(neighbor) == 0)
+                    {
+                        cluster.push_back(neighbor);
+                        members.insert(neighbor);
+                        visited.insert(neighbor);
+                    }
+                }
+            }
+
+            size_t best = current;
+            double best_cost = group_cost(m_cost_model, cluster, members, current);
+            for (size_t i = 0; i < backend_count; i++)
+            {
+                bool all_supported = true;
+                for (Node* node : cluster)
+                {
+                    all_supported = all_supported && supported[node][i];
+                }
+                double cost =
+                    all_supported ? group_cost(m_cost_model, cluster, members, i) : best_cost;
+                if (cost + s_min_gain < best_cost)
+                {
+                    best = i;
+                    best_cost = cost;
+                }
+            }
+            if (best != current)
+            {
+                for (Node* node : cluster)
+                {
+                    node->set_placement_index(best);
+                }
+                changed = true;
+            }
+        }
+    }
+
+    NGRAPH_DEBUG << "Placement of " << function->get_name() << "\n"
+                 << m_cost_model.estimate(*function);
+    return false;
 }
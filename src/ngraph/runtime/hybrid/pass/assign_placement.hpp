@@ -21,6 +21,7 @@
 #include <sstream>
 
 #include "ngraph/pass/pass.hpp"
+#include "ngraph/runtime/hybrid/cost_model.hpp"
 
 namespace ngraph
 {
@@ -36,14 +37,26 @@ namespace ngraph
     }
 }
 
-class ngraph::runtime::hybrid::pass::AssignPlacement : public ngraph::pass::NodePass
+/// \brief Places every node on one of the backends that support it, minimizing the total
+///        cost estimated by a CostModel: the cost of each op on its backend plus the cost of
+///        every tensor that has to move between backends.
+///
+///        Each node starts on its cheapest backend, ties going to the earlier backend. Nodes,
+///        and then whole clusters of connected nodes sharing a backend, are moved to another
+///        backend for as long as a move lowers the estimate, which merges the tiny
+///        sub-functions that per-node choices leave behind.
+class ngraph::runtime::hybrid::pass::AssignPlacement : public ngraph::pass::FunctionPass
 {
 public:
     AssignPlacement(
         const std::vector<std::shared_ptr<ngraph::runtime::Backend>>& placement_backends);
+    AssignPlacement(
+        const std::vector<std::shared_ptr<ngraph::runtime::Backend>>& placement_backends,
+        const CostModel& cost_model);
 
-private:
-    bool run_on_node(std::shared_ptr<Node> node) override;
+    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
 
+private:
     std::vector<std::shared_ptr<ngraph::runtime::Backend>> m_placement_backends;
+    CostModel m_cost_model;
 };
@@ -1889,6 +1889,11 @@ bool runtime::intelgpu::IntelGPUBackend::call(shared_ptr<Function> func,
         remove_compiled_function(func);
     }
 
+    for (const shared_ptr<runtime::Tensor>& output : outputs)
+    {
+        output->mark_modified();
+    }
+
     return true;
 }
 
@@ -60,6 +60,7 @@ void runtime::intelgpu::IntelGPUTensorView::write(const void* source,
     auto ptr = ocl_memory->pointer<char>();
     char* target = ptr.data();
     memcpy(&target[tensor_offset], source, n);
+    mark_modified();
 }
 
 void runtime::intelgpu::IntelGPUTensorView::read(void* target, size_t tensor_offset, size_t n) const
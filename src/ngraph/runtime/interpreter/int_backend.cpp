@@ -15,14 +15,16 @@
 //*****************************************************************************
 
 #include "ngraph/runtime/interpreter/int_backend.hpp"
+#include <unordered_set>
 #include "ngraph/descriptor/layout/dense_tensor_layout.hpp"
 #include "ngraph/except.hpp"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/op/convert.hpp"
 #include "ngraph/op/select.hpp"
 #include "ngraph/op/util/binary_elementwise_comparison.hpp"
+#include "ngraph/parallel.hpp"
 #include "ngraph/pass/assign_layout.hpp"
 #include "ngraph/pass/like_replacement.hpp"
-#include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
@@ -73,72 +75,184 @@ runtime::Handle runtime::interpreter::INTBackend::compile(shared_ptr<Function> f
         pass::Manager pass_manager;
         pass_manager.register_pass<pass::LikeReplacement>();
         pass_manager.register_pass<pass::AssignLayout<DenseTensorLayout>>();
-        pass_manager.register_pass<pass::Liveness>();
-        pass_manager.register_pass<pass::MemoryLayout>(get_alignment());
         pass_manager.run_passes(function);
 
-        size_t memory_pool_size = function->get_temporary_pool_size();
-        instance.m_temporary_memory.reset(new AlignedBuffer(memory_pool_size, get_alignment()));
-
-        for (const shared_ptr<Node>& node : function->get_ordered_ops())
+        auto ordered_ops = function->get_ordered_ops_view();
+        for (const shared_ptr<Node>& node : *ordered_ops)
         {
             instance.m_wrapped_nodes.emplace_back(node);
         }
+        build_execution_plan(function, instance);
     }
 
     return function;
 }
 
-bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
-                                            const vector<shared_ptr<runtime::Tensor>>& outputs,
-                                            const vector<shared_ptr<runtime::Tensor>>& inputs)
+namespace
 {
-    auto fit = m_function_map.find(function);
-    if (fit == m_function_map.end())
+    // Where the data of a tensor lives: `offset` bytes into the temporary or cached root tensor
+    // `root`, into call()'s input or output number `index`, or into fixed memory such as a
+    // constant.
+    struct TensorLocation
     {
-        throw runtime_error("compile() must be called before call().");
+        enum class Kind
+        {
+            Temporary,
+            Cached,
+            Input,
+            Output,
+            Fixed
+        };
+
+        Kind kind;
+        descriptor::Tensor* root;
+        size_t index;
+        char* pointer;
+        size_t offset;
+    };
+}
+
+// Levels every op one past its deepest producer and reorders the schedule wave by wave, so
+// that the ops of a wave only depend on earlier waves. Returns the wave of each op.
+static vector<size_t>
+    schedule_waves(vector<const runtime::interpreter::NodeWrapper*>& schedule)
+{
+    unordered_map<const Node*, size_t> levels;
+    for (const runtime::interpreter::NodeWrapper* wrapped : schedule)
+    {
+        const Node& node = wrapped->get_node();
+        size_t level = 0;
+        for (const descriptor::Input& input : node.get_inputs())
+        {
+            auto it = levels.find(input.get_output().get_node().get());
+            if (it != levels.end())
+            {
+                level = max(level, it->second + 1);
+            }
+        }
+        levels.insert({&node, level});
     }
-    FunctionInstance& instance = fit->second;
-    if (!instance.m_is_compiled)
+    stable_sort(schedule.begin(),
+                schedule.end(),
+                [&](const runtime::interpreter::NodeWrapper* a,
+                    const runtime::interpreter::NodeWrapper* b) {
+                    return levels.at(&a->get_node()) < levels.at(&b->get_node());
+                });
+
+    vector<size_t> waves;
+    for (const runtime::interpreter::NodeWrapper* wrapped : schedule)
     {
-        throw runtime_error("compile() must be called before call().");
+        waves.push_back(levels.at(&wrapped->get_node()));
     }
+    return waves;
+}
 
-    // convert inputs to HostTensor
-    vector<void*> func_inputs;
-    vector<shared_ptr<runtime::HostTensor>> htv_inputs;
-    for (auto tensor : inputs)
+// True if a Reshape leaves the row-major layout alone, i.e. it only moves axes of length one
+static bool is_layout_preserving(const op::Reshape* reshape)
+{
+    const Shape& in_shape = reshape->get_input_shape(0);
+    size_t next_axis = 0;
+    for (size_t axis : reshape->get_input_order())
     {
-        auto host_tensor = static_pointer_cast<runtime::HostTensor>(tensor);
-        func_inputs.push_back(static_cast<void*>(host_tensor->get_data_ptr()));
-        htv_inputs.push_back(host_tensor);
+        if (in_shape[axis] != 1)
+        {
+            if (axis < next_axis)
+            {
+                return false;
+            }
+            next_axis = axis + 1;
+        }
     }
-    if (instance.m_nan_check_enabled)
+    return true;
+}
+
+// True if the output of a Slice is one contiguous block of its input; `offset` is set to the
+// element offset of that block.
+static bool is_contiguous_slice(const op::Slice* slice, size_t& offset)
+{
+    const Shape& in_shape = slice->get_input_shape(0);
+    const Coordinate& lower = slice->get_lower_bounds();
+    const Coordinate& upper = slice->get_upper_bounds();
+    for (size_t stride : slice->get_strides())
     {
-        perform_nan_check(htv_inputs);
+        if (stride != 1)
+        {
+            return false;
+        }
+    }
+
+    // Inner axes must be taken whole, then one axis may be cut anywhere, and every axis
+    // outside of that must be a single index.
+    size_t axis = in_shape.size();
+    while (axis > 0 && lower[axis - 1] == 0 && upper[axis - 1] == in_shape[axis - 1])
+    {
+        axis--;
+    }
+    for (size_t i = 0; i + 1 < axis; i++)
+    {
+        if (upper[i] - lower[i] != 1)
+        {
+            return false;
+        }
     }
 
-    // convert outputs to HostTensor
-    vector<void*> func_outputs;
-    for (auto tensor : outputs)
+    Strides strides = row_major_strides(in_shape);
+    offset = 0;
+    for (size_t i = 0; i < in_shape.size(); i++)
     {
-        auto host_tensor = static_pointer_cast<runtime::HostTensor>(tensor);
-        func_outputs.push_back(static_cast<void*>(host_tensor->get_data_ptr()));
+        offset += lower[i] * strides[i];
     }
+    return true;
+}
+
+// True if every input of a Concat is a contiguous block of its output
+static bool is_contiguous_concat(const op::Concat* concat)
+{
+    const Shape& out_shape = concat->get_output_shape(0);
+    for (size_t axis = 0; axis < concat->get_concatenation_axis(); axis++)
+    {
+        if (out_shape[axis] != 1)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void runtime::interpreter::INTBackend::build_execution_plan(shared_ptr<Function> function,
+                                                            FunctionInstance& instance)
+{
+    instance.m_instructions.clear();
+    instance.m_input_bindings.clear();
+    instance.m_output_bindings.clear();
+    instance.m_wave_starts.clear();
+    instance.m_cacheable_inputs.clear();
+    instance.m_cache_valid = false;
+
+    unordered_map<descriptor::Tensor*, TensorLocation> locations;
+
+    // Ops computed only from constants and cacheable parameters
+    unordered_set<const Node*> cacheable;
 
-    // map function params -> HostTensor
-    unordered_map<descriptor::Tensor*, void*> tensor_map;
     size_t input_count = 0;
     for (auto param : function->get_parameters())
     {
+        if (param->get_cacheable())
+        {
+            cacheable.insert(param.get());
+        }
         for (size_t i = 0; i < param->get_output_size(); ++i)
         {
+            if (param->get_cacheable())
+            {
+                instance.m_cacheable_inputs.push_back(input_count);
+            }
             descriptor::Tensor* tensor = param->get_output_tensor_ptr(i).get();
-            tensor_map.insert({tensor, func_inputs[input_count++]});
+            locations[tensor] = {TensorLocation::Kind::Input, nullptr, input_count++, nullptr, 0};
         }
     }
+    instance.m_cache_keys.assign(instance.m_cacheable_inputs.size(), {});
 
-    // map function outputs -> HostTensor
     for (size_t output_count = 0; output_count < function->get_output_size(); ++output_count)
     {
         auto output = function->get_output_op(output_count);
@@ -147,54 +261,272 @@ bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
             throw ngraph_error("One of function's outputs isn't op::Result");
         }
         descriptor::Tensor* tensor = output->get_output_tensor_ptr(0).get();
-        tensor_map.insert({tensor, func_outputs[output_count]});
+        locations[tensor] = {TensorLocation::Kind::Output, nullptr, output_count, nullptr, 0};
     }
 
-    // for each ordered op in the graph
+    vector<const NodeWrapper*> schedule;
+    unordered_map<const Node*, OP_TYPEID> type_ids;
     for (const NodeWrapper& wrapped : instance.m_wrapped_nodes)
     {
         const Node* op = &wrapped.get_node();
         auto type_id = wrapped.get_typeid();
-        if (type_id == OP_TYPEID::Parameter)
-        {
-            continue;
-        }
+        type_ids.insert({op, type_id});
         if (type_id == OP_TYPEID::Constant)
         {
             const op::Constant* c = static_cast<const op::Constant*>(op);
             descriptor::Tensor* tensor = op->get_output_tensor_ptr(0).get();
-            tensor_map.insert({tensor, const_cast<void*>(c->get_data_ptr())});
+            char* data = static_cast<char*>(const_cast<void*>(c->get_data_ptr()));
+            locations[tensor] = {TensorLocation::Kind::Fixed, nullptr, 0, data, 0};
+            cacheable.insert(op);
+        }
+        else if (type_id == OP_TYPEID::GenerateMask && instance.m_states.count(op) == 0)
+        {
+            // Created up front so that parallel waves never insert into m_states
+            const op::GenerateMask* gm = static_cast<const op::GenerateMask*>(op);
+            instance.m_states[op] = shared_ptr<RNGState>(
+                RNGState::create_rng_state(gm->get_seed(), gm->get_probability()));
+        }
+        if (type_id != OP_TYPEID::Parameter && type_id != OP_TYPEID::Constant)
+        {
+            schedule.push_back(&wrapped);
+
+            // Random and collective ops must run on every call
+            bool is_cacheable =
+                type_id != OP_TYPEID::Result && is_reusable(*op) && op->get_input_size() > 0;
+            for (const descriptor::Input& input : op->get_inputs())
+            {
+                is_cacheable =
+                    is_cacheable && cacheable.count(input.get_output().get_node().get()) != 0;
+            }
+            if (is_cacheable)
+            {
+                cacheable.insert(op);
+            }
+        }
+    }
+
+    // In sequential mode every op is a wave of its own
+    vector<size_t> waves;
+    if (instance.m_parallel_enabled)
+    {
+        waves = schedule_waves(schedule);
+    }
+    else
+    {
+        for (size_t i = 0; i < schedule.size(); i++)
+        {
+            waves.push_back(i);
+        }
+    }
+
+    // A Concat whose inputs are contiguous blocks of its output, each written by an op that
+    // feeds nothing else, is dropped; those ops write straight into the Concat's output.
+    unordered_map<descriptor::Tensor*, pair<descriptor::Tensor*, size_t>> concat_slots;
+    unordered_set<const Node*> skipped;
+    vector<descriptor::Tensor*> roots;
+    for (const NodeWrapper* wrapped : schedule)
+    {
+        const Node* op = &wrapped->get_node();
+        if (wrapped->get_typeid() != OP_TYPEID::Concat ||
+            !is_contiguous_concat(static_cast<const op::Concat*>(op)))
+        {
             continue;
         }
-        // get op inputs from map
-        vector<const void*> op_inputs;
+        bool in_place = true;
+        for (const descriptor::Input& input : op->get_inputs())
+        {
+            // Cached ops keep their outputs in memory of their own
+            if (cacheable.count(input.get_output().get_node().get()) != 0)
+            {
+                in_place = false;
+            }
+            switch (type_ids.at(input.get_output().get_node().get()))
+            {
+            case OP_TYPEID::Parameter:
+            case OP_TYPEID::Constant:
+            case OP_TYPEID::Concat:
+            case OP_TYPEID::GetOutputElement:
+            case OP_TYPEID::Reshape:
+            case OP_TYPEID::Slice: in_place = false; break;
+            default: in_place = in_place && input.get_output().get_inputs().size() == 1;
+            }
+        }
+        if (in_place)
+        {
+            descriptor::Tensor* output = op->get_output_tensor_ptr(0).get();
+            size_t offset = 0;
+            for (const descriptor::Input& input : op->get_inputs())
+            {
+                descriptor::Tensor* tensor = input.get_output().get_tensor_ptr().get();
+                concat_slots.insert({tensor, {output, offset}});
+                offset += tensor->size();
+            }
+            locations[output] = {TensorLocation::Kind::Temporary, output, 0, nullptr, 0};
+            roots.push_back(output);
+            skipped.insert(op);
+        }
+    }
+
+    // Reshapes, GetOutputElements and Slices that do not move data become views of their
+    // input. Outputs of cacheable ops get a cached root that lives as long as the plan.
+    // Everything else gets a temporary root that lives from the first wave writing it
+    // through the last wave reading any view of it.
+    unordered_map<descriptor::Tensor*, pair<size_t, size_t>> lifetimes;
+    pass::MemoryManager cached_memory(get_alignment());
+    unordered_map<descriptor::Tensor*, size_t> cached_offsets;
+    for (size_t i = 0; i < schedule.size(); i++)
+    {
+        const Node* op = &schedule[i]->get_node();
+        size_t wave = waves[i];
         for (const descriptor::Input& input : op->get_inputs())
         {
             descriptor::Tensor* tensor = input.get_output().get_tensor_ptr().get();
-            op_inputs.push_back(tensor_map.at(tensor));
+            const TensorLocation& location = locations.at(tensor);
+            if (location.kind == TensorLocation::Kind::Temporary)
+            {
+                auto& lifetime = lifetimes.at(location.root);
+                lifetime.second = max(lifetime.second, wave);
+            }
         }
 
-        // get op outputs from map or create
-        vector<void*> op_outputs;
-        vector<shared_ptr<runtime::HostTensor>> htv_outputs;
-        for (size_t i = 0; i < op->get_output_size(); ++i)
+        bool is_view = false;
+        size_t view_input = 0;
+        size_t view_offset = 0;
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wswitch-enum"
+        switch (schedule[i]->get_typeid())
+        {
+        case OP_TYPEID::GetOutputElement:
+            // Takes every output of its argument as an input and selects one of them
+            is_view = true;
+            view_input = static_cast<const op::GetOutputElement*>(op)->get_n();
+            break;
+        case OP_TYPEID::Reshape:
+            is_view = is_layout_preserving(static_cast<const op::Reshape*>(op));
+            break;
+        case OP_TYPEID::Slice:
+            is_view = is_contiguous_slice(static_cast<const op::Slice*>(op), view_offset);
+            view_offset *= op->get_output_element_type(0).size();
+            break;
+        default: break;
+        }
+#pragma GCC diagnostic pop
+        if (is_view)
         {
-            descriptor::Tensor* tensor = op->get_output_tensor_ptr(i).get();
-            void* host_tensor = nullptr;
-            auto it = tensor_map.find(tensor);
-            if (it == tensor_map.end())
+            const descriptor::Input& input = op->get_inputs().at(view_input);
+            TensorLocation location = locations.at(input.get_output().get_tensor_ptr().get());
+            location.offset += view_offset;
+            locations[op->get_output_tensor_ptr(0).get()] = location;
+            skipped.insert(op);
+            continue;
+        }
+
+        for (size_t j = 0; j < op->get_output_size(); ++j)
+        {
+            descriptor::Tensor* tensor = op->get_output_tensor_ptr(j).get();
+            auto slot = concat_slots.find(tensor);
+            if (cacheable.count(op) != 0)
+            {
+                locations[tensor] = {TensorLocation::Kind::Cached, tensor, 0, nullptr, 0};
+                cached_offsets.insert({tensor, cached_memory.allocate(tensor->size())});
+            }
+            else if (slot != concat_slots.end())
             {
-                auto offset = op->get_output_tensor(i).get_pool_offset();
-                host_tensor = instance.get_temporary_pointer(offset);
-                tensor_map.insert({tensor, host_tensor});
+                descriptor::Tensor* root = slot->second.first;
+                locations[tensor] = {
+                    TensorLocation::Kind::Temporary, root, 0, nullptr, slot->second.second};
+                auto lifetime = lifetimes.insert({root, {wave, wave}}).first;
+                lifetime->second.first = min(lifetime->second.first, wave);
             }
-            else
+            else if (locations.count(tensor) == 0)
             {
-                host_tensor = it->second;
+                locations[tensor] = {TensorLocation::Kind::Temporary, tensor, 0, nullptr, 0};
+                lifetimes.insert({tensor, {wave, wave}});
+                roots.push_back(tensor);
             }
-            op_outputs.push_back(host_tensor);
-            htv_outputs.push_back(make_shared<runtime::HostTensor>(
-                tensor->get_element_type(), tensor->get_shape(), host_tensor));
+        }
+    }
+
+    size_t wave_count = waves.empty() ? 0 : waves.back() + 1;
+    vector<vector<descriptor::Tensor*>> allocations(wave_count);
+    vector<vector<descriptor::Tensor*>> frees(wave_count);
+    for (descriptor::Tensor* root : roots)
+    {
+        const pair<size_t, size_t>& lifetime = lifetimes.at(root);
+        allocations[lifetime.first].push_back(root);
+        frees[lifetime.second].push_back(root);
+    }
+    pass::MemoryManager memory(get_alignment());
+    unordered_map<descriptor::Tensor*, size_t> pool_offsets;
+    for (size_t wave = 0; wave < wave_count; wave++)
+    {
+        for (descriptor::Tensor* root : allocations[wave])
+        {
+            pool_offsets.insert({root, memory.allocate(root->size())});
+        }
+        for (descriptor::Tensor* root : frees[wave])
+        {
+            memory.free(pool_offsets.at(root));
+        }
+    }
+    instance.m_temporary_memory.reset(new AlignedBuffer(memory.max_allocated(), get_alignment()));
+    instance.m_cached_memory.reset(
+        new AlignedBuffer(cached_memory.max_allocated(), get_alignment()));
+
+    // Resolves a tensor to a pointer, or records a binding for call() to patch
+    auto resolve = [&](descriptor::Tensor* tensor, vector<Binding>& bindings, size_t slot) {
+        const TensorLocation& location = locations.at(tensor);
+        switch (location.kind)
+        {
+        case TensorLocation::Kind::Temporary:
+            return static_cast<char*>(
+                       instance.get_temporary_pointer(pool_offsets.at(location.root))) +
+                   location.offset;
+        case TensorLocation::Kind::Cached:
+            return static_cast<char*>(
+                       instance.m_cached_memory->get_ptr(cached_offsets.at(location.root))) +
+                   location.offset;
+        case TensorLocation::Kind::Fixed: return location.pointer + location.offset;
+        case TensorLocation::Kind::Input:
+        case TensorLocation::Kind::Output:
+            bindings.push_back(
+                {instance.m_instructions.size(), slot, location.index, location.offset});
+            return static_cast<char*>(nullptr);
+        }
+        return static_cast<char*>(nullptr);
+    };
+
+    size_t last_wave = 0;
+    for (size_t i = 0; i < schedule.size(); i++)
+    {
+        const NodeWrapper* wrapped = schedule[i];
+        const Node* op = &wrapped->get_node();
+        auto type_id = wrapped->get_typeid();
+        if (skipped.count(op) != 0)
+        {
+            continue;
+        }
+        if (instance.m_parallel_enabled &&
+            (instance.m_wave_starts.empty() || waves[i] != last_wave))
+        {
+            instance.m_wave_starts.push_back(instance.m_instructions.size());
+        }
+        last_wave = waves[i];
+
+        Instruction instruction;
+        instruction.m_node = wrapped;
+        instruction.m_cached = cacheable.count(op) != 0;
+        for (const descriptor::Input& input : op->get_inputs())
+        {
+            instruction.m_inputs.push_back(resolve(input.get_output().get_tensor_ptr().get(),
+                                                   instance.m_input_bindings,
+                                                   instruction.m_inputs.size()));
+        }
+        for (size_t j = 0; j < op->get_output_size(); ++j)
+        {
+            instruction.m_outputs.push_back(resolve(op->get_output_tensor_ptr(j).get(),
+                                                    instance.m_output_bindings,
+                                                    instruction.m_outputs.size()));
         }
 
         // get op type
@@ -223,51 +555,162 @@ bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
         default: type = op->get_output_element_type(0); break;
         }
 #pragma GCC diagnostic pop
+        instruction.m_kernel = get_kernel(type, *op);
+
+        instance.m_instructions.push_back(move(instruction));
+    }
+}
 
-        if (instance.m_performance_counters_enabled)
+bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
+                                            const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                            const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    auto fit = m_function_map.find(function);
+    if (fit == m_function_map.end())
+    {
+        throw runtime_error("compile() must be called before call().");
+    }
+    FunctionInstance& instance = fit->second;
+    if (!instance.m_is_compiled)
+    {
+        throw runtime_error("compile() must be called before call().");
+    }
+    lock_guard<mutex> lock(instance.m_call_mutex);
+
+    if (instance.m_nan_check_enabled)
+    {
+        vector<shared_ptr<runtime::HostTensor>> htv_inputs;
+        for (auto tensor : inputs)
         {
-            instance.m_timer_map[op].start();
+            htv_inputs.push_back(static_pointer_cast<runtime::HostTensor>(tensor));
         }
-        generate_calls(type, wrapped, op_outputs, op_inputs, instance);
-        if (instance.m_performance_counters_enabled)
+        perform_nan_check(htv_inputs);
+    }
+
+    // patch the caller's buffers into the plan
+    for (const Binding& binding : instance.m_input_bindings)
+    {
+        auto host_tensor = static_cast<runtime::HostTensor*>(inputs[binding.m_index].get());
+        instance.m_instructions[binding.m_instruction].m_inputs[binding.m_slot] =
+            static_cast<char*>(host_tensor->get_data_ptr()) + binding.m_offset;
+    }
+    for (const Binding& binding : instance.m_output_bindings)
+    {
+        auto host_tensor = static_cast<runtime::HostTensor*>(outputs[binding.m_index].get());
+        instance.m_instructions[binding.m_instruction].m_outputs[binding.m_slot] =
+            static_cast<char*>(host_tensor->get_data_ptr()) + binding.m_offset;
+    }
+
+    if (instance.m_performance_counters_enabled)
+    {
+        // Create the timers up front, parallel waves only look them up
+        for (const Instruction& instruction : instance.m_instructions)
         {
-            instance.m_timer_map[op].stop();
+            instance.m_timer_map[&instruction.m_node->get_node()];
         }
-        if (instance.m_nan_check_enabled)
+    }
+
+    // Cached instructions are skipped while every cacheable parameter is bound to the same
+    // tensor, at the same version, as when they last ran
+    bool use_cache = instance.m_cache_valid;
+    for (size_t i = 0; i < instance.m_cacheable_inputs.size(); i++)
+    {
+        const shared_ptr<runtime::Tensor>& tensor = inputs[instance.m_cacheable_inputs[i]];
+        pair<weak_ptr<runtime::Tensor>, uint64_t>& key = instance.m_cache_keys[i];
+        if (key.first.lock() != tensor || key.second != tensor->get_version())
         {
-            perform_nan_check(htv_outputs, op);
+            use_cache = false;
+            key = {tensor, tensor->get_version()};
         }
     }
+    instance.m_cache_valid = false;
+
+    if (!instance.m_parallel_enabled)
+    {
+        for (const Instruction& instruction : instance.m_instructions)
+        {
+            if (!(use_cache && instruction.m_cached))
+            {
+                execute(instruction, instance);
+            }
+        }
+    }
+    else
+    {
+        vector<size_t>& wave_starts = instance.m_wave_starts;
+        for (size_t wave = 0; wave < wave_starts.size(); wave++)
+        {
+            size_t end = wave + 1 < wave_starts.size() ? wave_starts[wave + 1]
+                                                       : instance.m_instructions.size();
+            parallel_for(wave_starts[wave], end, [&](size_t i) {
+                if (!(use_cache && instance.m_instructions[i].m_cached))
+                {
+                    execute(instance.m_instructions[i], instance);
+                }
+            });
+        }
+    }
+    instance.m_cache_valid = true;
+
+    for (const shared_ptr<runtime::Tensor>& output : outputs)
+    {
+        output->mark_modified();
+    }
 
     return true;
 }
 
-void runtime::interpreter::INTBackend::generate_calls(const element::Type& type,
-                                                      const NodeWrapper& op,
-                                                      const vector<void*>& outputs,
-                                                      const vector<const void*>& inputs,
-                                                      FunctionInstance& instance)
+void runtime::interpreter::INTBackend::execute(const Instruction& instruction,
+                                               FunctionInstance& instance)
+{
+    const NodeWrapper& wrapped = *instruction.m_node;
+    const Node* op = &wrapped.get_node();
+    if (instance.m_performance_counters_enabled)
+    {
+        instance.m_timer_map.at(op).start();
+    }
+    (this->*instruction.m_kernel)(wrapped, instruction.m_outputs, instruction.m_inputs, instance);
+    if (instance.m_performance_counters_enabled)
+    {
+        instance.m_timer_map.at(op).stop();
+    }
+    if (instance.m_nan_check_enabled)
+    {
+        vector<shared_ptr<runtime::HostTensor>> htv_outputs;
+        for (size_t i = 0; i < op->get_output_size(); ++i)
+        {
+            htv_outputs.push_back(
+                make_shared<runtime::HostTensor>(op->get_output_element_type(i),
+                                                 op->get_output_shape(i),
+                                                 instruction.m_outputs[i]));
+        }
+        perform_nan_check(htv_outputs, op);
+    }
+}
+
+runtime::interpreter::INTBackend::Kernel
+    runtime::interpreter::INTBackend::get_kernel(const element::Type& type, const Node& node)
 {
     stringstream ss;
     switch (type.get_type_enum())
     {
-    case element::Type_t::boolean: op_engine<char>(op, outputs, inputs, instance); break;
-    case element::Type_t::f32: op_engine<float>(op, outputs, inputs, instance); break;
-    case element::Type_t::f64: op_engine<double>(op, outputs, inputs, instance); break;
-    case element::Type_t::i8: op_engine<int8_t>(op, outputs, inputs, instance); break;
-    case element::Type_t::i16: op_engine<int16_t>(op, outputs, inputs, instance); break;
-    case element::Type_t::i32: op_engine<int32_t>(op, outputs, inputs, instance); break;
-    case element::Type_t::i64: op_engine<int64_t>(op, outputs, inputs, instance); break;
-    case element::Type_t::u8: op_engine<uint8_t>(op, outputs, inputs, instance); break;
-    case element::Type_t::u16: op_engine<uint16_t>(op, outputs, inputs, instance); break;
-    case element::Type_t::u32: op_engine<uint32_t>(op, outputs, inputs, instance); break;
-    case element::Type_t::u64: op_engine<uint64_t>(op, outputs, inputs, instance); break;
+    case element::Type_t::boolean: return &INTBackend::op_engine<char>;
+    case element::Type_t::f32: return &INTBackend::op_engine<float>;
+    case element::Type_t::f64: return &INTBackend::op_engine<double>;
+    case element::Type_t::i8: return &INTBackend::op_engine<int8_t>;
+    case element::Type_t::i16: return &INTBackend::op_engine<int16_t>;
+    case element::Type_t::i32: return &INTBackend::op_engine<int32_t>;
+    case element::Type_t::i64: return &INTBackend::op_engine<int64_t>;
+    case element::Type_t::u8: return &INTBackend::op_engine<uint8_t>;
+    case element::Type_t::u16: return &INTBackend::op_engine<uint16_t>;
+    case element::Type_t::u32: return &INTBackend::op_engine<uint32_t>;
+    case element::Type_t::u64: return &INTBackend::op_engine<uint64_t>;
     case element::Type_t::undefined:
     case element::Type_t::dynamic:
-    case element::Type_t::bf16:
-        ss << "unsupported element type " << type << " op " << op.get_node().get_name();
-        throw ngraph_error(ss.str());
+    case element::Type_t::bf16: break;
     }
+    ss << "unsupported element type " << type << " op " << node.get_name();
+    throw ngraph_error(ss.str());
 }
 
 void runtime::interpreter::INTBackend::set_nan_check(shared_ptr<Function> func, bool enable)
@@ -276,6 +719,19 @@ void runtime::interpreter::INTBackend::set_nan_check(shared_ptr<Function> func,
     instance.m_nan_check_enabled = enable;
 }
 
+void runtime::interpreter::INTBackend::set_parallel(shared_ptr<Function> func, bool enable)
+{
+    FunctionInstance& instance = m_function_map[func];
+    if (instance.m_parallel_enabled != enable)
+    {
+        instance.m_parallel_enabled = enable;
+        if (instance.m_is_compiled)
+        {
+            build_execution_plan(func, instance);
+        }
+    }
+}
+
 void runtime::interpreter::INTBackend::enable_performance_data(shared_ptr<Function> func,
                                                                bool enable)
 {
@@ -350,3 +806,13 @@ bool runtime::interpreter::INTBackend::is_supported(const Node& node) const
 {
     return m_unsupported_op_name_list.find(node.description()) == m_unsupported_op_name_list.end();
 }
+
+bool runtime::interpreter::INTBackend::is_supported_property(const Property prop) const
+{
+    if (prop == Property::memory_attach)
+    {
+        return true;
+    }
+
+    return false;
+}
@@ -18,6 +18,7 @@
 
 #include <initializer_list>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -163,30 +164,86 @@ public:
 
     Handle compile(std::shared_ptr<Function> function) override;
 
+    /// \brief Runs a compiled function. The compiled plan is bound to the caller's tensors in
+    ///        place and owns a single set of temporaries, so it is not reentrant: concurrent
+    ///        calls of the same function wait for each other, calls of different functions do
+    ///        not.
     bool call(std::shared_ptr<Function> function,
               const std::vector<std::shared_ptr<Tensor>>& outputs,
               const std::vector<std::shared_ptr<Tensor>>& intputs) override;
 
     void set_nan_check(std::shared_ptr<Function> func, bool);
 
+    /// \brief Runs independent ops of the same topological wave concurrently and splits the
+    ///        outer loops of convolution, dot, pooling and reductions between threads.
+    ///        Results stay bit-identical to the sequential mode.
+    void set_parallel(std::shared_ptr<Function> func, bool enable);
+
     void enable_performance_data(std::shared_ptr<Function> func, bool enable) override;
     std::vector<PerformanceCounter>
         get_performance_data(std::shared_ptr<Function> func) const override;
 
     bool is_supported(const Node& node) const override;
 
+    bool is_supported_property(const Property prop) const override;
+
 private:
     int get_alignment() const { return 64; }
+    class FunctionInstance;
+    using Kernel = void (INTBackend::*)(const NodeWrapper&,
+                                        const std::vector<void*>&,
+                                        const std::vector<const void*>&,
+                                        FunctionInstance&);
+
+    /// \brief One step of a compiled function: a kernel already bound to its element type
+    /// and the buffers it reads and writes. Only buffers belonging to the function's
+    /// parameters and results are left unresolved; call() patches those through Binding.
+    struct Instruction
+    {
+        const NodeWrapper* m_node;
+        Kernel m_kernel;
+        std::vector<void*> m_outputs;
+        std::vector<const void*> m_inputs;
+        // Only reads constants and cacheable parameters; its outputs live in m_cached_memory
+        // and are reused for as long as those parameters are unchanged.
+        bool m_cached = false;
+    };
+
+    /// \brief Slot m_slot of instruction m_instruction points m_offset bytes into the m_index'th
+    /// tensor passed to call()
+    struct Binding
+    {
+        size_t m_instruction;
+        size_t m_slot;
+        size_t m_index;
+        size_t m_offset;
+    };
+
     class FunctionInstance
     {
     public:
         bool m_is_compiled = false;
         bool m_nan_check_enabled = false;
         bool m_performance_counters_enabled = false;
+        bool m_parallel_enabled = false;
         std::unordered_map<const Node*, stopwatch> m_timer_map;
         std::vector<NodeWrapper> m_wrapped_nodes;
+        std::vector<Instruction> m_instructions;
+        // In parallel mode, the first instruction of each wave; instructions within a wave
+        // do not depend on each other and never share temporary buffers.
+        std::vector<size_t> m_wave_starts;
+        std::vector<Binding> m_input_bindings;
+        std::vector<Binding> m_output_bindings;
         std::unordered_map<const Node*, std::shared_ptr<RNGState>> m_states;
         std::shared_ptr<AlignedBuffer> m_temporary_memory;
+        std::shared_ptr<AlignedBuffer> m_cached_memory;
+        // Inputs of cacheable parameters, and the tensor and version each one had when the
+        // cached instructions last ran
+        std::vector<size_t> m_cacheable_inputs;
+        std::vector<std::pair<std::weak_ptr<Tensor>, uint64_t>> m_cache_keys;
+        bool m_cache_valid = false;
+        // Held for the whole of call(), which patches m_instructions and uses the temporaries
+        std::mutex m_call_mutex;
 
         void* get_temporary_pointer(size_t offset) { return m_temporary_memory->get_ptr(offset); }
     };
@@ -196,11 +253,10 @@ private:
     static void perform_nan_check(const std::vector<std::shared_ptr<HostTensor>>&,
                                   const Node* op = nullptr);
 
-    void generate_calls(const element::Type& type,
-                        const NodeWrapper& op,
-                        const std::vector<void*>& outputs,
-                        const std::vector<const void*>& inputs,
-                        FunctionInstance& instance);
+    void build_execution_plan(std::shared_ptr<Function> function, FunctionInstance& instance);
+    void execute(const Instruction& instruction, FunctionInstance& instance);
+
+    static Kernel get_kernel(const element::Type& type, const Node& node);
 
     template <typename T>
     void op_engine(const NodeWrapper& node_wrapper,
@@ -209,7 +265,6 @@ private:
                    FunctionInstance& instance)
     {
         const Node& node = node_wrapper.get_node();
-        std::string node_op = node.description();
 
 // We want to check that every OP_TYPEID enumeration is included in the list.
 // These GCC flags enable compile-time checking so that if an enumeration
@@ -359,7 +414,8 @@ private:
                                    avg_pool->get_window_movement_strides(),
                                    avg_pool->get_padding_below(),
                                    avg_pool->get_padding_above(),
-                                   avg_pool->get_include_padding_in_avg_computation());
+                                   avg_pool->get_include_padding_in_avg_computation(),
+                                   instance.m_parallel_enabled);
             break;
         }
         case OP_TYPEID::GenerateMask:
@@ -571,7 +627,8 @@ private:
                                       0,
                                       0,
                                       1,
-                                      false);
+                                      false,
+                                      instance.m_parallel_enabled);
             break;
         }
         case OP_TYPEID::ConvolutionBackpropFilters:
@@ -595,7 +652,8 @@ private:
                                       1,
                                       1,
                                       0,
-                                      false);
+                                      false,
+                                      instance.m_parallel_enabled);
             break;
         }
         case OP_TYPEID::ConvolutionBackpropData:
@@ -620,7 +678,8 @@ private:
                                       1,
                                       0,
                                       1,
-                                      true);
+                                      true,
+                                      instance.m_parallel_enabled);
             break;
         }
         case OP_TYPEID::Cos:
@@ -690,7 +749,8 @@ private:
                            node.get_input_shape(0),
                            node.get_input_shape(1),
                            node.get_output_shape(0),
-                           dot->get_reduction_axes_count());
+                           dot->get_reduction_axes_count(),
+                           instance.m_parallel_enabled);
             break;
         }
         case OP_TYPEID::EmbeddingLookup:
@@ -823,7 +883,8 @@ private:
                               static_cast<T*>(out[0]),
                               node.get_input_shape(0),
                               node.get_output_shape(0),
-                              max->get_reduction_axes());
+                              max->get_reduction_axes(),
+                              instance.m_parallel_enabled);
             break;
         }
         case OP_TYPEID::Maximum:
@@ -846,7 +907,8 @@ private:
                                    max_pool->get_window_shape(),
                                    max_pool->get_window_movement_strides(),
                                    max_pool->get_padding_below(),
-                                   max_pool->get_padding_above());
+                                   max_pool->get_padding_above(),
+                                   instance.m_parallel_enabled);
             break;
         }
         case OP_TYPEID::MaxPoolBackprop:
@@ -872,7 +934,8 @@ private:
                               static_cast<T*>(out[0]),
                               node.get_input_shape(0),
                               node.get_output_shape(0),
-                              min->get_reduction_axes());
+                              min->get_reduction_axes(),
+                              instance.m_parallel_enabled);
             break;
         }
         case OP_TYPEID::Minimum:
@@ -966,7 +1029,8 @@ private:
                                   static_cast<T*>(out[0]),
                                   node.get_input_shape(0),
                                   node.get_output_shape(0),
-                                  product->get_reduction_axes());
+                                  product->get_reduction_axes(),
+                                  instance.m_parallel_enabled);
             break;
         }
         case OP_TYPEID::Quantize:
@@ -1190,7 +1254,8 @@ private:
                               static_cast<T*>(out[0]),
                               node.get_input_shape(0),
                               node.get_output_shape(0),
-                              sum->get_reduction_axes());
+                              sum->get_reduction_axes(),
+                              instance.m_parallel_enabled);
             break;
         }
         case OP_TYPEID::Tan:
@@ -56,6 +56,10 @@ bool ngraph::runtime::plaidml::PlaidML_Backend::call(
 {
     auto cfunc = m_cache.compile(func, &m_compiler);
     cfunc->schedule_invocation(inputs, outputs);
+    for (const std::shared_ptr<runtime::Tensor>& output : outputs)
+    {
+        output->mark_modified();
+    }
     return true;
 }
 
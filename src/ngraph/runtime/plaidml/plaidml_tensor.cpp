@@ -45,6 +45,7 @@ void ngraph::runtime::plaidml::PlaidML_Tensor::write(const void* p, size_t tenso
 {
     NGRAPH_DEBUG << "Write " << this << " offset=" << tensor_offset << " n=" << n
                  << " is_logically_zero=" << m_is_logically_zero;
+    mark_modified();
 
     // As a special case: if we get a zero-sized write to offset zero, fill the tensor with zero.
     if (n == 0 && tensor_offset == 0)
@@ -19,6 +19,7 @@
 #include <cmath>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/index_walker.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -34,15 +35,13 @@ namespace ngraph
                            const Shape& out_shape,
                            const AxisSet& broadcast_axes)
             {
-                CoordinateTransform input_transform(in_shape);
-                CoordinateTransform output_transform(out_shape);
+                // The broadcast axes do not move within the input
+                IndexWalker input_index(out_shape, broadcast_axes);
 
-                for (const Coordinate& output_coord : output_transform)
+                size_t out_size = shape_size(out_shape);
+                for (size_t i = 0; i < out_size; i++, ++input_index)
                 {
-                    Coordinate input_coord = reduce(output_coord, broadcast_axes);
-
-                    out[output_transform.index(output_coord)] =
-                        arg[input_transform.index(input_coord)];
+                    out[i] = arg[*input_index];
                 }
             }
         }
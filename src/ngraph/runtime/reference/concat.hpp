@@ -57,22 +57,16 @@ namespace ngraph
                     out_end_coord[concatenation_axis] =
                         concatenation_pos + in_shapes[i][concatenation_axis];
 
-                    CoordinateTransform input_transform(in_shapes[i]);
                     CoordinateTransform output_chunk_transform(
                         out_shape, out_start_coord, out_end_coord);
 
-                    NGRAPH_ASSERT(shape_size(input_transform.get_target_shape()) ==
-                                  shape_size(output_chunk_transform.get_target_shape()));
+                    size_t in_size = shape_size(in_shapes[i]);
+                    NGRAPH_ASSERT(shape_size(output_chunk_transform.get_target_shape()) == in_size);
 
-                    CoordinateTransform::Iterator output_chunk_it = output_chunk_transform.begin();
-
-                    for (const Coordinate& input_coord : input_transform)
+                    IndexWalker output_chunk_index = output_chunk_transform.source_index_walker();
+                    for (size_t j = 0; j < in_size; j++, ++output_chunk_index)
                     {
-                        size_t input_index = input_transform.index(input_coord);
-                        size_t output_chunk_index = output_chunk_transform.index(*output_chunk_it);
-                        ++output_chunk_it;
-
-                        out[output_chunk_index] = args[i][input_index];
+                        out[*output_chunk_index] = args[i][j];
                     }
 
                     concatenation_pos += in_shapes[i][concatenation_axis];
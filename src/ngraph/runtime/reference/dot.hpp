@@ -20,6 +20,7 @@
 #include <utility>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -35,7 +36,8 @@ namespace ngraph
                      const Shape& arg0_shape,
                      const Shape& arg1_shape,
                      const Shape& out_shape,
-                     size_t reduction_axes_count)
+                     size_t reduction_axes_count,
+                     bool parallel = false)
             {
                 // Get the sizes of the dot axes. It's easiest to pull them from arg1 because they're
                 // right up front.
@@ -44,11 +46,7 @@ namespace ngraph
                           arg1_shape.begin() + reduction_axes_count,
                           dot_axis_sizes.begin());
 
-                CoordinateTransform arg0_transform(arg0_shape);
-                CoordinateTransform arg1_transform(arg1_shape);
-                CoordinateTransform output_transform(out_shape);
-
-                // Create coordinate transforms for arg0 and arg1 that throw away the dotted axes.
+                // Create shapes for arg0 and arg1 that throw away the dotted axes.
                 size_t arg0_projected_rank = arg0_shape.size() - reduction_axes_count;
                 size_t arg1_projected_rank = arg1_shape.size() - reduction_axes_count;
 
@@ -62,59 +60,52 @@ namespace ngraph
                           arg1_shape.end(),
                           arg1_projected_shape.begin());
 
-                CoordinateTransform arg0_projected_transform(arg0_projected_shape);
-                CoordinateTransform arg1_projected_transform(arg1_projected_shape);
-
-                // Create a coordinate transform that allows us to iterate over all possible values
-                // for the dotted axes.
-                CoordinateTransform dot_axes_transform(dot_axis_sizes);
+                // All three buffers are row-major and the dotted axes are trailing in arg0 and
+                // leading in arg1, so each side flattens to a matrix and the output coordinate,
+                // being the concatenation of the projected coordinates, flattens to (i, j).
+                size_t arg0_projected_size = shape_size(arg0_projected_shape);
+                size_t arg1_projected_size = shape_size(arg1_projected_shape);
+                size_t dot_size = shape_size(dot_axis_sizes);
 
-                for (const Coordinate& arg0_projected_coord : arg0_projected_transform)
-                {
-                    for (const Coordinate& arg1_projected_coord : arg1_projected_transform)
+                auto compute_block = [&](
+                    size_t i_begin, size_t i_end, size_t j_begin, size_t j_end) {
+                    for (size_t i = i_begin; i < i_end; i++)
                     {
-                        // The output coordinate is just the concatenation of the projected coordinates.
-                        Coordinate out_coord(arg0_projected_coord.size() +
-                                             arg1_projected_coord.size());
-
-                        auto out_coord_it = std::copy(arg0_projected_coord.begin(),
-                                                      arg0_projected_coord.end(),
-                                                      out_coord.begin());
-                        std::copy(
-                            arg1_projected_coord.begin(), arg1_projected_coord.end(), out_coord_it);
+                        const T* arg0_row = arg0 + i * dot_size;
+                        T* out_row = out + i * arg1_projected_size;
 
-                        // Zero out to start the sum.
-                        T sum = 0;
-
-                        size_t out_index = output_transform.index(out_coord);
-
-                        // Walk along the dotted axes.
-                        Coordinate arg0_coord(arg0_shape.size());
-                        Coordinate arg1_coord(arg1_shape.size());
-                        auto arg0_it = std::copy(arg0_projected_coord.begin(),
-                                                 arg0_projected_coord.end(),
-                                                 arg0_coord.begin());
-                        for (const Coordinate& dot_axis_positions : dot_axes_transform)
+                        for (size_t j = j_begin; j < j_end; j++)
                         {
-                            // In order to find the points to multiply together, we need to inject our current
-                            // positions along the dotted axes back into the projected arg0 and arg1 coordinates.
-                            std::copy(
-                                dot_axis_positions.begin(), dot_axis_positions.end(), arg0_it);
+                            // Zero out to start the sum, then walk along the dotted axes.
+                            T sum = 0;
 
-                            auto arg1_it = std::copy(dot_axis_positions.begin(),
-                                                     dot_axis_positions.end(),
-                                                     arg1_coord.begin());
-                            std::copy(
-                                arg1_projected_coord.begin(), arg1_projected_coord.end(), arg1_it);
+                            for (size_t k = 0; k < dot_size; k++)
+                            {
+                                sum += arg0_row[k] * arg1[k * arg1_projected_size + j];
+                            }
 
-                            // Multiply and add to the sum.
-                            sum += arg0[arg0_transform.index(arg0_coord)] *
-                                   arg1[arg1_transform.index(arg1_coord)];
+                            out_row[j] = sum;
                         }
-
-                        // Write the sum back.
-                        out[out_index] = sum;
                     }
+                };
+
+                // Every output element is its own sum in a fixed order, so splitting rows, or
+                // columns when there is a single row, leaves the result bit-identical.
+                if (!parallel)
+                {
+                    compute_block(0, arg0_projected_size, 0, arg1_projected_size);
+                }
+                else if (arg0_projected_size > 1)
+                {
+                    parallel_for_ranges(0, arg0_projected_size, [&](size_t begin, size_t end) {
+                        compute_block(begin, end, 0, arg1_projected_size);
+                    });
+                }
+                else
+                {
+                    parallel_for_ranges(0, arg1_projected_size, [&](size_t begin, size_t end) {
+                        compute_block(0, arg0_projected_size, begin, end);
+                    });
                 }
             }
         }
@@ -20,6 +20,7 @@
 #include <limits>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/reduction.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -33,32 +34,28 @@ namespace ngraph
                      T* out,
                      const Shape& in_shape,
                      const Shape& out_shape,
-                     const AxisSet& reduction_axes)
+                     const AxisSet& reduction_axes,
+                     bool parallel = false)
             {
                 T minval = std::numeric_limits<T>::has_infinity
                                ? -std::numeric_limits<T>::infinity()
                                : std::numeric_limits<T>::min();
 
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& output_coord : output_transform)
+                size_t out_size = shape_size(out_shape);
+                for (size_t i = 0; i < out_size; i++)
                 {
-                    out[output_transform.index(output_coord)] = minval;
+                    out[i] = minval;
                 }
 
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes);
-
-                    T x = arg[input_transform.index(input_coord)];
-                    T max = out[output_transform.index(output_coord)];
-                    if (x > max)
-                    {
-                        out[output_transform.index(output_coord)] = x;
-                    }
-                }
+                for_each_reduction_index(
+                    in_shape, reduction_axes, parallel, [&](size_t i, size_t j) {
+                        T x = arg[i];
+                        T max = out[j];
+                        if (x > max)
+                        {
+                            out[j] = x;
+                        }
+                    });
             }
         }
     }
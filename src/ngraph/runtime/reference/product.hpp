@@ -19,6 +19,7 @@
 #include <cmath>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/reduction.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -32,24 +33,19 @@ namespace ngraph
                          T* out,
                          const Shape& in_shape,
                          const Shape& out_shape,
-                         const AxisSet& reduction_axes)
+                         const AxisSet& reduction_axes,
+                         bool parallel = false)
             {
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& output_coord : output_transform)
+                size_t out_size = shape_size(out_shape);
+                for (size_t i = 0; i < out_size; i++)
                 {
-                    out[output_transform.index(output_coord)] = 1;
+                    out[i] = 1;
                 }
 
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes);
-
-                    out[output_transform.index(output_coord)] *=
-                        arg[input_transform.index(input_coord)];
-                }
+                for_each_reduction_index(in_shape,
+                                         reduction_axes,
+                                         parallel,
+                                         [&](size_t i, size_t j) { out[j] *= arg[i]; });
             }
         }
     }
@@ -0,0 +1,93 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/index_walker.hpp"
+#include "ngraph/parallel.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/shape_util.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Calls func(i, j) for every element i of a row-major input of shape
+            ///        `in_shape`, where j is the row-major index of the output element that i
+            ///        reduces into. Each output element sees its inputs in increasing order of
+            ///        i. With `parallel` set, the outputs are split between threads along the
+            ///        outermost axis that is not reduced; since that keeps the per-output order,
+            ///        results are bit-identical to the serial loop.
+            template <typename F>
+            void for_each_reduction_index(const Shape& in_shape,
+                                          const AxisSet& reduction_axes,
+                                          bool parallel,
+                                          const F& func)
+            {
+                size_t kept_axis = 0;
+                while (kept_axis < in_shape.size() && reduction_axes.count(kept_axis) != 0)
+                {
+                    kept_axis++;
+                }
+
+                size_t in_size = shape_size(in_shape);
+                if (!parallel || kept_axis == in_shape.size() || in_size == 0)
+                {
+                    // The reduction axes do not move within the output
+                    IndexWalker output_index(in_shape, reduction_axes);
+                    for (size_t i = 0; i < in_size; i++, ++output_index)
+                    {
+                        func(i, *output_index);
+                    }
+                    return;
+                }
+
+                // Every axis before kept_axis is reduced, so each slice along kept_axis owns
+                // a contiguous block of outputs, and walking a slice in row-major order visits
+                // the inputs of each of its outputs in the same order as the serial loop.
+                Shape slice_shape(in_shape);
+                slice_shape.erase(slice_shape.begin() + kept_axis);
+                AxisSet slice_axes;
+                for (size_t axis : reduction_axes)
+                {
+                    slice_axes.insert(axis < kept_axis ? axis : axis - 1);
+                }
+                Strides input_steps = row_major_strides(in_shape);
+                size_t input_step = input_steps[kept_axis];
+                input_steps.erase(input_steps.begin() + kept_axis);
+                size_t output_step =
+                    shape_size(reduce(in_shape, reduction_axes)) / in_shape[kept_axis];
+                size_t slice_size = shape_size(slice_shape);
+
+                parallel_for_ranges(0, in_shape[kept_axis], [&](size_t begin, size_t end) {
+                    for (size_t k = begin; k < end; k++)
+                    {
+                        IndexWalker input_index(slice_shape, input_steps, k * input_step);
+                        IndexWalker output_index(slice_shape, slice_axes);
+                        size_t output_offset = k * output_step;
+                        for (size_t n = 0; n < slice_size; n++, ++input_index, ++output_index)
+                        {
+                            func(*input_index, output_offset + *output_index);
+                        }
+                    }
+                });
+            }
+        }
+    }
+}
@@ -42,21 +42,15 @@ namespace ngraph
 
                 CoordinateTransform input_transform(
                     in_shape, in_start_corner, in_shape, in_strides, in_axis_order);
-                CoordinateTransform output_transform(out_shape);
 
-                NGRAPH_ASSERT(shape_size(input_transform.get_target_shape()) ==
-                              shape_size(output_transform.get_target_shape()));
+                size_t out_size = shape_size(out_shape);
+                NGRAPH_ASSERT(shape_size(input_transform.get_target_shape()) == out_size);
 
-                CoordinateTransform::Iterator output_it = output_transform.begin();
-
-                for (const Coordinate& input_coord : input_transform)
+                // The output is written in row-major order; only the input needs to be walked.
+                IndexWalker input_index = input_transform.source_index_walker();
+                for (size_t i = 0; i < out_size; i++, ++input_index)
                 {
-                    const Coordinate& output_coord = *output_it;
-
-                    out[output_transform.index(output_coord)] =
-                        arg[input_transform.index(input_coord)];
-
-                    ++output_it;
+                    out[i] = arg[*input_index];
                 }
             }
         }
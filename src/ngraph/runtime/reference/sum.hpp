@@ -19,6 +19,7 @@
 #include <cmath>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/reduction.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -32,29 +33,25 @@ namespace ngraph
                      T* out,
                      const Shape& in_shape,
                      const Shape& out_shape,
-                     const AxisSet& reduction_axes)
+                     const AxisSet& reduction_axes,
+                     bool parallel = false)
             {
-                CoordinateTransform output_transform(out_shape);
-                std::vector<T> c(shape_size(out_shape));
+                size_t out_size = shape_size(out_shape);
+                std::vector<T> c(out_size);
 
-                for (const Coordinate& output_coord : output_transform)
+                for (size_t i = 0; i < out_size; i++)
                 {
-                    out[output_transform.index(output_coord)] = 0;
-                    c[output_transform.index(output_coord)] = 0;
+                    out[i] = 0;
+                    c[i] = 0;
                 }
 
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes);
-                    T y = arg[input_transform.index(input_coord)] -
-                          c[output_transform.index(output_coord)];
-                    T t = out[output_transform.index(output_coord)] + y;
-                    c[output_transform.index(output_coord)] =
-                        (t - out[output_transform.index(output_coord)]) - y;
-                    out[output_transform.index(output_coord)] = t;
-                }
+                for_each_reduction_index(
+                    in_shape, reduction_axes, parallel, [&](size_t i, size_t j) {
+                        T y = arg[i] - c[j];
+                        T t = out[j] + y;
+                        c[j] = (t - out[j]) - y;
+                        out[j] = t;
+                    });
             }
         }
     }
@@ -73,10 +73,12 @@ namespace ngraph
                 vector<size_t> out_strides = ngraph::row_major_strides(out_shape);
                 auto in_axis_stride = in_strides[axis];
                 auto out_axis_stride = out_strides[axis];
-                for (const Coordinate& coord : input_transform)
+                IndexWalker input_index = input_transform.source_index_walker();
+                IndexWalker output_index = output_transform.source_index_walker();
+                for (; !input_index.at_end(); ++input_index, ++output_index)
                 {
-                    auto arg_index = input_transform.index(coord);
-                    auto out_index = output_transform.index(coord);
+                    auto arg_index = *input_index;
+                    auto out_index = *output_index;
                     // Fill the temp vector
                     U i = 0;
                     for (tuple<T, U>& entry : workspace)
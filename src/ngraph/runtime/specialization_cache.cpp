@@ -0,0 +1,393 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <unordered_set>
+
+#include "ngraph/except.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/runtime/specialization_cache.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::SpecializationCache::SpecializationCache(const shared_ptr<Function>& function,
+                                                  size_t capacity)
+    : m_function(function)
+    , m_capacity(max<size_t>(capacity, 1))
+{
+}
+
+void runtime::SpecializationCache::set_buckets(size_t param_index,
+                                               size_t axis,
+                                               const vector<size_t>& buckets)
+{
+    const ParameterVector& params = m_function->get_parameters();
+    if (param_index >= params.size())
+    {
+        throw ngraph_error("Bucketed parameter index is out of range");
+    }
+    const PartialShape& pshape = params[param_index]->get_output_partial_shape(0);
+    if (pshape.rank().is_static() &&
+        (axis >= static_cast<size_t>(pshape.rank()) || pshape[axis].is_static()))
+    {
+        stringstream ss;
+        ss << "Axis " << axis << " of parameter " << params[param_index]->get_name()
+           << " with shape " << pshape << " is not a dynamic axis";
+        throw ngraph_error(ss.str());
+    }
+
+    if (buckets.empty())
+    {
+        m_buckets.erase({param_index, axis});
+    }
+    else
+    {
+        vector<size_t>& sorted = m_buckets[{param_index, axis}];
+        sorted = buckets;
+        sort(sorted.begin(), sorted.end());
+    }
+}
+
+void runtime::SpecializationCache::set_capacity(size_t capacity)
+{
+    m_capacity = max<size_t>(capacity, 1);
+}
+
+bool runtime::SpecializationCache::is_dynamic(const Function& function)
+{
+    for (const shared_ptr<op::Parameter>& param : function.get_parameters())
+    {
+        if (param->get_output_partial_shape(0).is_dynamic())
+        {
+            return true;
+        }
+    }
+    for (const shared_ptr<op::Result>& result : function.get_results())
+    {
+        if (result->get_output_partial_shape(0).is_dynamic())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+vector<Shape>
+    runtime::SpecializationCache::get_specialized_shapes(const vector<Shape>& input_shapes) const
+{
+    vector<Shape> shapes = input_shapes;
+    for (const auto& entry : m_buckets)
+    {
+        Shape& shape = shapes.at(entry.first.first);
+        size_t axis = entry.first.second;
+        if (axis < shape.size())
+        {
+            const vector<size_t>& buckets = entry.second;
+            auto it = lower_bound(buckets.begin(), buckets.end(), shape[axis]);
+            if (it != buckets.end())
+            {
+                shape[axis] = *it;
+            }
+        }
+    }
+    return shapes;
+}
+
+shared_ptr<Function> runtime::SpecializationCache::specialize(const vector<Shape>& shapes) const
+{
+    // Constants are cloned sharing their data, only the parameters are replaced
+    NodeMap node_map;
+    const ParameterVector& params = m_function->get_parameters();
+    for (size_t i = 0; i < params.size(); i++)
+    {
+        node_map.add(params[i],
+                     make_shared<op::Parameter>(
+                         params[i]->get_element_type(), shapes[i], params[i]->get_cacheable()));
+    }
+    return clone_function(*m_function, node_map);
+}
+
+// Returns true if node is computed from any of params
+static bool depends_on(const shared_ptr<Node>& node, const unordered_set<Node*>& params)
+{
+    unordered_set<Node*> visited;
+    vector<Node*> stack{node.get()};
+    while (!stack.empty())
+    {
+        Node* current = stack.back();
+        stack.pop_back();
+        if (params.count(current) != 0)
+        {
+            return true;
+        }
+        for (const shared_ptr<Node>& arg : current->get_arguments())
+        {
+            if (visited.insert(arg.get()).second)
+            {
+                stack.push_back(arg.get());
+            }
+        }
+    }
+    return false;
+}
+
+// Specializes the function again with every bucketed dimension one larger. Outputs computed
+// from a batch axis grow with it, an output that keeps its shape has reduced the padded rows.
+void runtime::SpecializationCache::check_buckets(const vector<Shape>& shapes,
+                                                 const Function& specialized) const
+{
+    const ParameterVector& params = m_function->get_parameters();
+    unordered_set<Node*> bucketed;
+    vector<Shape> probe_shapes = shapes;
+    for (const auto& entry : m_buckets)
+    {
+        Shape& shape = probe_shapes[entry.first.first];
+        if (entry.first.second < shape.size())
+        {
+            shape[entry.first.second]++;
+            bucketed.insert(params[entry.first.first].get());
+        }
+    }
+    if (bucketed.empty())
+    {
+        return;
+    }
+
+    shared_ptr<Function> probe;
+    try
+    {
+        probe = specialize(probe_shapes);
+    }
+    catch (const ngraph_error& e)
+    {
+        throw ngraph_error(string("Bucketed axes are not batch axes of the function: ") +
+                           e.what());
+    }
+    for (size_t i = 0; i < m_function->get_output_size(); i++)
+    {
+        if (probe->get_output_shape(i) == specialized.get_output_shape(i) &&
+            depends_on(m_function->get_output_op(i), bucketed))
+        {
+            stringstream ss;
+            ss << "Output " << i << " of shape " << specialized.get_output_shape(i)
+               << " does not follow the bucketed axes, padding would change its value";
+            throw ngraph_error(ss.str());
+        }
+    }
+}
+
+runtime::SpecializationCache::Specialization&
+    runtime::SpecializationCache::get_specialization(Backend& backend,
+                                                     const vector<Shape>& shapes)
+{
+    auto it = m_index.find(shapes);
+    if (it != m_index.end())
+    {
+        m_specializations.splice(m_specializations.begin(), m_specializations, it->second);
+        return m_specializations.front();
+    }
+
+    Specialization specialization;
+    specialization.m_input_shapes = shapes;
+    specialization.m_function = specialize(shapes);
+    if (is_dynamic(*specialization.m_function))
+    {
+        throw ngraph_error("Output shapes of a specialized function are still dynamic");
+    }
+    check_buckets(shapes, *specialization.m_function);
+    specialization.m_staging_inputs.resize(m_function->get_parameters().size());
+    specialization.m_staging_outputs.resize(specialization.m_function->get_output_size());
+    backend.compile(specialization.m_function);
+
+    m_specializations.push_front(move(specialization));
+    m_index[shapes] = m_specializations.begin();
+    while (m_specializations.size() > m_capacity)
+    {
+        Specialization& evicted = m_specializations.back();
+        backend.remove_compiled_function(evicted.m_function);
+        m_index.erase(evicted.m_input_shapes);
+        m_specializations.pop_back();
+    }
+    return m_specializations.front();
+}
+
+// Copies the `box` shaped corner at the origin of a row-major tensor of shape src_shape to the
+// same corner of a row-major tensor of shape dst_shape
+static void copy_corner(const char* src,
+                        const Shape& src_shape,
+                        char* dst,
+                        const Shape& dst_shape,
+                        const Shape& box,
+                        size_t element_size)
+{
+    size_t rank = box.size();
+    if (rank == 0)
+    {
+        memcpy(dst, src, element_size);
+        return;
+    }
+    if (shape_size(box) == 0)
+    {
+        return;
+    }
+
+    Strides src_strides = row_major_strides(src_shape);
+    Strides dst_strides = row_major_strides(dst_shape);
+    size_t run = box[rank - 1] * element_size;
+    vector<size_t> index(rank - 1, 0);
+    while (true)
+    {
+        size_t src_offset = 0;
+        size_t dst_offset = 0;
+        for (size_t axis = 0; axis + 1 < rank; axis++)
+        {
+            src_offset += index[axis] * src_strides[axis];
+            dst_offset += index[axis] * dst_strides[axis];
+        }
+        memcpy(dst + dst_offset * element_size, src + src_offset * element_size, run);
+
+        size_t axis = rank - 1;
+        do
+        {
+            if (axis == 0)
+            {
+                return;
+            }
+            axis--;
+            index[axis] = (index[axis] + 1) % box[axis];
+        } while (index[axis] == 0);
+    }
+}
+
+// Copies the overlapping corner of source into target, zero filling the rest of target
+static void copy_overlap(const runtime::Tensor& source, runtime::Tensor& target)
+{
+    const Shape& src_shape = source.get_shape();
+    const Shape& dst_shape = target.get_shape();
+    Shape box(src_shape.size());
+    for (size_t axis = 0; axis < box.size(); axis++)
+    {
+        box[axis] = min(src_shape[axis], dst_shape[axis]);
+    }
+    vector<char> src(source.get_size_in_bytes());
+    vector<char> dst(target.get_size_in_bytes(), 0);
+    source.read(src.data(), 0, src.size());
+    copy_corner(src.data(),
+                src_shape,
+                dst.data(),
+                dst_shape,
+                box,
+                source.get_element_type().size());
+    target.write(dst.data(), 0, dst.size());
+}
+
+bool runtime::SpecializationCache::call(Backend& backend,
+                                        const vector<shared_ptr<Tensor>>& outputs,
+                                        const vector<shared_ptr<Tensor>>& inputs)
+{
+    const ParameterVector& params = m_function->get_parameters();
+    if (inputs.size() != params.size())
+    {
+        throw ngraph_error("Number of inputs does not match the number of function parameters");
+    }
+    vector<Shape> shapes;
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        const Shape& shape = inputs[i]->get_shape();
+        if (!params[i]->get_output_partial_shape(0).compatible(shape) ||
+            !params[i]->get_element_type().compatible(inputs[i]->get_element_type()))
+        {
+            stringstream ss;
+            ss << "Input " << i << " of type " << inputs[i]->get_element_type() << " and shape "
+               << shape << " does not match parameter " << params[i]->get_name();
+            throw ngraph_error(ss.str());
+        }
+        shapes.push_back(shape);
+    }
+
+    Specialization& specialization = get_specialization(backend, get_specialized_shapes(shapes));
+    const Function& function = *specialization.m_function;
+    if (outputs.size() != function.get_output_size())
+    {
+        throw ngraph_error("Number of outputs does not match the number of function results");
+    }
+
+    vector<shared_ptr<Tensor>> call_inputs = inputs;
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        const Shape& shape = specialization.m_input_shapes[i];
+        if (shapes[i] != shape)
+        {
+            shared_ptr<Tensor>& staging = specialization.m_staging_inputs[i];
+            if (!staging)
+            {
+                staging = backend.create_tensor(inputs[i]->get_element_type(), shape);
+            }
+            copy_overlap(*inputs[i], *staging);
+            call_inputs[i] = staging;
+        }
+    }
+
+    vector<shared_ptr<Tensor>> call_outputs = outputs;
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        const Shape& shape = function.get_output_shape(i);
+        const Shape& out_shape = outputs[i]->get_shape();
+        if (out_shape != shape)
+        {
+            if (out_shape.size() != shape.size() ||
+                !equal(out_shape.begin(), out_shape.end(), shape.begin(), less_equal<size_t>()))
+            {
+                stringstream ss;
+                ss << "Output " << i << " of shape " << out_shape
+                   << " does not fit the specialized result shape " << shape;
+                throw ngraph_error(ss.str());
+            }
+            shared_ptr<Tensor>& staging = specialization.m_staging_outputs[i];
+            if (!staging)
+            {
+                staging = backend.create_tensor(function.get_output_element_type(i), shape);
+            }
+            call_outputs[i] = staging;
+        }
+    }
+
+    bool rc = backend.call(specialization.m_function, call_outputs, call_inputs);
+
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        if (call_outputs[i] != outputs[i])
+        {
+            copy_overlap(*call_outputs[i], *outputs[i]);
+        }
+    }
+    return rc;
+}
+
+void runtime::SpecializationCache::clear(Backend& backend)
+{
+    for (const Specialization& specialization : m_specializations)
+    {
+        backend.remove_compiled_function(specialization.m_function);
+    }
+    m_specializations.clear();
+    m_index.clear();
+}
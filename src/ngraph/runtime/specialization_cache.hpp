@@ -0,0 +1,101 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <list>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/tensor.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class SpecializationCache;
+    }
+}
+
+/// \brief Runs a Function with dynamic dimensions on a backend that needs static shapes.
+///
+/// The function is cloned and compiled lazily for each signature of input shapes seen by
+/// call(). The most recently used specializations are kept, the others are removed from the
+/// backend. Clones share the data of the function's constants.
+///
+/// Buckets are set per parameter axis and are meant for batch axes only. A bucketed dimension is
+/// rounded up to the next bucket size so that nearby batch sizes share a specialization. The
+/// input is zero padded at the end of the axis and the outputs are cropped to the shape of the
+/// caller's output tensors. This is only correct when padded rows do not change the rows that
+/// are kept, so a specialization is refused when an output computed from a bucketed parameter
+/// does not follow the padding, as happens when the axis is reduced.
+class ngraph::runtime::SpecializationCache
+{
+public:
+    /// \param function The function to run, its parameters may have dynamic shapes.
+    /// \param capacity The number of specializations kept compiled.
+    SpecializationCache(const std::shared_ptr<Function>& function, size_t capacity = 16);
+
+    /// \brief Sets the sizes the batch axis `axis` of parameter `param_index` is rounded up to.
+    ///     The axis must be dynamic. Dimensions larger than the largest bucket are left exact.
+    ///     An empty list disables bucketing of the axis.
+    void set_buckets(size_t param_index, size_t axis, const std::vector<size_t>& buckets);
+    void set_capacity(size_t capacity);
+
+    /// \brief Runs the specialization for the shapes of inputs, compiling it on backend first
+    ///     if needed.
+    bool call(Backend& backend,
+              const std::vector<std::shared_ptr<Tensor>>& outputs,
+              const std::vector<std::shared_ptr<Tensor>>& inputs);
+
+    /// \brief Removes every specialization from backend
+    void clear(Backend& backend);
+
+    /// \return The number of specializations currently kept
+    size_t size() const { return m_specializations.size(); }
+    /// \return The input shapes a specialization is compiled for, given the caller's shapes
+    std::vector<Shape> get_specialized_shapes(const std::vector<Shape>& input_shapes) const;
+
+    /// \return true if any parameter or result of function has a dynamic shape
+    static bool is_dynamic(const Function& function);
+
+private:
+    struct Specialization
+    {
+        std::vector<Shape> m_input_shapes;
+        std::shared_ptr<Function> m_function;
+        // Padded copies of inputs and uncropped outputs, created on first use
+        std::vector<std::shared_ptr<Tensor>> m_staging_inputs;
+        std::vector<std::shared_ptr<Tensor>> m_staging_outputs;
+    };
+
+    Specialization& get_specialization(Backend& backend, const std::vector<Shape>& shapes);
+    std::shared_ptr<Function> specialize(const std::vector<Shape>& shapes) const;
+    void check_buckets(const std::vector<Shape>& shapes, const Function& specialized) const;
+
+    std::shared_ptr<Function> m_function;
+    size_t m_capacity;
+    // Sorted bucket sizes keyed by parameter index and axis
+    std::map<std::pair<size_t, size_t>, std::vector<size_t>> m_buckets;
+    // Most recently used first
+    std::list<Specialization> m_specializations;
+    std::map<std::vector<Shape>, std::list<Specialization>::iterator> m_index;
+};
@@ -72,6 +72,10 @@ bool runtime::Tensor::get_stale() const
 void runtime::Tensor::set_stale(bool val)
 {
     m_stale = val;
+    if (val)
+    {
+        mark_modified();
+    }
 }
 
 void runtime::Tensor::copy_from(const ngraph::runtime::Tensor& source)
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -42,6 +43,7 @@ namespace ngraph
                    const Backend* parent)
                 : m_descriptor(descriptor)
                 , m_stale(true)
+                , m_version(0)
                 , m_parent(parent)
             {
             }
@@ -88,9 +90,19 @@ namespace ngraph
             bool get_stale() const;
 
             /// \brief Set the stale value of the tensor. A tensor is stale if its data is
-            /// changed.
+            /// changed. Setting it to true also calls mark_modified().
             void set_stale(bool val);
 
+            /// \brief Get the content version of the tensor. The version grows every time the
+            /// data of the tensor is changed, so backends can tell whether results computed
+            /// from it are still valid.
+            /// \return the current version
+            uint64_t get_version() const { return m_version; }
+            /// \brief Record that the data of the tensor changed. write() and backends writing
+            /// call() outputs do this; code writing through a pointer given to create_tensor()
+            /// must call it itself.
+            void mark_modified() { m_version++; }
+
             /// \brief Write bytes directly into the tensor
             /// \param p Pointer to source of data
             /// \param offset Offset into tensor storage to begin writing. Must be element-aligned.
@@ -111,6 +123,7 @@ namespace ngraph
         protected:
             std::shared_ptr<ngraph::descriptor::Tensor> m_descriptor;
             bool m_stale;
+            uint64_t m_version;
             const Backend* m_parent;
         };
 
@@ -14,9 +14,15 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstring>
 #include <fstream>
 #include <functional>
+#include <limits>
+#include <mutex>
+#include <tuple>
 
+#include "ngraph/archive.hpp"
+#include "ngraph/constant_store.hpp"
 #include "ngraph/cpio.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/graph_util.hpp"
@@ -93,7 +99,9 @@
 #include "ngraph/op/tan.hpp"
 #include "ngraph/op/tanh.hpp"
 #include "ngraph/op/topk.hpp"
+#include "ngraph/parallel.hpp"
 #include "ngraph/serializer.hpp"
+#include "ngraph/serializer_extension.hpp"
 #include "ngraph/util.hpp"
 #include "nlohmann/json.hpp"
 
@@ -140,15 +148,76 @@ T get_or_default(nlohmann::json& j, const std::string& key, const T& default_val
     return j.count(key) != 0 ? j.at(key).get<T>() : default_value;
 }
 
+// Serializers registered for ops that are not in op_tbl.hpp
+struct RegisteredOp
+{
+    serializer::OpWriter writer;
+    serializer::OpReader reader;
+};
+
+static mutex s_registered_ops_mutex;
+
+static unordered_map<string, RegisteredOp>& get_registered_ops()
+{
+    static unordered_map<string, RegisteredOp> s_registered_ops;
+    return s_registered_ops;
+}
+
+static const RegisteredOp* find_registered_op(const string& description)
+{
+    lock_guard<mutex> lock(s_registered_ops_mutex);
+    auto& registered_ops = get_registered_ops();
+    auto it = registered_ops.find(description);
+    return it == registered_ops.end() ? nullptr : &it->second;
+}
+
 static std::shared_ptr<ngraph::Function>
     read_function(const json&,
                   std::unordered_map<std::string, std::shared_ptr<Function>>&,
-                  function<const_data_callback_t>);
+                  function<const_data_callback_t>,
+                  const serializer::NodeHooks* hooks = nullptr);
+
+static shared_ptr<Node> read_node(json& node_js,
+                                  OP_TYPEID op_id,
+                                  const string& node_name,
+                                  const string& node_op,
+                                  const vector<shared_ptr<Node>>& args,
+                                  const function<const_data_callback_t>& const_data_callback);
+static shared_ptr<ngraph::Function>
+    make_function(const string& func_name, const NodeVector& outputs, const NodeVector& parameters);
+
+// An op read from a serialized function. Arguments and control dependencies are indices of
+// earlier ops of the function.
+struct SerializedOp
+{
+    string name;
+    string op;
+    OP_TYPEID type_id;
+    vector<size_t> inputs;
+    vector<size_t> control_deps;
+    // The typed attributes of an op in op_tbl.hpp read from a binary model
+    const char* typed_attributes_begin = nullptr;
+    const char* typed_attributes_end = nullptr;
+    // The json of the op, or the attributes of a registered op and the state written by
+    // hooks in a binary model
+    json attributes;
+};
+
+static vector<shared_ptr<Node>>
+    build_nodes(vector<SerializedOp>& ops,
+                const function<const_data_callback_t>& const_data_callback,
+                const string& format,
+                const serializer::NodeHooks* hooks);
 
 static json write(const ngraph::Function&, bool binary_constant_data);
 static json write(const ngraph::Node&, bool binary_constant_data);
+static json write_attributes(const ngraph::Node&);
 static string
     serialize(shared_ptr<ngraph::Function> func, size_t indent, bool binary_constant_data);
+static void write_archive(ostream& out,
+                          shared_ptr<ngraph::Function> func,
+                          const string& model,
+                          size_t alignment);
 
 static json write_dimension(Dimension d)
 {
@@ -215,6 +284,19 @@ static json write_element_type(const ngraph::element::Type& n)
     return j;
 }
 
+// Returns the known element type named c_type, or an undefined type if there is none
+static element::Type find_element_type(const string& c_type)
+{
+    for (const element::Type* t : element::Type::get_known_types())
+    {
+        if (t->c_type_string() == c_type)
+        {
+            return *t;
+        }
+    }
+    return element::Type(0, false, false, false, "");
+}
+
 static element::Type read_element_type(const json& j)
 {
     size_t bitwidth = 0;
@@ -232,914 +314,2620 @@ static element::Type read_element_type(const json& j)
     }
     else
     {
-        string c_type = j.get<string>();
-        for (const element::Type* t : element::Type::get_known_types())
-        {
-            if (t->c_type_string() == c_type)
-            {
-                bitwidth = t->bitwidth();
-                is_real = t->is_real();
-                is_signed = t->is_signed();
-                is_quantized = t->is_quantized();
-                c_type_string = t->c_type_string();
-                break;
-            }
-        }
+        return find_element_type(j.get<string>());
     }
     return element::Type(bitwidth, is_real, is_signed, is_quantized, c_type_string);
 }
 
-void ngraph::serialize(const string& path, shared_ptr<ngraph::Function> func, size_t indent)
-{
-    ofstream out(path);
-    serialize(out, func, indent);
-}
+// The binary model format stores the graph without json. Every string in the graph structure
+// is interned: its first occurrence is written as 0 followed by its length and bytes and later
+// occurrences as one plus its index, so node and op names are written once and resolved to
+// integers by the reader. Integers are LEB128 varints.
+//
+// The attributes of the ops in op_tbl.hpp are typed fields written in a fixed order for each
+// op type, and the reader builds nodes directly from them. They are prefixed by their size so
+// that the reader can skip them while it reads the graph and decode them as the nodes are
+// built. The attributes of registered ops and the state written by hooks are stored as a
+// tagged encoding of their json, with a packed form for unsigned arrays.
+//
+// model:    magic version function_count function*
+// function: name parameter_count name* result_count name* op_count op*
+// op:       op_type name input_count name* control_dep_count name* attribute_size attribute*
+//           extension
+static const char s_binary_model_magic[4] = {'N', 'G', 'B', 'M'};
+static const uint64_t s_binary_model_version = 2;
 
-void ngraph::serialize(ostream& out, shared_ptr<ngraph::Function> func, size_t indent)
+enum class BinaryValue : uint8_t
 {
-    string j = ::serialize(func, indent, true);
-    cpio::Writer writer(out);
-    writer.write(func->get_name(), j.c_str(), static_cast<uint32_t>(j.size()));
+    Null,
+    False,
+    True,
+    Unsigned,
+    Negative,
+    Float,
+    String,
+    Array,
+    Object,
+    UnsignedArray
+};
 
-    traverse_functions(func, [&](shared_ptr<ngraph::Function> f) {
-        traverse_nodes(const_cast<Function*>(f.get()),
-                       [&](shared_ptr<Node> node) {
-                           if (auto c = dynamic_pointer_cast<op::Constant>(node))
-                           {
-                               uint32_t size =
-                                   static_cast<uint32_t>(shape_size(c->get_output_shape(0)) *
-                                                         c->get_output_element_type(0).size());
-                               writer.write(c->get_name(), c->get_data_ptr(), size);
-                           }
-                       },
-                       true);
-    });
+static bool is_binary_model(const char* model_begin, const char* model_end)
+{
+    return model_end - model_begin >= static_cast<ptrdiff_t>(sizeof(s_binary_model_magic)) &&
+           memcmp(model_begin, s_binary_model_magic, sizeof(s_binary_model_magic)) == 0;
 }
 
-static string serialize(shared_ptr<ngraph::Function> func, size_t indent, bool binary_constant_data)
+// Writes the values of the binary model format, including the typed attributes of ops
+class BinaryWriter
 {
-    json j;
-    vector<json> functions;
-    traverse_functions(func, [&](shared_ptr<ngraph::Function> f) {
-        functions.push_back(write(*f, binary_constant_data));
-    });
-    for (auto it = functions.rbegin(); it != functions.rend(); it++)
+public:
+    const string& get_buffer() const { return m_buffer; }
+    // Writes the attributes of an op in op_tbl.hpp in the order read_op reads them
+    void write_op_attributes(const Node& n, OP_TYPEID op_id)
     {
-        j.push_back(*it);
+#pragma GCC diagnostic push
+#pragma GCC diagnostic error "-Wswitch"
+#pragma GCC diagnostic error "-Wswitch-enum"
+        switch (op_id)
+        {
+        case OP_TYPEID::Abs:
+        case OP_TYPEID::Acos:
+        case OP_TYPEID::Add:
+        case OP_TYPEID::AllReduce:
+        case OP_TYPEID::And:
+        case OP_TYPEID::Asin:
+        case OP_TYPEID::Atan:
+        case OP_TYPEID::Ceiling:
+        case OP_TYPEID::Cos:
+        case OP_TYPEID::Cosh:
+        case OP_TYPEID::Divide:
+        case OP_TYPEID::EmbeddingLookup:
+        case OP_TYPEID::Equal:
+        case OP_TYPEID::Exp:
+        case OP_TYPEID::Floor:
+        case OP_TYPEID::Greater:
+        case OP_TYPEID::GreaterEq:
+        case OP_TYPEID::Less:
+        case OP_TYPEID::LessEq:
+        case OP_TYPEID::Log:
+        case OP_TYPEID::Maximum:
+        case OP_TYPEID::Minimum:
+        case OP_TYPEID::Multiply:
+        case OP_TYPEID::Negative:
+        case OP_TYPEID::Not:
+        case OP_TYPEID::NotEqual:
+        case OP_TYPEID::Or:
+        case OP_TYPEID::Power:
+        case OP_TYPEID::Relu:
+        case OP_TYPEID::ReluBackprop:
+        case OP_TYPEID::Result:
+        case OP_TYPEID::Select:
+        case OP_TYPEID::ShapeOf:
+        case OP_TYPEID::Sigmoid:
+        case OP_TYPEID::SigmoidBackprop:
+        case OP_TYPEID::Sign:
+        case OP_TYPEID::Sin:
+        case OP_TYPEID::Sinh:
+        case OP_TYPEID::Sqrt:
+        case OP_TYPEID::StopGradient:
+        case OP_TYPEID::Subtract:
+        case OP_TYPEID::Tan:
+        case OP_TYPEID::Tanh:
+        case OP_TYPEID::UnknownOp: break;
+        case OP_TYPEID::All:
+        {
+            auto tmp = static_cast<const op::All*>(&n);
+            write_unsigned_array(tmp->get_reduction_axes());
+            break;
+        }
+        case OP_TYPEID::Any:
+        {
+            auto tmp = static_cast<const op::Any*>(&n);
+            write_unsigned_array(tmp->get_reduction_axes());
+            break;
+        }
+        case OP_TYPEID::ArgMin:
+        {
+            auto tmp = static_cast<const op::ArgMin*>(&n);
+            write_varint(tmp->get_reduction_axis());
+            write_element_type(tmp->get_element_type());
+            break;
+        }
+        case OP_TYPEID::ArgMax:
+        {
+            auto tmp = static_cast<const op::ArgMax*>(&n);
+            write_varint(tmp->get_reduction_axis());
+            write_element_type(tmp->get_element_type());
+            break;
+        }
+        case OP_TYPEID::AvgPool:
+        {
+            auto tmp = static_cast<const op::AvgPool*>(&n);
+            write_unsigned_array(tmp->get_window_shape());
+            write_unsigned_array(tmp->get_window_movement_strides());
+            write_unsigned_array(tmp->get_padding_below());
+            write_unsigned_array(tmp->get_padding_above());
+            write_bool(tmp->get_include_padding_in_avg_computation());
+            break;
+        }
+        case OP_TYPEID::AvgPoolBackprop:
+        {
+            auto tmp = static_cast<const op::AvgPoolBackprop*>(&n);
+            write_unsigned_array(tmp->get_forward_arg_shape());
+            write_unsigned_array(tmp->get_window_shape());
+            write_unsigned_array(tmp->get_window_movement_strides());
+            write_unsigned_array(tmp->get_padding_below());
+            write_unsigned_array(tmp->get_padding_above());
+            write_bool(tmp->get_include_padding_in_avg_computation());
+            break;
+        }
+        case OP_TYPEID::BatchNormTraining:
+        {
+            write_double(static_cast<const op::BatchNormTraining*>(&n)->get_eps_value());
+            break;
+        }
+        case OP_TYPEID::BatchNormInference:
+        {
+            write_double(static_cast<const op::BatchNormInference*>(&n)->get_eps_value());
+            break;
+        }
+        case OP_TYPEID::BatchNormTrainingBackprop:
+        {
+            write_double(static_cast<const op::BatchNormTrainingBackprop*>(&n)->get_eps_value());
+            break;
+        }
+        case OP_TYPEID::Broadcast:
+        {
+            auto tmp = static_cast<const op::Broadcast*>(&n);
+            write_unsigned_array(tmp->get_broadcast_shape());
+            write_unsigned_array(tmp->get_broadcast_axes());
+            break;
+        }
+        case OP_TYPEID::BroadcastLike:
+        {
+            auto tmp = static_cast<const op::BroadcastLike*>(&n);
+            write_unsigned_array(tmp->get_initial_broadcast_axes());
+            break;
+        }
+        case OP_TYPEID::Concat:
+        {
+            write_varint(static_cast<const op::Concat*>(&n)->get_concatenation_axis());
+            break;
+        }
+        case OP_TYPEID::Constant:
+        {
+            // The data of constants is stored outside of the model
+            auto tmp = static_cast<const op::Constant*>(&n);
+            write_unsigned_array(tmp->get_shape());
+            write_element_type(tmp->get_element_type());
+            break;
+        }
+        case OP_TYPEID::Convert:
+        {
+            write_element_type(static_cast<const op::Convert*>(&n)->get_convert_element_type());
+            break;
+        }
+        case OP_TYPEID::Convolution:
+        {
+            auto tmp = static_cast<const op::Convolution*>(&n);
+            write_unsigned_array(tmp->get_window_movement_strides());
+            write_unsigned_array(tmp->get_window_dilation_strides());
+            write_signed_array(tmp->get_padding_below());
+            write_signed_array(tmp->get_padding_above());
+            write_unsigned_array(tmp->get_data_dilation_strides());
+            break;
+        }
+        case OP_TYPEID::ConvolutionBackpropData:
+        {
+            auto tmp = static_cast<const op::ConvolutionBackpropData*>(&n);
+            write_unsigned_array(tmp->get_data_batch_shape());
+            write_unsigned_array(tmp->get_window_movement_strides_forward());
+            write_unsigned_array(tmp->get_window_dilation_strides_forward());
+            write_signed_array(tmp->get_padding_below_forward());
+            write_signed_array(tmp->get_padding_above_forward());
+            write_unsigned_array(tmp->get_data_dilation_strides_forward());
+            break;
+        }
+        case OP_TYPEID::ConvolutionBackpropFilters:
+        {
+            auto tmp = static_cast<const op::ConvolutionBackpropFilters*>(&n);
+            write_unsigned_array(tmp->get_filters_shape());
+            write_unsigned_array(tmp->get_window_movement_strides_forward());
+            write_unsigned_array(tmp->get_window_dilation_strides_forward());
+            write_signed_array(tmp->get_padding_below_forward());
+            write_signed_array(tmp->get_padding_above_forward());
+            write_unsigned_array(tmp->get_data_dilation_strides_forward());
+            break;
+        }
+        case OP_TYPEID::Dequantize:
+        {
+            auto tmp = static_cast<const op::Dequantize*>(&n);
+            write_element_type(tmp->get_element_type());
+            write_unsigned_array(tmp->get_axes());
+            break;
+        }
+        case OP_TYPEID::Dot:
+        {
+            write_varint(static_cast<const op::Dot*>(&n)->get_reduction_axes_count());
+            break;
+        }
+        case OP_TYPEID::GenerateMask:
+        {
+            auto tmp = static_cast<const op::GenerateMask*>(&n);
+            write_unsigned_array(tmp->get_shape());
+            write_element_type(tmp->get_element_type());
+            write_varint(tmp->get_seed());
+            write_double(tmp->get_probability());
+            break;
+        }
+        case OP_TYPEID::GetOutputElement:
+        {
+            write_varint(static_cast<const op::GetOutputElement*>(&n)->get_n());
+            break;
+        }
+        case OP_TYPEID::LRN:
+        {
+            auto tmp = static_cast<const op::LRN*>(&n);
+            write_double(tmp->get_alpha());
+            write_double(tmp->get_beta());
+            write_double(tmp->get_bias());
+            write_varint(tmp->get_nsize());
+            break;
+        }
+        case OP_TYPEID::Max:
+        {
+            write_unsigned_array(static_cast<const op::Max*>(&n)->get_reduction_axes());
+            break;
+        }
+        case OP_TYPEID::MaxPool:
+        {
+            auto tmp = static_cast<const op::MaxPool*>(&n);
+            write_unsigned_array(tmp->get_window_shape());
+            write_unsigned_array(tmp->get_window_movement_strides());
+            write_unsigned_array(tmp->get_padding_below());
+            write_unsigned_array(tmp->get_padding_above());
+            break;
+        }
+        case OP_TYPEID::MaxPoolBackprop:
+        {
+            auto tmp = static_cast<const op::MaxPoolBackprop*>(&n);
+            write_unsigned_array(tmp->get_window_shape());
+            write_unsigned_array(tmp->get_window_movement_strides());
+            write_unsigned_array(tmp->get_padding_below());
+            write_unsigned_array(tmp->get_padding_above());
+            break;
+        }
+        case OP_TYPEID::Min:
+        {
+            write_unsigned_array(static_cast<const op::Min*>(&n)->get_reduction_axes());
+            break;
+        }
+        case OP_TYPEID::OneHot:
+        {
+            auto tmp = static_cast<const op::OneHot*>(&n);
+            write_partial_shape(tmp->get_output_partial_shape(0));
+            write_varint(tmp->get_one_hot_axis());
+            break;
+        }
+        case OP_TYPEID::Pad:
+        {
+            auto tmp = static_cast<const op::Pad*>(&n);
+            write_unsigned_array(tmp->get_padding_below());
+            write_unsigned_array(tmp->get_padding_above());
+            write_unsigned_array(tmp->get_padding_interior());
+            break;
+        }
+        case OP_TYPEID::Parameter:
+        {
+            auto tmp = static_cast<const op::Parameter*>(&n);
+            write_partial_shape(tmp->get_output_partial_shape(0));
+            write_bool(tmp->get_cacheable());
+            write_element_type(tmp->get_element_type());
+            break;
+        }
+        case OP_TYPEID::Product:
+        {
+            write_unsigned_array(static_cast<const op::Product*>(&n)->get_reduction_axes());
+            break;
+        }
+        case OP_TYPEID::Quantize:
+        {
+            auto tmp = static_cast<const op::Quantize*>(&n);
+            write_element_type(tmp->get_element_type());
+            write_unsigned_array(tmp->get_axes());
+            write_varint(static_cast<uint64_t>(tmp->get_round_mode()));
+            break;
+        }
+        case OP_TYPEID::ReplaceSlice:
+        {
+            auto tmp = static_cast<const op::ReplaceSlice*>(&n);
+            write_unsigned_array(tmp->get_lower_bounds());
+            write_unsigned_array(tmp->get_upper_bounds());
+            write_unsigned_array(tmp->get_strides());
+            break;
+        }
+        case OP_TYPEID::Reshape:
+        {
+            auto tmp = static_cast<const op::Reshape*>(&n);
+            write_unsigned_array(tmp->get_input_order());
+            write_unsigned_array(tmp->get_output_shape());
+            break;
+        }
+        case OP_TYPEID::Reverse:
+        {
+            write_unsigned_array(static_cast<const op::Reverse*>(&n)->get_reversed_axes());
+            break;
+        }
+        case OP_TYPEID::ReverseSequence:
+        {
+            auto tmp = static_cast<const op::ReverseSequence*>(&n);
+            write_varint(tmp->get_batch_axis());
+            write_varint(tmp->get_sequence_axis());
+            break;
+        }
+        case OP_TYPEID::ScalarConstantLike:
+        {
+            auto constant = static_cast<const op::ScalarConstantLikeBase*>(&n)->as_constant();
+            write_double(stod(constant->get_value_strings()[0]));
+            break;
+        }
+        case OP_TYPEID::Slice:
+        {
+            auto tmp = static_cast<const op::Slice*>(&n);
+            write_unsigned_array(tmp->get_lower_bounds());
+            write_unsigned_array(tmp->get_upper_bounds());
+            write_unsigned_array(tmp->get_strides());
+            break;
+        }
+        case OP_TYPEID::Softmax:
+        {
+            write_unsigned_array(static_cast<const op::Softmax*>(&n)->get_axes());
+            break;
+        }
+        case OP_TYPEID::Sum:
+        {
+            write_unsigned_array(static_cast<const op::Sum*>(&n)->get_reduction_axes());
+            break;
+        }
+        case OP_TYPEID::TopK:
+        {
+            auto tmp = static_cast<const op::TopK*>(&n);
+            write_varint(tmp->get_top_k_axis());
+            write_element_type(tmp->get_index_element_type());
+            write_varint(tmp->get_k());
+            write_bool(tmp->get_compute_max());
+            break;
+        }
+        }
+#pragma GCC diagnostic pop
     }
 
-    string rc;
-    if (indent == 0)
+protected:
+    void write_tag(BinaryValue tag) { m_buffer.push_back(static_cast<char>(tag)); }
+    void write_varint(uint64_t value)
     {
-        rc = j.dump();
+        while (value >= 0x80)
+        {
+            m_buffer.push_back(static_cast<char>((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        m_buffer.push_back(static_cast<char>(value));
     }
-    else
+
+    // Signed values are zigzag encoded so that small negative values stay short
+    void write_signed(int64_t value)
     {
-        rc = j.dump(static_cast<int>(indent));
+        write_varint((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
     }
-    return rc;
-}
 
-std::string ngraph::serialize(std::shared_ptr<ngraph::Function> func, size_t indent)
-{
-    return ::serialize(func, indent, false);
-}
+    void write_double(double value)
+    {
+        uint64_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        for (size_t i = 0; i < sizeof(bits); i++)
+        {
+            m_buffer.push_back(static_cast<char>((bits >> (8 * i)) & 0xFF));
+        }
+    }
 
-shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
-{
-    shared_ptr<Function> rc;
-    if (cpio::is_cpio(in))
+    void write_bool(bool value) { m_buffer.push_back(value ? 1 : 0); }
+    template <typename T>
+    void write_unsigned_array(const T& values)
     {
-        cpio::Reader reader(in);
-        vector<cpio::FileInfo> file_info = reader.get_file_info();
-        if (file_info.size() > 0)
-        {
-            // The first file is the model
-            uint32_t size = static_cast<uint32_t>(file_info[0].get_size());
-            char* data = new char[size];
-            reader.read(file_info[0].get_name(), data, size);
-            string jstr(data, size);
-            delete[] data;
-            json js = json::parse(jstr);
-            unordered_map<string, shared_ptr<Function>> function_map;
-            for (json func : js)
-            {
-                shared_ptr<Function> f = read_function(
-                    func,
-                    function_map,
-                    [&](const string& const_name, const element::Type& et, const Shape& shape) {
-                        shared_ptr<Node> const_node;
-                        for (const cpio::FileInfo& info : file_info)
-                        {
-                            if (info.get_name() == const_name)
-                            {
-                                void* const_data = ngraph_malloc(info.get_size());
-                                reader.read(const_name, const_data, info.get_size());
-                                const_node = make_shared<op::Constant>(et, shape, const_data);
-                                ngraph_free(const_data);
-                                break;
-                            }
-                        }
-                        return const_node;
-                    });
-                rc = f;
-            }
+        write_varint(values.size());
+        for (size_t value : values)
+        {
+            write_varint(value);
         }
     }
-    else
+
+    template <typename T>
+    void write_signed_array(const T& values)
     {
-        // json file?
-        std::stringstream ss;
-        ss << in.rdbuf();
-        rc = deserialize(ss.str());
+        write_varint(values.size());
+        for (ptrdiff_t value : values)
+        {
+            write_signed(value);
+        }
     }
-    return rc;
-}
 
-shared_ptr<ngraph::Function> ngraph::deserialize(const string& s)
-{
-    shared_ptr<Function> rc;
-    if (file_util::exists(s))
+    // Element types are not interned so that attributes can be decoded on their own
+    void write_element_type(const element::Type& type)
     {
-        // s is a file and not a json string
-        ifstream in(s, ios_base::binary | ios_base::in);
-        rc = deserialize(in);
+        const string& name = type.c_type_string();
+        write_varint(name.size());
+        m_buffer.append(name);
     }
-    else
+
+    // The rank and dimensions are written as one plus their value, or 0 when dynamic
+    void write_partial_shape(const PartialShape& shape)
     {
-        json js = json::parse(s);
-        unordered_map<string, shared_ptr<Function>> function_map;
-        for (json func : js)
+        if (shape.rank().is_dynamic())
         {
-            shared_ptr<Function> f = read_function(func, function_map, nullptr);
-            rc = f;
+            write_varint(0);
+        }
+        else
+        {
+            write_varint(static_cast<size_t>(shape.rank()) + 1);
+            for (size_t i = 0; i < static_cast<size_t>(shape.rank()); i++)
+            {
+                write_varint(shape[i].is_dynamic() ? 0 : static_cast<size_t>(shape[i]) + 1);
+            }
         }
     }
 
-    return rc;
-}
+    string m_buffer;
+};
 
-static json write(const Function& f, bool binary_constant_data)
+class BinaryModelWriter : public BinaryWriter
 {
-    json function;
-    function["name"] = f.get_name();
-
-    vector<string> parameter_list;
-    for (auto param : f.get_parameters())
+public:
+    BinaryModelWriter(const serializer::NodeHooks* hooks = nullptr)
+        : m_hooks(hooks)
     {
-        parameter_list.push_back(param->get_name());
     }
-    function["parameters"] = parameter_list;
 
-    // TODO Functions can return multiple results
-    for (size_t i = 0; i < f.get_output_size(); ++i)
+    void write_model(shared_ptr<ngraph::Function> func)
     {
-        function["result"].push_back(f.get_output_op(i)->get_name());
-    }
+        vector<shared_ptr<Function>> functions;
+        traverse_functions(func, [&](shared_ptr<ngraph::Function> f) { functions.push_back(f); });
 
-    Function* pf = const_cast<Function*>(&f);
-    json nodes;
-    for (shared_ptr<Node> node : pf->get_ordered_ops(true))
-    {
-        nodes.push_back(write(*node, binary_constant_data));
+        m_buffer.append(s_binary_model_magic, sizeof(s_binary_model_magic));
+        write_varint(s_binary_model_version);
+        write_varint(functions.size());
+        for (auto it = functions.rbegin(); it != functions.rend(); it++)
+        {
+            write_function(**it);
+        }
     }
 
-    function["ops"] = nodes;
-    return function;
-}
-
-static shared_ptr<ngraph::Function>
-    read_function(const json& func_js,
-                  unordered_map<string, shared_ptr<Function>>& function_map,
-                  function<const_data_callback_t> const_data_callback)
-{
-    shared_ptr<ngraph::Function> rc;
-
-    string func_name = func_js.at("name").get<string>();
-    vector<string> func_parameters = func_js.at("parameters").get<vector<string>>();
-    vector<string> func_result = func_js.at("result").get<vector<string>>();
-    unordered_map<string, shared_ptr<Node>> node_map;
-    for (json node_js : func_js.at("ops"))
+private:
+    void write_function(const Function& f)
     {
-        try
+        write_string(f.get_name());
+        write_varint(f.get_parameters().size());
+        for (auto param : f.get_parameters())
         {
-            string node_name = node_js.at("name").get<string>();
-            string node_op = node_js.at("op").get<string>();
-            vector<string> node_inputs = node_js.at("inputs").get<vector<string>>();
-            vector<string> control_deps_inputs =
-                get_or_default<vector<string>>(node_js, "control_deps", vector<string>{});
-            vector<string> node_outputs = node_js.at("outputs").get<vector<string>>();
-            shared_ptr<Node> node;
-            vector<shared_ptr<Node>> args;
-            vector<shared_ptr<Node>> control_deps;
-            for (const string& name : node_inputs)
-            {
-                args.push_back(node_map.at(name));
-            }
-#pragma GCC diagnostic push
-#pragma GCC diagnostic error "-Wswitch"
-#pragma GCC diagnostic error "-Wswitch-enum"
-            // #pragma GCC diagnostic error "-Wimplicit-fallthrough"
-            switch (get_typeid(node_op))
-            {
-            case OP_TYPEID::Abs:
-            {
-                node = make_shared<op::Abs>(args[0]);
-                break;
-            }
-            case OP_TYPEID::Acos:
+            write_string(param->get_name());
+        }
+        write_varint(f.get_output_size());
+        for (size_t i = 0; i < f.get_output_size(); ++i)
+        {
+            write_string(f.get_output_op(i)->get_name());
+        }
+
+        Function* pf = const_cast<Function*>(&f);
+        list<shared_ptr<Node>> ops = pf->get_ordered_ops(true);
+        write_varint(ops.size());
+        for (shared_ptr<Node> node : ops)
+        {
+            const string& node_op = node->description();
+            OP_TYPEID op_id = get_typeid(node_op);
+            write_string(node_op);
+            write_string(node->get_name());
+            write_varint(node->get_input_size());
+            for (const descriptor::Input& input : node->get_inputs())
             {
-                node = make_shared<op::Acos>(args[0]);
-                break;
+                write_string(input.get_output().get_node()->get_name());
             }
-            case OP_TYPEID::Add:
+            write_varint(node->get_control_dependencies().size());
+            for (auto cdep : node->get_control_dependencies())
             {
-                node = make_shared<op::Add>(args[0], args[1]);
-                break;
+                write_string(cdep->get_name());
             }
-            case OP_TYPEID::All:
+
+            size_t attributes_begin = m_buffer.size();
+            write_op_attributes(*node, op_id);
+            m_attributes.assign(m_buffer, attributes_begin, string::npos);
+            m_buffer.resize(attributes_begin);
+            write_varint(m_attributes.size());
+            m_buffer.append(m_attributes);
+
+            if (op_id == OP_TYPEID::UnknownOp || (m_hooks && m_hooks->write))
             {
-                auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
-                node = make_shared<op::All>(args[0], reduction_axes);
-                break;
+                json extension = (op_id == OP_TYPEID::UnknownOp ? write_attributes(*node)
+                                                                : json::object());
+                if (m_hooks && m_hooks->write)
+                {
+                    m_hooks->write(*node, extension);
+                }
+                write_value(extension);
             }
-            case OP_TYPEID::AllReduce:
+            else
             {
-                node = make_shared<op::AllReduce>(args[0]);
-                break;
+                write_tag(BinaryValue::Null);
             }
-            case OP_TYPEID::And:
+        }
+    }
+
+    void write_value(const json& j)
+    {
+        switch (j.type())
+        {
+        case json::value_t::null: write_tag(BinaryValue::Null); break;
+        case json::value_t::boolean:
+            write_tag(j.get<bool>() ? BinaryValue::True : BinaryValue::False);
+            break;
+        case json::value_t::number_unsigned:
+            write_tag(BinaryValue::Unsigned);
+            write_varint(j.get<uint64_t>());
+            break;
+        case json::value_t::number_integer:
+        {
+            int64_t value = j.get<int64_t>();
+            if (value >= 0)
             {
-                node = make_shared<op::And>(args[0], args[1]);
-                break;
+                write_tag(BinaryValue::Unsigned);
+                write_varint(static_cast<uint64_t>(value));
             }
-            case OP_TYPEID::Any:
+            else
             {
-                auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
-                node = make_shared<op::Any>(args[0], reduction_axes);
-                break;
+                write_tag(BinaryValue::Negative);
+                write_varint(static_cast<uint64_t>(-(value + 1)));
             }
-            case OP_TYPEID::ArgMin:
+            break;
+        }
+        case json::value_t::number_float:
+            write_tag(BinaryValue::Float);
+            write_double(j.get<double>());
+            break;
+        case json::value_t::string:
+            write_tag(BinaryValue::String);
+            write_string(j.get<string>());
+            break;
+        case json::value_t::array:
+        {
+            bool is_unsigned = true;
+            for (const json& element : j)
             {
-                auto axis = node_js.at("axis").get<size_t>();
-                auto target_type = read_element_type(node_js.at("index_element_type"));
-                node = make_shared<op::ArgMin>(args[0], axis, target_type);
-                break;
+                is_unsigned = is_unsigned && (element.is_number_unsigned() ||
+                                              (element.is_number_integer() && element >= 0));
             }
-            case OP_TYPEID::ArgMax:
+            write_tag(is_unsigned ? BinaryValue::UnsignedArray : BinaryValue::Array);
+            write_varint(j.size());
+            for (const json& element : j)
             {
-                auto axis = node_js.at("axis").get<size_t>();
-                auto target_type = read_element_type(node_js.at("index_element_type"));
-                node = make_shared<op::ArgMax>(args[0], axis, target_type);
-                break;
+                if (is_unsigned)
+                {
+                    write_varint(element.get<uint64_t>());
+                }
+                else
+                {
+                    write_value(element);
+                }
             }
-            case OP_TYPEID::Asin:
+            break;
+        }
+        case json::value_t::object:
+            write_tag(BinaryValue::Object);
+            write_varint(j.size());
+            for (auto it = j.begin(); it != j.end(); ++it)
             {
-                node = make_shared<op::Asin>(args[0]);
-                break;
+                write_string(it.key());
+                write_value(it.value());
             }
-            case OP_TYPEID::Atan:
-            {
-                node = make_shared<op::Atan>(args[0]);
-                break;
-            }
-            case OP_TYPEID::AvgPool:
-            {
-                auto window_shape = node_js.at("window_shape").get<vector<size_t>>();
-                auto window_movement_strides =
-                    node_js.at("window_movement_strides").get<vector<size_t>>();
-                auto padding_below = node_js.at("padding_below").get<vector<size_t>>();
-                auto padding_above = node_js.at("padding_above").get<vector<size_t>>();
-                auto include_padding_in_avg_computation =
-                    node_js.at("include_padding_in_avg_computation").get<bool>();
-                node = make_shared<op::AvgPool>(args[0],
-                                                window_shape,
+            break;
+        default: throw ngraph_error("Unsupported attribute value in binary model");
+        }
+    }
+
+    void write_string(const string& s)
+    {
+        auto it = m_strings.find(s);
+        if (it != m_strings.end())
+        {
+            write_varint(it->second + 1);
+        }
+        else
+        {
+            write_varint(0);
+            write_varint(s.size());
+            m_buffer.append(s);
+            uint64_t index = m_strings.size();
+            m_strings.insert({s, index});
+        }
+    }
+
+    const serializer::NodeHooks* m_hooks;
+    unordered_map<string, uint64_t> m_strings;
+    // The attributes of the op being written, which follow their size
+    string m_attributes;
+};
+
+// Reads the values of the binary model format, including the typed attributes of ops
+class BinaryReader
+{
+public:
+    BinaryReader(const char* begin, const char* end)
+        : m_pos(begin)
+        , m_end(end)
+    {
+    }
+
+    bool at_end() const { return m_pos == m_end; }
+    // Builds an op in op_tbl.hpp from the attributes written by write_op_attributes
+    shared_ptr<Node> read_op(OP_TYPEID op_id,
+                             const string& node_name,
+                             const string& node_op,
+                             const vector<shared_ptr<Node>>& args,
+                             const function<const_data_callback_t>& const_data_callback)
+    {
+        shared_ptr<Node> node;
+#pragma GCC diagnostic push
+#pragma GCC diagnostic error "-Wswitch"
+#pragma GCC diagnostic error "-Wswitch-enum"
+        switch (op_id)
+        {
+        case OP_TYPEID::Abs:
+        case OP_TYPEID::Acos:
+        case OP_TYPEID::Add:
+        case OP_TYPEID::AllReduce:
+        case OP_TYPEID::And:
+        case OP_TYPEID::Asin:
+        case OP_TYPEID::Atan:
+        case OP_TYPEID::Ceiling:
+        case OP_TYPEID::Cos:
+        case OP_TYPEID::Cosh:
+        case OP_TYPEID::Divide:
+        case OP_TYPEID::EmbeddingLookup:
+        case OP_TYPEID::Equal:
+        case OP_TYPEID::Exp:
+        case OP_TYPEID::Floor:
+        case OP_TYPEID::Greater:
+        case OP_TYPEID::GreaterEq:
+        case OP_TYPEID::Less:
+        case OP_TYPEID::LessEq:
+        case OP_TYPEID::Log:
+        case OP_TYPEID::Maximum:
+        case OP_TYPEID::Minimum:
+        case OP_TYPEID::Multiply:
+        case OP_TYPEID::Negative:
+        case OP_TYPEID::Not:
+        case OP_TYPEID::NotEqual:
+        case OP_TYPEID::Or:
+        case OP_TYPEID::Power:
+        case OP_TYPEID::Relu:
+        case OP_TYPEID::ReluBackprop:
+        case OP_TYPEID::Result:
+        case OP_TYPEID::Select:
+        case OP_TYPEID::ShapeOf:
+        case OP_TYPEID::Sigmoid:
+        case OP_TYPEID::SigmoidBackprop:
+        case OP_TYPEID::Sign:
+        case OP_TYPEID::Sin:
+        case OP_TYPEID::Sinh:
+        case OP_TYPEID::Sqrt:
+        case OP_TYPEID::StopGradient:
+        case OP_TYPEID::Subtract:
+        case OP_TYPEID::Tan:
+        case OP_TYPEID::Tanh:
+        {
+            // Ops without attributes are built from their arguments alone
+            json no_attributes;
+            node = read_node(no_attributes, op_id, node_name, node_op, args, const_data_callback);
+            break;
+        }
+        case OP_TYPEID::All:
+        {
+            node = make_shared<op::All>(args[0], read_unsigned_array());
+            break;
+        }
+        case OP_TYPEID::Any:
+        {
+            node = make_shared<op::Any>(args[0], read_unsigned_array());
+            break;
+        }
+        case OP_TYPEID::ArgMin:
+        {
+            size_t axis = read_varint();
+            element::Type target_type = read_element_type();
+            node = make_shared<op::ArgMin>(args[0], axis, target_type);
+            break;
+        }
+        case OP_TYPEID::ArgMax:
+        {
+            size_t axis = read_varint();
+            element::Type target_type = read_element_type();
+            node = make_shared<op::ArgMax>(args[0], axis, target_type);
+            break;
+        }
+        case OP_TYPEID::AvgPool:
+        {
+            auto window_shape = read_unsigned_array();
+            auto window_movement_strides = read_unsigned_array();
+            auto padding_below = read_unsigned_array();
+            auto padding_above = read_unsigned_array();
+            bool include_padding_in_avg_computation = read_bool();
+            node = make_shared<op::AvgPool>(args[0],
+                                            window_shape,
+                                            window_movement_strides,
+                                            padding_below,
+                                            padding_above,
+                                            include_padding_in_avg_computation);
+            break;
+        }
+        case OP_TYPEID::AvgPoolBackprop:
+        {
+            auto forward_arg_shape = read_unsigned_array();
+            auto window_shape = read_unsigned_array();
+            auto window_movement_strides = read_unsigned_array();
+            auto padding_below = read_unsigned_array();
+            auto padding_above = read_unsigned_array();
+            bool include_padding_in_avg_computation = read_bool();
+            node = make_shared<op::AvgPoolBackprop>(forward_arg_shape,
+                                                    args[0],
+                                                    window_shape,
+                                                    window_movement_strides,
+                                                    padding_below,
+                                                    padding_above,
+                                                    include_padding_in_avg_computation);
+            break;
+        }
+        case OP_TYPEID::BatchNormTraining:
+        {
+            // Odd order for back-compatibility
+            node = make_shared<op::BatchNormTraining>(args[2], args[0], args[1], read_double());
+            break;
+        }
+        case OP_TYPEID::BatchNormInference:
+        {
+            node = make_shared<op::BatchNormInference>(
+                args[2], args[0], args[1], args[3], args[4], read_double());
+            break;
+        }
+        case OP_TYPEID::BatchNormTrainingBackprop:
+        {
+            node = make_shared<op::BatchNormTrainingBackprop>(
+                args[2], args[0], args[1], args[3], args[4], args[5], read_double());
+            break;
+        }
+        case OP_TYPEID::Broadcast:
+        {
+            auto shape = read_unsigned_array();
+            auto axes = read_unsigned_array();
+            node = make_shared<op::Broadcast>(args[0], shape, axes);
+            break;
+        }
+        case OP_TYPEID::BroadcastLike:
+        {
+            node = make_shared<op::BroadcastLike>(args[0], args[1], read_unsigned_array());
+            break;
+        }
+        case OP_TYPEID::Concat:
+        {
+            node = make_shared<op::Concat>(args, read_varint());
+            break;
+        }
+        case OP_TYPEID::Constant:
+        {
+            Shape shape = read_unsigned_array();
+            element::Type element_type = read_element_type();
+            node = const_data_callback(node_name, element_type, shape);
+            break;
+        }
+        case OP_TYPEID::Convert:
+        {
+            node = make_shared<op::Convert>(args[0], read_element_type());
+            break;
+        }
+        case OP_TYPEID::Convolution:
+        {
+            auto window_movement_strides = read_unsigned_array();
+            auto window_dilation_strides = read_unsigned_array();
+            auto padding_below = read_signed_array();
+            auto padding_above = read_signed_array();
+            auto data_dilation_strides = read_unsigned_array();
+            node = make_shared<op::Convolution>(args[0],
+                                                args[1],
                                                 window_movement_strides,
+                                                window_dilation_strides,
                                                 padding_below,
                                                 padding_above,
-                                                include_padding_in_avg_computation);
-                break;
-            }
-            case OP_TYPEID::AvgPoolBackprop:
+                                                data_dilation_strides);
+            break;
+        }
+        case OP_TYPEID::ConvolutionBackpropData:
+        {
+            auto data_batch_shape = read_unsigned_array();
+            auto window_movement_strides_forward = read_unsigned_array();
+            auto window_dilation_strides_forward = read_unsigned_array();
+            auto padding_below_forward = read_signed_array();
+            auto padding_above_forward = read_signed_array();
+            auto data_dilation_strides_forward = read_unsigned_array();
+            node = make_shared<op::ConvolutionBackpropData>(data_batch_shape,
+                                                            args[0],
+                                                            args[1],
+                                                            window_movement_strides_forward,
+                                                            window_dilation_strides_forward,
+                                                            padding_below_forward,
+                                                            padding_above_forward,
+                                                            data_dilation_strides_forward);
+            break;
+        }
+        case OP_TYPEID::ConvolutionBackpropFilters:
+        {
+            auto filters_shape = read_unsigned_array();
+            auto window_movement_strides_forward = read_unsigned_array();
+            auto window_dilation_strides_forward = read_unsigned_array();
+            auto padding_below_forward = read_signed_array();
+            auto padding_above_forward = read_signed_array();
+            auto data_dilation_strides_forward = read_unsigned_array();
+            node = make_shared<op::ConvolutionBackpropFilters>(args[0],
+                                                               filters_shape,
+                                                               args[1],
+                                                               window_movement_strides_forward,
+                                                               window_dilation_strides_forward,
+                                                               padding_below_forward,
+                                                               padding_above_forward,
+                                                               data_dilation_strides_forward);
+            break;
+        }
+        case OP_TYPEID::Dequantize:
+        {
+            element::Type type = read_element_type();
+            auto axes = read_unsigned_array();
+            node = make_shared<op::Dequantize>(args[0], args[1], args[2], type, axes);
+            break;
+        }
+        case OP_TYPEID::Dot:
+        {
+            node = make_shared<op::Dot>(args[0], args[1], read_varint());
+            break;
+        }
+        case OP_TYPEID::GenerateMask:
+        {
+            auto output_shape = read_unsigned_array();
+            element::Type type = read_element_type();
+            auto seed = static_cast<unsigned int>(read_varint());
+            double probability = read_double();
+            node = make_shared<op::GenerateMask>(args[0], output_shape, type, seed, probability);
+            break;
+        }
+        case OP_TYPEID::GetOutputElement:
+        {
+            node = make_shared<op::GetOutputElement>(args[0], read_varint());
+            break;
+        }
+        case OP_TYPEID::LRN:
+        {
+            double alpha = read_double();
+            double beta = read_double();
+            double bias = read_double();
+            size_t nsize = read_varint();
+            node = make_shared<op::LRN>(args[0], alpha, beta, bias, nsize);
+            break;
+        }
+        case OP_TYPEID::Max:
+        {
+            node = make_shared<op::Max>(args[0], read_unsigned_array());
+            break;
+        }
+        case OP_TYPEID::MaxPool:
+        {
+            auto window_shape = read_unsigned_array();
+            auto window_movement_strides = read_unsigned_array();
+            auto padding_below = read_unsigned_array();
+            auto padding_above = read_unsigned_array();
+            node = make_shared<op::MaxPool>(
+                args[0], window_shape, window_movement_strides, padding_below, padding_above);
+            break;
+        }
+        case OP_TYPEID::MaxPoolBackprop:
+        {
+            auto window_shape = read_unsigned_array();
+            auto window_movement_strides = read_unsigned_array();
+            auto padding_below = read_unsigned_array();
+            auto padding_above = read_unsigned_array();
+            if (args.size() == 3)
             {
-                auto forward_arg_shape = node_js.at("forward_arg_shape").get<vector<size_t>>();
-                auto window_shape = node_js.at("window_shape").get<vector<size_t>>();
-                auto window_movement_strides =
-                    node_js.at("window_movement_strides").get<vector<size_t>>();
-                auto padding_below = node_js.at("padding_below").get<vector<size_t>>();
-                auto padding_above = node_js.at("padding_above").get<vector<size_t>>();
-                auto include_padding_in_avg_computation =
-                    get_or_default<bool>(node_js, "include_padding_in_avg_computation", false);
-                node = make_shared<op::AvgPoolBackprop>(forward_arg_shape,
-                                                        args[0],
+                node = make_shared<op::MaxPoolBackprop>(args[0],
+                                                        args[1],
+                                                        args[2],
                                                         window_shape,
                                                         window_movement_strides,
                                                         padding_below,
-                                                        padding_above,
-                                                        include_padding_in_avg_computation);
-                break;
+                                                        padding_above);
             }
-            case OP_TYPEID::BatchNormTraining:
+            else
             {
-                auto epsilon = node_js.at("eps").get<double>();
-                // Odd order for back-compatibility
-                node = make_shared<op::BatchNormTraining>(args[2], args[0], args[1], epsilon);
-                break;
+                node = make_shared<op::MaxPoolBackprop>(args[0],
+                                                        args[1],
+                                                        window_shape,
+                                                        window_movement_strides,
+                                                        padding_below,
+                                                        padding_above);
             }
-            case OP_TYPEID::BatchNormInference:
+            break;
+        }
+        case OP_TYPEID::Min:
+        {
+            node = make_shared<op::Min>(args[0], read_unsigned_array());
+            break;
+        }
+        case OP_TYPEID::OneHot:
+        {
+            PartialShape shape = read_partial_shape();
+            size_t one_hot_axis = read_varint();
+            node = make_shared<op::OneHot>(args[0], shape, one_hot_axis);
+            break;
+        }
+        case OP_TYPEID::Pad:
+        {
+            auto padding_below = read_unsigned_array();
+            auto padding_above = read_unsigned_array();
+            auto padding_interior = read_unsigned_array();
+            node = make_shared<op::Pad>(
+                args[0], args[1], padding_below, padding_above, padding_interior);
+            break;
+        }
+        case OP_TYPEID::Parameter:
+        {
+            PartialShape shape = read_partial_shape();
+            bool cacheable = read_bool();
+            element::Type element_type = read_element_type();
+            node = make_shared<op::Parameter>(element_type, shape, cacheable);
+            break;
+        }
+        case OP_TYPEID::Product:
+        {
+            node = make_shared<op::Product>(args[0], read_unsigned_array());
+            break;
+        }
+        case OP_TYPEID::Quantize:
+        {
+            element::Type type = read_element_type();
+            auto axes = read_unsigned_array();
+            auto round_mode = static_cast<op::Quantize::RoundMode>(read_varint());
+            node = make_shared<op::Quantize>(args[0], args[1], args[2], type, axes, round_mode);
+            break;
+        }
+        case OP_TYPEID::ReplaceSlice:
+        {
+            auto lower_bounds = read_unsigned_array();
+            auto upper_bounds = read_unsigned_array();
+            auto strides = read_unsigned_array();
+            node = make_shared<op::ReplaceSlice>(
+                args[0], args[1], lower_bounds, upper_bounds, strides);
+            break;
+        }
+        case OP_TYPEID::Reshape:
+        {
+            auto input_order = read_unsigned_array();
+            auto output_shape = read_unsigned_array();
+            node = make_shared<op::Reshape>(args[0], input_order, output_shape);
+            break;
+        }
+        case OP_TYPEID::Reverse:
+        {
+            node = make_shared<op::Reverse>(args[0], read_unsigned_array());
+            break;
+        }
+        case OP_TYPEID::ReverseSequence:
+        {
+            size_t batch_axis = read_varint();
+            size_t sequence_axis = read_varint();
+            node = make_shared<op::ReverseSequence>(args[0], args[1], batch_axis, sequence_axis);
+            break;
+        }
+        case OP_TYPEID::ScalarConstantLike:
+        {
+            node = make_shared<op::ScalarConstantLike>(args[0], read_double());
+            break;
+        }
+        case OP_TYPEID::Slice:
+        {
+            auto lower_bounds = read_unsigned_array();
+            auto upper_bounds = read_unsigned_array();
+            auto strides = read_unsigned_array();
+            node = make_shared<op::Slice>(args[0], lower_bounds, upper_bounds, strides);
+            break;
+        }
+        case OP_TYPEID::Softmax:
+        {
+            node = make_shared<op::Softmax>(args[0], read_unsigned_array());
+            break;
+        }
+        case OP_TYPEID::Sum:
+        {
+            node = make_shared<op::Sum>(args[0], read_unsigned_array());
+            break;
+        }
+        case OP_TYPEID::TopK:
+        {
+            size_t top_k_axis = read_varint();
+            element::Type target_type = read_element_type();
+            size_t k = read_varint();
+            bool compute_max = read_bool();
+            node = make_shared<op::TopK>(args[0], top_k_axis, target_type, k, compute_max);
+            break;
+        }
+        case OP_TYPEID::UnknownOp:
+        {
+            throw ngraph_error("Op " + node_op + " has no typed attributes");
+        }
+        }
+#pragma GCC diagnostic pop
+        return node;
+    }
+
+protected:
+    // Every counted item takes at least one byte, which bounds the count by the remaining size
+    uint64_t read_count()
+    {
+        uint64_t rc = read_varint();
+        if (rc > static_cast<uint64_t>(m_end - m_pos))
+        {
+            throw ngraph_error("Binary model is truncated");
+        }
+        return rc;
+    }
+
+    uint64_t read_varint()
+    {
+        uint64_t rc = 0;
+        for (size_t shift = 0; shift < 64; shift += 7)
+        {
+            uint8_t byte = read_byte();
+            rc |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0)
             {
-                auto epsilon = node_js.at("eps").get<double>();
-                // Odd order for back-compatibility
-                node = make_shared<op::BatchNormInference>(
-                    args[2], args[0], args[1], args[3], args[4], epsilon);
-                break;
+                return rc;
             }
-            case OP_TYPEID::BatchNormTrainingBackprop:
+        }
+        throw ngraph_error("Invalid varint in binary model");
+    }
+
+    int64_t read_signed()
+    {
+        uint64_t value = read_varint();
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    double read_double()
+    {
+        uint64_t bits = 0;
+        for (size_t i = 0; i < sizeof(bits); i++)
+        {
+            bits |= static_cast<uint64_t>(read_byte()) << (8 * i);
+        }
+        double value;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    bool read_bool() { return read_byte() != 0; }
+    vector<size_t> read_unsigned_array()
+    {
+        vector<size_t> rc(read_count());
+        for (size_t& value : rc)
+        {
+            value = read_varint();
+        }
+        return rc;
+    }
+
+    vector<ptrdiff_t> read_signed_array()
+    {
+        vector<ptrdiff_t> rc(read_count());
+        for (ptrdiff_t& value : rc)
+        {
+            value = read_signed();
+        }
+        return rc;
+    }
+
+    element::Type read_element_type()
+    {
+        uint64_t size = read_count();
+        string c_type(m_pos, size);
+        m_pos += size;
+        return find_element_type(c_type);
+    }
+
+    PartialShape read_partial_shape()
+    {
+        uint64_t rank = read_count();
+        if (rank == 0)
+        {
+            return PartialShape::dynamic();
+        }
+        vector<Dimension> dimensions(rank - 1);
+        for (Dimension& dimension : dimensions)
+        {
+            uint64_t length = read_varint();
+            dimension = (length == 0 ? Dimension::dynamic() : Dimension(length - 1));
+        }
+        return PartialShape(dimensions);
+    }
+
+    uint8_t read_byte()
+    {
+        if (m_pos == m_end)
+        {
+            throw ngraph_error("Binary model is truncated");
+        }
+        return static_cast<uint8_t>(*m_pos++);
+    }
+
+    const char* m_pos;
+    const char* m_end;
+};
+
+// Reads a binary model in a single pass. The ops of each function are decoded before their
+// nodes are built by build_nodes, which decodes their typed attributes.
+class BinaryModelReader : public BinaryReader
+{
+public:
+    BinaryModelReader(const char* model_begin,
+                      const char* model_end,
+                      function<const_data_callback_t> const_data_callback,
+                      const serializer::NodeHooks* hooks)
+        : BinaryReader(model_begin, model_end)
+        , m_const_data_callback(const_data_callback)
+        , m_hooks(hooks)
+    {
+    }
+
+    shared_ptr<ngraph::Function> read_model()
+    {
+        if (!is_binary_model(m_pos, m_end))
+        {
+            throw ngraph_error("Not a binary model");
+        }
+        m_pos += sizeof(s_binary_model_magic);
+        uint64_t version = read_varint();
+        if (version != s_binary_model_version)
+        {
+            throw ngraph_error("Unsupported binary model version " + to_string(version));
+        }
+
+        shared_ptr<Function> rc;
+        uint64_t function_count = read_count();
+        for (uint64_t i = 0; i < function_count; i++)
+        {
+            rc = read_function();
+        }
+        return rc;
+    }
+
+private:
+    shared_ptr<ngraph::Function> read_function()
+    {
+        string func_name = m_strings[read_string()];
+        vector<uint64_t> func_parameters(read_count());
+        for (uint64_t& name : func_parameters)
+        {
+            name = read_string();
+        }
+        vector<uint64_t> func_result(read_count());
+        for (uint64_t& name : func_result)
+        {
+            name = read_string();
+        }
+
+        // Ops are indexed by the string index of their name
+        const size_t undefined = numeric_limits<size_t>::max();
+        vector<size_t> op_map;
+        auto get_op = [&](uint64_t name) {
+            if (name >= op_map.size() || op_map[name] == undefined)
             {
-                auto epsilon = node_js.at("eps").get<double>();
-                // Odd order for back-compatibility
-                node = make_shared<op::BatchNormTrainingBackprop>(
-                    args[2], args[0], args[1], args[3], args[4], args[5], epsilon);
-                break;
+                throw ngraph_error("Reference to undefined node '" + m_strings[name] + "'");
             }
-            case OP_TYPEID::Broadcast:
+            return op_map[name];
+        };
+
+        vector<SerializedOp> ops(read_count());
+        for (SerializedOp& op : ops)
+        {
+            uint64_t node_op = read_string();
+            uint64_t node_name = read_string();
+            op.name = m_strings[node_name];
+            op.op = m_strings[node_op];
+            op.type_id = get_op_typeid(node_op);
+            try
             {
-                auto shape = node_js.at("shape").get<vector<size_t>>();
-                auto axes = node_js.at("axes").get<set<size_t>>();
-                node = make_shared<op::Broadcast>(args[0], shape, axes);
-                break;
+                op.inputs.resize(read_count());
+                for (size_t& input : op.inputs)
+                {
+                    input = get_op(read_string());
+                }
+                op.control_deps.resize(read_count());
+                for (size_t& cdep : op.control_deps)
+                {
+                    cdep = get_op(read_string());
+                }
+                uint64_t attributes_size = read_count();
+                if (op.type_id != OP_TYPEID::UnknownOp)
+                {
+                    op.typed_attributes_begin = m_pos;
+                    op.typed_attributes_end = m_pos + attributes_size;
+                }
+                m_pos += attributes_size;
+                op.attributes = read_value();
             }
-            case OP_TYPEID::BroadcastLike:
+            catch (...)
             {
-                auto initial_axes = node_js.at("initial_axes").get<set<size_t>>();
-                node = make_shared<op::BroadcastLike>(args[0], args[1], initial_axes);
-                break;
+                throw runtime_error("Error reading binary model at node '" + op.name + "'");
             }
-            case OP_TYPEID::Ceiling:
+            if (op_map.size() <= node_name)
             {
-                node = make_shared<op::Ceiling>(args[0]);
-                break;
+                op_map.resize(m_strings.size(), undefined);
             }
-            case OP_TYPEID::Concat:
+            op_map[node_name] = &op - ops.data();
+        }
+        vector<shared_ptr<Node>> nodes =
+            build_nodes(ops, m_const_data_callback, "binary model", m_hooks);
+
+        NodeVector outputs;
+        for (uint64_t name : func_result)
+        {
+            outputs.push_back(nodes[get_op(name)]);
+        }
+        NodeVector parameters;
+        for (uint64_t name : func_parameters)
+        {
+            parameters.push_back(nodes[get_op(name)]);
+        }
+        return make_function(func_name, outputs, parameters);
+    }
+
+    json read_value()
+    {
+        json rc;
+        BinaryValue tag = static_cast<BinaryValue>(read_byte());
+        switch (tag)
+        {
+        case BinaryValue::Null: break;
+        case BinaryValue::False: rc = false; break;
+        case BinaryValue::True: rc = true; break;
+        case BinaryValue::Unsigned: rc = read_varint(); break;
+        case BinaryValue::Negative: rc = -static_cast<int64_t>(read_varint()) - 1; break;
+        case BinaryValue::Float: rc = read_double(); break;
+        case BinaryValue::String: rc = m_strings[read_string()]; break;
+        case BinaryValue::Array:
+        {
+            rc = json::array();
+            for (uint64_t size = read_count(); size > 0; size--)
             {
-                auto axis = node_js.at("axis").get<size_t>();
-                node = make_shared<op::Concat>(args, axis);
-                break;
+                rc.push_back(read_value());
             }
-            case OP_TYPEID::Constant:
+            break;
+        }
+        case BinaryValue::Object:
+        {
+            rc = json::object();
+            for (uint64_t size = read_count(); size > 0; size--)
             {
-                auto type_node_js =
-                    node_js.count("element_type") == 0 ? node_js.at("value_type") : node_js;
-                auto element_type = read_element_type(type_node_js.at("element_type"));
-                auto shape = type_node_js.at("shape");
-                try
-                {
-                    auto value = node_js.at("value").get<vector<string>>();
-                    node = make_shared<op::Constant>(element_type, shape, value);
-                }
-                catch (...)
-                {
-                    node = const_data_callback(node_name, element_type, shape);
-                }
-                break;
+                string key = m_strings[read_string()];
+                rc[key] = read_value();
             }
-            case OP_TYPEID::Convert:
+            break;
+        }
+        case BinaryValue::UnsignedArray:
+        {
+            rc = json::array();
+            for (uint64_t size = read_count(); size > 0; size--)
             {
-                auto target_type = read_element_type(node_js.at("target_type"));
-                node = make_shared<op::Convert>(args[0], target_type);
-                break;
+                rc.push_back(read_varint());
             }
-            case OP_TYPEID::Convolution:
-            {
-                auto window_movement_strides =
-                    node_js.at("window_movement_strides").get<vector<size_t>>();
-                auto window_dilation_strides =
-                    node_js.at("window_dilation_strides").get<vector<size_t>>();
-                auto padding_below = node_js.at("padding_below").get<vector<std::ptrdiff_t>>();
-                auto padding_above = node_js.at("padding_above").get<vector<std::ptrdiff_t>>();
-
-                // For backwards compatibility, we accept "image_dilation_strides" in place of
-                // "data_dilation_strides", and we also allow it to be omitted altogether.
-                auto data_dilation_strides_maybe = node_js["data_dilation_strides"];
-                if (data_dilation_strides_maybe.empty())
-                {
-                    data_dilation_strides_maybe = node_js["image_dilation_strides"];
-                }
+            break;
+        }
+        default: throw ngraph_error("Invalid attribute value in binary model");
+        }
+        return rc;
+    }
+
+    // Returns the index of the string in m_strings
+    uint64_t read_string()
+    {
+        uint64_t index = read_varint();
+        if (index == 0)
+        {
+            uint64_t size = read_count();
+            m_strings.emplace_back(m_pos, size);
+            m_pos += size;
+            index = m_strings.size() - 1;
+        }
+        else if (--index >= m_strings.size())
+        {
+            throw ngraph_error("Invalid string reference in binary model");
+        }
+        return index;
+    }
+
+    OP_TYPEID get_op_typeid(uint64_t node_op)
+    {
+        if (m_op_typeids.size() <= node_op)
+        {
+            m_op_typeids.resize(m_strings.size(), OP_TYPEID::UnknownOp);
+        }
+        OP_TYPEID& rc = m_op_typeids[node_op];
+        if (rc == OP_TYPEID::UnknownOp)
+        {
+            rc = get_typeid(m_strings[node_op]);
+        }
+        return rc;
+    }
+
+    function<const_data_callback_t> m_const_data_callback;
+    const serializer::NodeHooks* m_hooks;
+    vector<string> m_strings;
+    vector<OP_TYPEID> m_op_typeids;
+};
+
+void ngraph::serialize(const string& path,
+                       shared_ptr<ngraph::Function> func,
+                       size_t indent,
+                       size_t alignment)
+{
+    ofstream out(path, ios_base::binary | ios_base::out);
+    serialize(out, func, indent, alignment);
+}
+
+void ngraph::serialize(ostream& out,
+                       shared_ptr<ngraph::Function> func,
+                       size_t indent,
+                       size_t alignment)
+{
+    // The model is written in the binary format unless formatted json is requested
+    string model;
+    if (indent == 0 && std::getenv("NGRAPH_SERIALIZER_JSON") == nullptr)
+    {
+        BinaryModelWriter model_writer;
+        model_writer.write_model(func);
+        model = model_writer.get_buffer();
+    }
+    else
+    {
+        model = ::serialize(func, indent, true);
+    }
+    write_archive(out, func, model, alignment);
+}
+
+static void write_archive(ostream& out,
+                          shared_ptr<ngraph::Function> func,
+                          const string& model,
+                          size_t alignment)
+{
+    bool checksums = std::getenv("NGRAPH_SERIALIZER_CHECKSUMS") != nullptr;
+    archive::Writer writer(out, alignment == 0 ? 64 : alignment, checksums);
+    // The first record is the model
+    writer.add(func->get_name(), model.data(), model.size());
+
+    traverse_functions(func, [&](shared_ptr<ngraph::Function> f) {
+        traverse_nodes(const_cast<Function*>(f.get()),
+                       [&](shared_ptr<Node> node) {
+                           if (auto c = dynamic_pointer_cast<op::Constant>(node))
+                           {
+                               writer.add(c->get_name(), c->get_data_ptr(), c->get_data_size());
+                           }
+                       },
+                       true);
+    });
+    writer.close();
+}
+
+static string serialize(shared_ptr<ngraph::Function> func, size_t indent, bool binary_constant_data)
+{
+    json j;
+    vector<json> functions;
+    traverse_functions(func, [&](shared_ptr<ngraph::Function> f) {
+        functions.push_back(write(*f, binary_constant_data));
+    });
+    for (auto it = functions.rbegin(); it != functions.rend(); it++)
+    {
+        j.push_back(*it);
+    }
+
+    string rc;
+    if (indent == 0)
+    {
+        rc = j.dump();
+    }
+    else
+    {
+        rc = j.dump(static_cast<int>(indent));
+    }
+    return rc;
+}
+
+std::string ngraph::serialize(std::shared_ptr<ngraph::Function> func, size_t indent)
+{
+    return ::serialize(func, indent, false);
+}
+
+void ngraph::serializer::serialize(ostream& out,
+                                   shared_ptr<ngraph::Function> func,
+                                   const NodeHooks& hooks,
+                                   size_t alignment)
+{
+    BinaryModelWriter model_writer(&hooks);
+    model_writer.write_model(func);
+    write_archive(out, func, model_writer.get_buffer(), alignment);
+}
+
+// Builds the functions of a binary model from its binary or json graph. load_constant returns
+// the data of a named constant record or nullptr if there is no such record.
+static shared_ptr<ngraph::Function> read_binary_model(
+    const char* model_begin,
+    const char* model_end,
+    function<shared_ptr<void>(const string&, const element::Type&, size_t)> load_constant,
+    const serializer::NodeHooks* hooks = nullptr)
+{
+    shared_ptr<Function> rc;
+    auto const_data_callback =
+        [&](const string& const_name, const element::Type& et, const Shape& shape) {
+            shared_ptr<Node> const_node;
+            shared_ptr<void> const_data =
+                load_constant(const_name, et, shape_size(shape) * et.size());
+            if (const_data)
+            {
+                const_node = make_shared<op::Constant>(et, shape, const_data);
+            }
+            return const_node;
+        };
+    if (is_binary_model(model_begin, model_end))
+    {
+        BinaryModelReader reader(model_begin, model_end, const_data_callback, hooks);
+        rc = reader.read_model();
+    }
+    else
+    {
+        json js = json::parse(model_begin, model_end);
+        unordered_map<string, shared_ptr<Function>> function_map;
+        for (json func : js)
+        {
+            rc = read_function(func, function_map, const_data_callback, hooks);
+        }
+    }
+    return rc;
+}
+
+static void check_constant_size(const string& name, uint64_t actual, size_t expected)
+{
+    if (actual != expected)
+    {
+        throw ngraph_error("Constant data size does not match shape for " + name);
+    }
+}
+
+static shared_ptr<ngraph::Function> read_archive(archive::Reader& reader,
+                                                 const serializer::NodeHooks* hooks = nullptr)
+{
+    shared_ptr<Function> rc;
+    const vector<archive::Record>& records = reader.get_records();
+    if (records.size() > 0)
+    {
+        // The first record is the model
+        string jstr(records[0].get_size(), 0);
+        reader.read(records[0], &jstr[0]);
+
+        // The other records hold constant data. It is all read up front, in parallel when
+        // the archive is a file, and interned in parallel.
+        vector<const archive::Record*> const_records;
+        vector<void*> const_buffers;
+        vector<shared_ptr<void>> const_data;
+        unordered_map<string, size_t> const_map;
+        for (size_t i = 1; i < records.size(); i++)
+        {
+            const_map.insert({records[i].get_name(), const_records.size()});
+            const_records.push_back(&records[i]);
+            const_data.push_back(shared_ptr<void>(
+                ngraph::aligned_alloc(64, records[i].get_size()), ngraph::aligned_free));
+            const_buffers.push_back(const_data.back().get());
+        }
+        reader.read(const_records, const_buffers);
+        parallel_for(0, const_data.size(), [&](size_t i) {
+            const_data[i] =
+                ConstantStore::get_instance().intern(const_data[i], const_records[i]->get_size());
+        });
+
+        rc = read_binary_model(jstr.data(),
+                               jstr.data() + jstr.size(),
+                               [&](const string& name, const element::Type& et, size_t size) {
+                                   shared_ptr<void> rc;
+                                   auto it = const_map.find(name);
+                                   if (it != const_map.end())
+                                   {
+                                       check_constant_size(
+                                           name, const_records[it->second]->get_size(), size);
+                                       rc = const_data[it->second];
+                                   }
+                                   return rc;
+                               },
+                               hooks);
+    }
+    return rc;
+}
+
+static shared_ptr<ngraph::Function> read_cpio(cpio::Reader& reader)
+{
+    shared_ptr<Function> rc;
+    vector<cpio::FileInfo> file_info = reader.get_file_info();
+    if (file_info.size() > 0)
+    {
+        unordered_map<string, const cpio::FileInfo*> file_map;
+        for (const cpio::FileInfo& info : file_info)
+        {
+            file_map.insert({info.get_name(), &info});
+        }
+        // The first file is the model
+        string jstr(file_info[0].get_size(), 0);
+        reader.read(file_info[0].get_name(), &jstr[0], jstr.size());
+        mutex reader_mutex;
+        rc = read_binary_model(
+            jstr.data(),
+            jstr.data() + jstr.size(),
+            [&](const string& name, const element::Type& et, size_t size) {
+                shared_ptr<void> const_data;
+                auto it = file_map.find(name);
+                if (it != file_map.end())
+                {
+                    check_constant_size(name, it->second->get_size(), size);
+                    const_data = shared_ptr<void>(ngraph::aligned_alloc(et.size(), size),
+                                                  ngraph::aligned_free);
+                    {
+                        // Constants may be built concurrently
+                        lock_guard<mutex> lock(reader_mutex);
+                        reader.read(name, const_data.get(), size);
+                    }
+                    const_data = ConstantStore::get_instance().intern(const_data, size);
+                }
+                return const_data;
+            });
+    }
+    return rc;
+}
+
+shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
+{
+    shared_ptr<Function> rc;
+    if (archive::is_archive(in))
+    {
+        archive::Reader reader(in);
+        rc = read_archive(reader);
+    }
+    else if (cpio::is_cpio(in))
+    {
+        cpio::Reader reader(in);
+        rc = read_cpio(reader);
+    }
+    else
+    {
+        // json file?
+        std::stringstream ss;
+        ss << in.rdbuf();
+        rc = deserialize(ss.str());
+    }
+    return rc;
+}
+
+shared_ptr<ngraph::Function> ngraph::deserialize_mapped(const string& path)
+{
+    shared_ptr<Function> rc;
+    ifstream in(path, ios_base::binary | ios_base::in);
+    // Name, offset and size of each record, the model first
+    vector<tuple<string, uint64_t, uint64_t>> records;
+    if (archive::is_archive(in))
+    {
+        archive::Reader reader(in);
+        for (const archive::Record& record : reader.get_records())
+        {
+            records.emplace_back(record.get_name(), record.get_offset(), record.get_size());
+        }
+    }
+    else if (cpio::is_cpio(in))
+    {
+        cpio::Reader reader(in);
+        for (const cpio::FileInfo& info : reader.get_file_info())
+        {
+            records.emplace_back(info.get_name(), info.get_offset(), info.get_size());
+        }
+    }
+    else
+    {
+        return deserialize(in);
+    }
+
+    if (records.size() > 0)
+    {
+        size_t file_size;
+        shared_ptr<void> mapping = file_util::map_file(path, file_size);
+        for (auto& record : records)
+        {
+            if (get<1>(record) + get<2>(record) > file_size)
+            {
+                throw ngraph_error("Truncated data for " + get<0>(record));
+            }
+        }
+        unordered_map<string, pair<uint64_t, uint64_t>> record_map;
+        for (auto& record : records)
+        {
+            record_map.insert({get<0>(record), {get<1>(record), get<2>(record)}});
+        }
+
+        const char* base = static_cast<const char*>(mapping.get());
+        const char* model = base + get<1>(records[0]);
+        rc = read_binary_model(
+            model,
+            model + get<2>(records[0]),
+            [&](const string& name, const element::Type& et, size_t size) {
+                shared_ptr<void> const_data;
+                auto it = record_map.find(name);
+                if (it != record_map.end())
+                {
+                    check_constant_size(name, it->second.second, size);
+                    const char* p = base + it->second.first;
+                    if (reinterpret_cast<uintptr_t>(p) % et.size() == 0)
+                    {
+                        // Share ownership of the mapping, pointing at this constant's data
+                        const_data = shared_ptr<void>(mapping, const_cast<char*>(p));
+                    }
+                    else
+                    {
+                        // Data written without alignment is copied out of the mapping
+                        const_data = ConstantStore::get_instance().intern(p, size);
+                    }
+                }
+                return const_data;
+            });
+    }
+    return rc;
+}
+
+shared_ptr<ngraph::Function> ngraph::deserialize(const string& s)
+{
+    shared_ptr<Function> rc;
+    if (file_util::exists(s))
+    {
+        // s is a file and not a json string
+        if (archive::is_archive(s))
+        {
+            // Opening the archive by name allows reading its constants in parallel
+            archive::Reader reader(s);
+            rc = read_archive(reader);
+        }
+        else
+        {
+            ifstream in(s, ios_base::binary | ios_base::in);
+            rc = deserialize(in);
+        }
+    }
+    else
+    {
+        json js = json::parse(s);
+        unordered_map<string, shared_ptr<Function>> function_map;
+        for (json func : js)
+        {
+            shared_ptr<Function> f = read_function(func, function_map, nullptr);
+            rc = f;
+        }
+    }
+
+    return rc;
+}
+
+shared_ptr<ngraph::Function> ngraph::serializer::deserialize(istream& in, const NodeHooks& hooks)
+{
+    if (!archive::is_archive(in))
+    {
+        throw ngraph_error("Node hooks require a serialized model archive");
+    }
+    archive::Reader reader(in);
+    return read_archive(reader, &hooks);
+}
+
+void ngraph::serializer::register_op(const string& description, OpWriter writer, OpReader reader)
+{
+    lock_guard<mutex> lock(s_registered_ops_mutex);
+    get_registered_ops()[description] = RegisteredOp{writer, reader};
+}
+
+bool ngraph::serializer::is_supported_op(const string& description)
+{
+    return get_typeid(description) != OP_TYPEID::UnknownOp ||
+           find_registered_op(description) != nullptr;
+}
+
+string ngraph::serializer::signature(shared_ptr<ngraph::Function> func)
+{
+    string buffer;
+    traverse_functions(func, [&](shared_ptr<ngraph::Function> f) {
+        // Nodes are identified by their position in the topological order
+        unordered_map<const Node*, uint64_t> op_index;
+        auto append = [&buffer](uint64_t value) {
+            buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+        };
+        for (shared_ptr<Node> node : f->get_ordered_ops(true))
+        {
+            if (!is_supported_op(node->description()))
+            {
+                throw ngraph_error("unsupported op " + node->description());
+            }
+            buffer.append(node->description());
+            buffer.push_back('\0');
+            OP_TYPEID op_id = get_typeid(node->description());
+            if (op_id == OP_TYPEID::UnknownOp)
+            {
+                buffer.append(write_attributes(*node).dump());
+            }
+            else
+            {
+                BinaryWriter attributes;
+                attributes.write_op_attributes(*node, op_id);
+                append(attributes.get_buffer().size());
+                buffer.append(attributes.get_buffer());
+            }
+            buffer.push_back('\0');
+            append(node->get_input_size());
+            for (const descriptor::Input& input : node->get_inputs())
+            {
+                append(op_index.at(input.get_output().get_node().get()));
+                append(input.get_output().get_index());
+            }
+            append(node->get_control_dependencies().size());
+            for (auto cdep : node->get_control_dependencies())
+            {
+                append(op_index.at(cdep.get()));
+            }
+            if (auto c = dynamic_pointer_cast<op::Constant>(node))
+            {
+                append(hash_bytes(c->get_data_ptr(), c->get_data_size()));
+            }
+            uint64_t index = op_index.size();
+            op_index[node.get()] = index;
+        }
+        for (auto param : f->get_parameters())
+        {
+            append(op_index.at(param.get()));
+        }
+        for (auto result : f->get_results())
+        {
+            append(op_index.at(result.get()));
+        }
+        append(op_index.size());
+    });
+    return buffer;
+}
+
+uint64_t ngraph::serializer::hash(shared_ptr<ngraph::Function> func)
+{
+    string buffer = signature(func);
+    return hash_bytes(buffer.data(), buffer.size());
+}
+
+static json write(const Function& f, bool binary_constant_data)
+{
+    json function;
+    function["name"] = f.get_name();
+
+    vector<string> parameter_list;
+    for (auto param : f.get_parameters())
+    {
+        parameter_list.push_back(param->get_name());
+    }
+    function["parameters"] = parameter_list;
+
+    // TODO Functions can return multiple results
+    for (size_t i = 0; i < f.get_output_size(); ++i)
+    {
+        function["result"].push_back(f.get_output_op(i)->get_name());
+    }
+
+    Function* pf = const_cast<Function*>(&f);
+    json nodes;
+    for (shared_ptr<Node> node : pf->get_ordered_ops(true))
+    {
+        nodes.push_back(write(*node, binary_constant_data));
+    }
+
+    function["ops"] = nodes;
+    return function;
+}
+
+// Builds a node of type op_id from its json attributes and arguments
+static shared_ptr<Node> read_node(json& node_js,
+                                  OP_TYPEID op_id,
+                                  const string& node_name,
+                                  const string& node_op,
+                                  const vector<shared_ptr<Node>>& args,
+                                  const function<const_data_callback_t>& const_data_callback)
+{
+    shared_ptr<Node> node;
+#pragma GCC diagnostic push
+#pragma GCC diagnostic error "-Wswitch"
+#pragma GCC diagnostic error "-Wswitch-enum"
+    // #pragma GCC diagnostic error "-Wimplicit-fallthrough"
+    switch (op_id)
+    {
+    case OP_TYPEID::Abs:
+    {
+        node = make_shared<op::Abs>(args[0]);
+        break;
+    }
+    case OP_TYPEID::Acos:
+    {
+        node = make_shared<op::Acos>(args[0]);
+        break;
+    }
+    case OP_TYPEID::Add:
+    {
+        node = make_shared<op::Add>(args[0], args[1]);
+        break;
+    }
+    case OP_TYPEID::All:
+    {
+        auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
+        node = make_shared<op::All>(args[0], reduction_axes);
+        break;
+    }
+    case OP_TYPEID::AllReduce:
+    {
+        node = make_shared<op::AllReduce>(args[0]);
+        break;
+    }
+    case OP_TYPEID::And:
+    {
+        node = make_shared<op::And>(args[0], args[1]);
+        break;
+    }
+    case OP_TYPEID::Any:
+    {
+        auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
+        node = make_shared<op::Any>(args[0], reduction_axes);
+        break;
+    }
+    case OP_TYPEID::ArgMin:
+    {
+        auto axis = node_js.at("axis").get<size_t>();
+        auto target_type = read_element_type(node_js.at("index_element_type"));
+        node = make_shared<op::ArgMin>(args[0], axis, target_type);
+        break;
+    }
+    case OP_TYPEID::ArgMax:
+    {
+        auto axis = node_js.at("axis").get<size_t>();
+        auto target_type = read_element_type(node_js.at("index_element_type"));
+        node = make_shared<op::ArgMax>(args[0], axis, target_type);
+        break;
+    }
+    case OP_TYPEID::Asin:
+    {
+        node = make_shared<op::Asin>(args[0]);
+        break;
+    }
+    case OP_TYPEID::Atan:
+    {
+        node = make_shared<op::Atan>(args[0]);
+        break;
+    }
+    case OP_TYPEID::AvgPool:
+    {
+        auto window_shape = node_js.at("window_shape").get<vector<size_t>>();
+        auto window_movement_strides = node_js.at("window_movement_strides").get<vector<size_t>>();
+        auto padding_below = node_js.at("padding_below").get<vector<size_t>>();
+        auto padding_above = node_js.at("padding_above").get<vector<size_t>>();
+        auto include_padding_in_avg_computation =
+            node_js.at("include_padding_in_avg_computation").get<bool>();
+        node = make_shared<op::AvgPool>(args[0],
+                                        window_shape,
+                                        window_movement_strides,
+                                        padding_below,
+                                        padding_above,
+                                        include_padding_in_avg_computation);
+        break;
+    }
+    case OP_TYPEID::AvgPoolBackprop:
+    {
+        auto forward_arg_shape = node_js.at("forward_arg_shape").get<vector<size_t>>();
+        auto window_shape = node_js.at("window_shape").get<vector<size_t>>();
+        auto window_movement_strides = node_js.at("window_movement_strides").get<vector<size_t>>();
+        auto padding_below = node_js.at("padding_below").get<vector<size_t>>();
+        auto padding_above = node_js.at("padding_above").get<vector<size_t>>();
+        auto include_padding_in_avg_computation =
+            get_or_default<bool>(node_js, "include_padding_in_avg_computation", false);
+        node = make_shared<op::AvgPoolBackprop>(forward_arg_shape,
+                                                args[0],
+                                                window_shape,
+                                                window_movement_strides,
+                                                padding_below,
+                                                padding_above,
+                                                include_padding_in_avg_computation);
+        break;
+    }
+    case OP_TYPEID::BatchNormTraining:
+    {
+        auto epsilon = node_js.at("eps").get<double>();
+        // Odd order for back-compatibility
+        node = make_shared<op::BatchNormTraining>(args[2], args[0], args[1], epsilon);
+        break;
+    }
+    case OP_TYPEID::BatchNormInference:
+    {
+        auto epsilon = node_js.at("eps").get<double>();
+        // Odd order for back-compatibility
+        node = make_shared<op::BatchNormInference>(
+            args[2], args[0], args[1], args[3], args[4], epsilon);
+        break;
+    }
+    case OP_TYPEID::BatchNormTrainingBackprop:
+    {
+        auto epsilon = node_js.at("eps").get<double>();
+        // Odd order for back-compatibility
+        node = make_shared<op::BatchNormTrainingBackprop>(
+            args[2], args[0], args[1], args[3], args[4], args[5], epsilon);
+        break;
+    }
+    case OP_TYPEID::Broadcast:
+    {
+        auto shape = node_js.at("shape").get<vector<size_t>>();
+        auto axes = node_js.at("axes").get<set<size_t>>();
+        node = make_shared<op::Broadcast>(args[0], shape, axes);
+        break;
+    }
+    case OP_TYPEID::BroadcastLike:
+    {
+        auto initial_axes = node_js.at("initial_axes").get<set<size_t>>();
+        node = make_shared<op::BroadcastLike>(args[0], args[1], initial_axes);
+        break;
+    }
+    case OP_TYPEID::Ceiling:
+    {
+        node = make_shared<op::Ceiling>(args[0]);
+        break;
+    }
+    case OP_TYPEID::Concat:
+    {
+        auto axis = node_js.at("axis").get<size_t>();
+        node = make_shared<op::Concat>(args, axis);
+        break;
+    }
+    case OP_TYPEID::Constant:
+    {
+        auto type_node_js = node_js.count("element_type") == 0 ? node_js.at("value_type") : node_js;
+        auto element_type = read_element_type(type_node_js.at("element_type"));
+        auto shape = type_node_js.at("shape");
+        try
+        {
+            auto value = node_js.at("value").get<vector<string>>();
+            node = make_shared<op::Constant>(element_type, shape, value);
+        }
+        catch (...)
+        {
+            node = const_data_callback(node_name, element_type, shape);
+        }
+        break;
+    }
+    case OP_TYPEID::Convert:
+    {
+        auto target_type = read_element_type(node_js.at("target_type"));
+        node = make_shared<op::Convert>(args[0], target_type);
+        break;
+    }
+    case OP_TYPEID::Convolution:
+    {
+        auto window_movement_strides = node_js.at("window_movement_strides").get<vector<size_t>>();
+        auto window_dilation_strides = node_js.at("window_dilation_strides").get<vector<size_t>>();
+        auto padding_below = node_js.at("padding_below").get<vector<std::ptrdiff_t>>();
+        auto padding_above = node_js.at("padding_above").get<vector<std::ptrdiff_t>>();
+
+        // For backwards compatibility, we accept "image_dilation_strides" in place of
+        // "data_dilation_strides", and we also allow it to be omitted altogether.
+        auto data_dilation_strides_maybe = node_js["data_dilation_strides"];
+        if (data_dilation_strides_maybe.empty())
+        {
+            data_dilation_strides_maybe = node_js["image_dilation_strides"];
+        }
+
+        if (data_dilation_strides_maybe.empty())
+        {
+            node = make_shared<op::Convolution>(args[0],
+                                                args[1],
+                                                window_movement_strides,
+                                                window_dilation_strides,
+                                                padding_below,
+                                                padding_above);
+        }
+        else
+        {
+            node = make_shared<op::Convolution>(
+                args[0],
+                args[1],
+                window_movement_strides,
+                window_dilation_strides,
+                padding_below,
+                padding_above,
+                data_dilation_strides_maybe.get<std::vector<size_t>>());
+        }
+        break;
+    }
+    case OP_TYPEID::ConvolutionBackpropData:
+    {
+        auto data_batch_shape = node_js.at("data_batch_shape").get<vector<size_t>>();
+        auto window_movement_strides_forward =
+            node_js.at("window_movement_strides_forward").get<vector<size_t>>();
+        auto window_dilation_strides_forward =
+            node_js.at("window_dilation_strides_forward").get<vector<size_t>>();
+        auto padding_below_forward =
+            node_js.at("padding_below_forward").get<vector<std::ptrdiff_t>>();
+        auto padding_above_forward =
+            node_js.at("padding_above_forward").get<vector<std::ptrdiff_t>>();
+        auto data_dilation_strides_forward =
+            node_js.at("data_dilation_strides_forward").get<vector<size_t>>();
+        node = make_shared<op::ConvolutionBackpropData>(data_batch_shape,
+                                                        args[0],
+                                                        args[1],
+                                                        window_movement_strides_forward,
+                                                        window_dilation_strides_forward,
+                                                        padding_below_forward,
+                                                        padding_above_forward,
+                                                        data_dilation_strides_forward);
+        break;
+    }
+    case OP_TYPEID::ConvolutionBackpropFilters:
+    {
+        auto filters_shape = node_js.at("filters_shape").get<vector<size_t>>();
+        auto window_movement_strides_forward =
+            node_js.at("window_movement_strides_forward").get<vector<size_t>>();
+        auto window_dilation_strides_forward =
+            node_js.at("window_dilation_strides_forward").get<vector<size_t>>();
+        auto padding_below_forward =
+            node_js.at("padding_below_forward").get<vector<std::ptrdiff_t>>();
+        auto padding_above_forward =
+            node_js.at("padding_above_forward").get<vector<std::ptrdiff_t>>();
+        auto data_dilation_strides_forward =
+            node_js.at("data_dilation_strides_forward").get<vector<size_t>>();
+        node = make_shared<op::ConvolutionBackpropFilters>(args[0],
+                                                           filters_shape,
+                                                           args[1],
+                                                           window_movement_strides_forward,
+                                                           window_dilation_strides_forward,
+                                                           padding_below_forward,
+                                                           padding_above_forward,
+                                                           data_dilation_strides_forward);
+        break;
+    }
+    case OP_TYPEID::Cos:
+    {
+        node = make_shared<op::Cos>(args[0]);
+        break;
+    }
+    case OP_TYPEID::Cosh:
+    {
+        node = make_shared<op::Cosh>(args[0]);
+        break;
+    }
+    case OP_TYPEID::Dequantize:
+    {
+        auto type = read_element_type(node_js.at("type"));
+        auto axes = node_js.at("axes").get<set<size_t>>();
+        node = make_shared<op::Dequantize>(args[0], args[1], args[2], type, axes);
+        break;
+    }
+    case OP_TYPEID::Divide:
+    {
+        node = make_shared<op::Divide>(args[0], args[1]);
+        break;
+    }
+    case OP_TYPEID::Dot:
+    {
+        // For backwards compatibility, reduction_axes_count is optional.
+        auto obj = node_js["reduction_axes_count"];
+        if (obj.empty())
+        {
+            node = make_shared<op::Dot>(args[0], args[1]);
+        }
+        else
+        {
+            size_t reduction_axes_count = obj.get<size_t>();
+            node = make_shared<op::Dot>(args[0], args[1], reduction_axes_count);
+        }
+        break;
+    }
+    case OP_TYPEID::EmbeddingLookup:
+    {
+        node = make_shared<op::EmbeddingLookup>(args[0], args[1]);
+        break;
+    }
+    case OP_TYPEID::Equal:
+    {
+        node = make_shared<op::Equal>(args[0], args[1]);
+        break;
+    }
+    case OP_TYPEID::Exp:
+    {
+        node = make_shared<op::Exp>(args[0]);
+        break;
+    }
+    case OP_TYPEID::Floor:
+    {
+        node = make_shared<op::Floor>(args[0]);
+        break;
+    }
+    case OP_TYPEID::GenerateMask:
+    {
+        auto output_shape = node_js.at("output_shape").get<vector<size_t>>();
+        auto type = read_element_type(node_js.at("type"));
+        auto seed = node_js.at("seed").get<unsigned int>();
+        auto probability = node_js.at("probability").get<double>();
+
+        node = make_shared<op::GenerateMask>(args[0], output_shape, type, seed, probability);
+        break;
+    }
+    case OP_TYPEID::GetOutputElement:
+    {
+        node = make_shared<op::GetOutputElement>(args[0], node_js.at("n").get<size_t>());
+        break;
+    }
+    case OP_TYPEID::Greater:
+    {
+        node = make_shared<op::Greater>(args[0], args[1]);
+        break;
+    }
+    case OP_TYPEID::GreaterEq:
+    {
+        node = make_shared<op::GreaterEq>(args[0], args[1]);
+        break;
+    }
+    case OP_TYPEID::Less:
+    {
+        node = make_shared<op::Less>(args[0], args[1]);
+        break;
+    }
+    case OP_TYPEID::LessEq:
+    {
+        node = make_shared<op::LessEq>(args[0], args[1]);
+        break;
+    }
+    case OP_TYPEID::Log:
+    {
+        node = make_shared<op::Log>(args[0]);
+        break;
+    }
+    case OP_TYPEID::LRN:
+    {
+        auto alpha = node_js.at("alpha").get<double>();
+        auto beta = node_js.at("beta").get<double>();
+        auto bias = node_js.at("bias").get<double>();
+        auto nsize = node_js.at("nsize").get<size_t>();
+        node = make_shared<op::LRN>(args[0], alpha, beta, bias, nsize);
+        break;
+    }
+    case OP_TYPEID::Max:
+    {
+        auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
+        node = make_shared<op::Max>(args[0], reduction_axes);
+        break;
+    }
+    case OP_TYPEID::MaxPool:
+    {
+        auto window_shape = node_js.at("window_shape").get<vector<size_t>>();
+        auto window_movement_strides = node_js.at("window_movement_strides").get<vector<size_t>>();
+        // For backwards compatibility, both (but not just one) of the padding_ fields may be
+        // omitted.
+        auto padding_below_maybe = node_js["padding_below"];
+        auto padding_above_maybe = node_js["padding_above"];
+        if (padding_below_maybe.empty() && !padding_above_maybe.empty())
+        {
+            throw runtime_error("MaxPool: padding_below is absent but padding_above is present");
+        }
+        else if (!padding_below_maybe.empty() && padding_above_maybe.empty())
+        {
+            throw runtime_error("MaxPool: padding_below is present but padding_above is absent");
+        }
+        else if (!padding_below_maybe.empty() && !padding_above_maybe.empty())
+        {
+            auto padding_below = padding_below_maybe.get<vector<size_t>>();
+            auto padding_above = padding_above_maybe.get<vector<size_t>>();
+            node = make_shared<op::MaxPool>(args[0],
+                                            window_shape,
+                                            window_movement_strides,
+                                            padding_below,
+                                            padding_above);
+        }
+        else
+        {
+            node = make_shared<op::MaxPool>(args[0], window_shape, window_movement_strides);
+        }
+        break;
+    }
+    case OP_TYPEID::MaxPoolBackprop:
+    {
+        auto window_shape = node_js.at("window_shape").get<vector<size_t>>();
+        auto window_movement_strides = node_js.at("window_movement_strides").get<vector<size_t>>();
+        auto padding_below = node_js.at("padding_below").get<vector<size_t>>();
+        auto padding_above = node_js.at("padding_above").get<vector<size_t>>();
+        if (args.size() == 3)
+        {
+            node = make_shared<op::MaxPoolBackprop>(args[0],
+                                                    args[1],
+                                                    args[2],
+                                                    window_shape,
+                                                    window_movement_strides,
+                                                    padding_below,
+                                                    padding_above);
+        }
+        else
+        {
+            node = make_shared<op::MaxPoolBackprop>(args[0],
+                                                    args[1],
+                                                    window_shape,
+                                                    window_movement_strides,
+                                                    padding_below,
+                                                    padding_above);
+        }
+        break;
+    }
+    case OP_TYPEID::Maximum:
+    {
+        node = make_shared<op::Maximum>(args[0], args[1]);
+        break;
+    }
+    case OP_TYPEID::Min:
+    {
+        auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
+        node = make_shared<op::Min>(args[0], reduction_axes);
+        break;
+    }
+    case OP_TYPEID::Minimum:
+    {
+        node = make_shared<op::Minimum>(args[0], args[1]);
+        break;
+    }
+    case OP_TYPEID::Multiply:
+    {
+        node = make_shared<op::Multiply>(args[0], args[1]);
+        break;
+    }
+    case OP_TYPEID::Negative:
+    {
+        node = make_shared<op::Negative>(args[0]);
+        break;
+    }
+    case OP_TYPEID::NotEqual:
+    {
+        node = make_shared<op::NotEqual>(args[0], args[1]);
+        break;
+    }
+    case OP_TYPEID::Not:
+    {
+        node = make_shared<op::Not>(args[0]);
+        break;
+    }
+    case OP_TYPEID::OneHot:
+    {
+        auto shape = node_js.at("shape").get<vector<size_t>>();
+        auto one_hot_axis = node_js.at("one_hot_axis").get<size_t>();
+        node = make_shared<op::OneHot>(args[0], read_partial_shape(shape), one_hot_axis);
+        break;
+    }
+    case OP_TYPEID::Or:
+    {
+        node = make_shared<op::Or>(args[0], args[1]);
+        break;
+    }
+    case OP_TYPEID::Pad:
+    {
+        auto padding_below = node_js.at("padding_below").get<vector<size_t>>();
+        auto padding_above = node_js.at("padding_above").get<vector<size_t>>();
+        auto padding_interior = node_js.at("padding_interior").get<vector<size_t>>();
+        node = make_shared<op::Pad>(
+            args[0], args[1], padding_below, padding_above, padding_interior);
+        break;
+    }
+    case OP_TYPEID::Parameter:
+    {
+        auto type_node_js = node_js.count("element_type") == 0 ? node_js.at("value_type") : node_js;
+        auto element_type = read_element_type(type_node_js.at("element_type"));
+        auto shape = type_node_js.at("shape");
+        auto cacheable = get_or_default<bool>(node_js, "cacheable", false);
+        node = make_shared<op::Parameter>(element_type, read_partial_shape(shape), cacheable);
+        break;
+    }
+    case OP_TYPEID::Power:
+    {
+        node = make_shared<op::Power>(args[0], args[1]);
+        break;
+    }
+    case OP_TYPEID::Product:
+    {
+        auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
+        node = make_shared<op::Product>(args[0], reduction_axes);
+        break;
+    }
+    case OP_TYPEID::Quantize:
+    {
+        auto type = read_element_type(node_js.at("type"));
+        auto axes = node_js.at("axes").get<set<size_t>>();
+        auto round_mode = node_js.at("round_mode").get<op::Quantize::RoundMode>();
+        node = make_shared<op::Quantize>(args[0], args[1], args[2], type, axes, round_mode);
+        break;
+    }
+    case OP_TYPEID::Relu:
+    {
+        node = make_shared<op::Relu>(args[0]);
+        break;
+    }
+    case OP_TYPEID::ReluBackprop:
+    {
+        node = make_shared<op::ReluBackprop>(args[0], args[1]);
+        break;
+    }
+    case OP_TYPEID::ReplaceSlice:
+    {
+        auto lower_bounds = node_js.at("lower_bounds").get<vector<size_t>>();
+        auto upper_bounds = node_js.at("upper_bounds").get<vector<size_t>>();
+        auto strides = node_js.at("strides").get<vector<size_t>>();
+        node = make_shared<op::ReplaceSlice>(args[0], args[1], lower_bounds, upper_bounds, strides);
+        break;
+    }
+    case OP_TYPEID::Reshape:
+    {
+        auto input_order = node_js.at("input_order").get<vector<size_t>>();
+        auto output_shape = node_js.at("output_shape").get<vector<size_t>>();
+        node = make_shared<op::Reshape>(args[0], input_order, output_shape);
+        break;
+    }
+    case OP_TYPEID::Result:
+    {
+        node = make_shared<op::Result>(args[0]);
+        break;
+    }
+    case OP_TYPEID::Reverse:
+    {
+        auto reversed_axes = node_js.at("reversed_axes").get<set<size_t>>();
+        node = make_shared<op::Reverse>(args[0], reversed_axes);
+        break;
+    }
+    case OP_TYPEID::ReverseSequence:
+    {
+        auto batch_axis = node_js.at("batch_axis").get<size_t>();
+        auto sequence_axis = node_js.at("sequence_axis").get<size_t>();
+        node = make_shared<op::ReverseSequence>(args[0], args[1], batch_axis, sequence_axis);
+        break;
+    }
+    case OP_TYPEID::ScalarConstantLike:
+    {
+        double value = node_js.at("value").get<double>();
+        node = make_shared<op::ScalarConstantLike>(args[0], value);
+        break;
+    }
+    case OP_TYPEID::Select:
+    {
+        node = make_shared<op::Select>(args[0], args[1], args[2]);
+        break;
+    }
+    case OP_TYPEID::ShapeOf:
+    {
+        node = make_shared<op::ShapeOf>(args[0]);
+        break;
+    }
+    case OP_TYPEID::Sigmoid:
+    {
+        node = make_shared<op::Sigmoid>(args[0]);
+        break;
+    }
+    case OP_TYPEID::SigmoidBackprop:
+    {
+        node = make_shared<op::SigmoidBackprop>(args[0], args[1]);
+        break;
+    }
+    case OP_TYPEID::Sign:
+    {
+        node = make_shared<op::Sign>(args[0]);
+        break;
+    }
+    case OP_TYPEID::Sin:
+    {
+        node = make_shared<op::Sin>(args[0]);
+        break;
+    }
+    case OP_TYPEID::Sinh:
+    {
+        node = make_shared<op::Sinh>(args[0]);
+        break;
+    }
+    case OP_TYPEID::Slice:
+    {
+        auto lower_bounds = node_js.at("lower_bounds").get<vector<size_t>>();
+        auto upper_bounds = node_js.at("upper_bounds").get<vector<size_t>>();
+        auto strides = node_js.at("strides").get<vector<size_t>>();
+        node = make_shared<op::Slice>(args[0], lower_bounds, upper_bounds, strides);
+        break;
+    }
+    case OP_TYPEID::Softmax:
+    {
+        auto softmax_axes = node_js.at("softmax_axes").get<set<size_t>>();
+        node = make_shared<op::Softmax>(args[0], softmax_axes);
+        break;
+    }
+    case OP_TYPEID::Sqrt:
+    {
+        node = make_shared<op::Sqrt>(args[0]);
+        break;
+    }
+    case OP_TYPEID::Subtract:
+    {
+        node = make_shared<op::Subtract>(args[0], args[1]);
+        break;
+    }
+    case OP_TYPEID::Sum:
+    {
+        auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
+        node = make_shared<op::Sum>(args[0], reduction_axes);
+        break;
+    }
+    case OP_TYPEID::Tan:
+    {
+        node = make_shared<op::Tan>(args[0]);
+        break;
+    }
+    case OP_TYPEID::Tanh:
+    {
+        node = make_shared<op::Tanh>(args[0]);
+        break;
+    }
+    case OP_TYPEID::TopK:
+    {
+        auto top_k_axis = node_js.at("top_k_axis").get<size_t>();
+        auto k = node_js.at("k").get<size_t>();
+        auto compute_max = node_js.at("compute_max").get<bool>();
+        auto target_type = read_element_type(node_js.at("index_element_type"));
+        node = make_shared<op::TopK>(args[0], top_k_axis, target_type, k, compute_max);
+        break;
+    }
+    case OP_TYPEID::StopGradient:
+    {
+        node = make_shared<op::StopGradient>(args[0]);
+        break;
+    }
+    case OP_TYPEID::UnknownOp:
+    {
+        if (const RegisteredOp* registered_op = find_registered_op(node_op))
+        {
+            node = registered_op->reader(node_js, args);
+            break;
+        }
+        stringstream ss;
+        ss << "unsupported op " << node_op;
+        throw runtime_error(ss.str());
+    }
+    }
+#pragma GCC diagnostic pop
+    return node;
+}
 
-                if (data_dilation_strides_maybe.empty())
-                {
-                    node = make_shared<op::Convolution>(args[0],
-                                                        args[1],
-                                                        window_movement_strides,
-                                                        window_dilation_strides,
-                                                        padding_below,
-                                                        padding_above);
-                }
-                else
-                {
-                    node = make_shared<op::Convolution>(
-                        args[0],
-                        args[1],
-                        window_movement_strides,
-                        window_dilation_strides,
-                        padding_below,
-                        padding_above,
-                        data_dilation_strides_maybe.get<std::vector<size_t>>());
-                }
-                break;
-            }
-            case OP_TYPEID::ConvolutionBackpropData:
-            {
-                auto data_batch_shape = node_js.at("data_batch_shape").get<vector<size_t>>();
-                auto window_movement_strides_forward =
-                    node_js.at("window_movement_strides_forward").get<vector<size_t>>();
-                auto window_dilation_strides_forward =
-                    node_js.at("window_dilation_strides_forward").get<vector<size_t>>();
-                auto padding_below_forward =
-                    node_js.at("padding_below_forward").get<vector<std::ptrdiff_t>>();
-                auto padding_above_forward =
-                    node_js.at("padding_above_forward").get<vector<std::ptrdiff_t>>();
-                auto data_dilation_strides_forward =
-                    node_js.at("data_dilation_strides_forward").get<vector<size_t>>();
-                node = make_shared<op::ConvolutionBackpropData>(data_batch_shape,
-                                                                args[0],
-                                                                args[1],
-                                                                window_movement_strides_forward,
-                                                                window_dilation_strides_forward,
-                                                                padding_below_forward,
-                                                                padding_above_forward,
-                                                                data_dilation_strides_forward);
-                break;
-            }
-            case OP_TYPEID::ConvolutionBackpropFilters:
-            {
-                auto filters_shape = node_js.at("filters_shape").get<vector<size_t>>();
-                auto window_movement_strides_forward =
-                    node_js.at("window_movement_strides_forward").get<vector<size_t>>();
-                auto window_dilation_strides_forward =
-                    node_js.at("window_dilation_strides_forward").get<vector<size_t>>();
-                auto padding_below_forward =
-                    node_js.at("padding_below_forward").get<vector<std::ptrdiff_t>>();
-                auto padding_above_forward =
-                    node_js.at("padding_above_forward").get<vector<std::ptrdiff_t>>();
-                auto data_dilation_strides_forward =
-                    node_js.at("data_dilation_strides_forward").get<vector<size_t>>();
-                node = make_shared<op::ConvolutionBackpropFilters>(args[0],
-                                                                   filters_shape,
-                                                                   args[1],
-                                                                   window_movement_strides_forward,
-                                                                   window_dilation_strides_forward,
-                                                                   padding_below_forward,
-                                                                   padding_above_forward,
-                                                                   data_dilation_strides_forward);
-                break;
-            }
-            case OP_TYPEID::Cos:
-            {
-                node = make_shared<op::Cos>(args[0]);
-                break;
-            }
-            case OP_TYPEID::Cosh:
-            {
-                node = make_shared<op::Cosh>(args[0]);
-                break;
-            }
-            case OP_TYPEID::Dequantize:
-            {
-                auto type = read_element_type(node_js.at("type"));
-                auto axes = node_js.at("axes").get<set<size_t>>();
-                node = make_shared<op::Dequantize>(args[0], args[1], args[2], type, axes);
-                break;
-            }
-            case OP_TYPEID::Divide:
-            {
-                node = make_shared<op::Divide>(args[0], args[1]);
-                break;
-            }
-            case OP_TYPEID::Dot:
+// Builds the nodes of ops in topological order. Each op is assigned to a wave one past the
+// latest wave of its arguments, and the ops of a wave are built concurrently. The new nodes
+// are only added to the users of their arguments, and given their control dependencies, once
+// the whole wave is built.
+static vector<shared_ptr<Node>>
+    build_nodes(vector<SerializedOp>& ops,
+                const function<const_data_callback_t>& const_data_callback,
+                const string& format,
+                const serializer::NodeHooks* hooks)
+{
+    vector<size_t> op_wave(ops.size());
+    vector<vector<size_t>> waves;
+    for (size_t i = 0; i < ops.size(); i++)
+    {
+        size_t wave = 0;
+        for (const vector<size_t>* deps : {&ops[i].inputs, &ops[i].control_deps})
+        {
+            for (size_t dep : *deps)
             {
-                // For backwards compatibility, reduction_axes_count is optional.
-                auto obj = node_js["reduction_axes_count"];
-                if (obj.empty())
-                {
-                    node = make_shared<op::Dot>(args[0], args[1]);
-                }
-                else
+                if (dep >= i)
                 {
-                    size_t reduction_axes_count = obj.get<size_t>();
-                    node = make_shared<op::Dot>(args[0], args[1], reduction_axes_count);
+                    throw ngraph_error("Node '" + ops[i].name + "' precedes its arguments");
                 }
-                break;
-            }
-            case OP_TYPEID::EmbeddingLookup:
-            {
-                node = make_shared<op::EmbeddingLookup>(args[0], args[1]);
-                break;
-            }
-            case OP_TYPEID::Equal:
-            {
-                node = make_shared<op::Equal>(args[0], args[1]);
-                break;
-            }
-            case OP_TYPEID::Exp:
-            {
-                node = make_shared<op::Exp>(args[0]);
-                break;
-            }
-            case OP_TYPEID::Floor:
-            {
-                node = make_shared<op::Floor>(args[0]);
-                break;
-            }
-            case OP_TYPEID::GenerateMask:
-            {
-                auto output_shape = node_js.at("output_shape").get<vector<size_t>>();
-                auto type = read_element_type(node_js.at("type"));
-                auto seed = node_js.at("seed").get<unsigned int>();
-                auto probability = node_js.at("probability").get<double>();
-
-                node =
-                    make_shared<op::GenerateMask>(args[0], output_shape, type, seed, probability);
-                break;
-            }
-            case OP_TYPEID::GetOutputElement:
-            {
-                node = make_shared<op::GetOutputElement>(args[0], node_js.at("n").get<size_t>());
-                break;
-            }
-            case OP_TYPEID::Greater:
-            {
-                node = make_shared<op::Greater>(args[0], args[1]);
-                break;
-            }
-            case OP_TYPEID::GreaterEq:
-            {
-                node = make_shared<op::GreaterEq>(args[0], args[1]);
-                break;
-            }
-            case OP_TYPEID::Less:
-            {
-                node = make_shared<op::Less>(args[0], args[1]);
-                break;
+                wave = max(wave, op_wave[dep] + 1);
             }
-            case OP_TYPEID::LessEq:
-            {
-                node = make_shared<op::LessEq>(args[0], args[1]);
-                break;
-            }
-            case OP_TYPEID::Log:
-            {
-                node = make_shared<op::Log>(args[0]);
-                break;
-            }
-            case OP_TYPEID::LRN:
-            {
-                auto alpha = node_js.at("alpha").get<double>();
-                auto beta = node_js.at("beta").get<double>();
-                auto bias = node_js.at("bias").get<double>();
-                auto nsize = node_js.at("nsize").get<size_t>();
-                node = make_shared<op::LRN>(args[0], alpha, beta, bias, nsize);
-                break;
-            }
-            case OP_TYPEID::Max:
-            {
-                auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
-                node = make_shared<op::Max>(args[0], reduction_axes);
-                break;
-            }
-            case OP_TYPEID::MaxPool:
+        }
+        op_wave[i] = wave;
+        if (waves.size() <= wave)
+        {
+            waves.resize(wave + 1);
+        }
+        waves[wave].push_back(i);
+    }
+
+    vector<shared_ptr<Node>> nodes(ops.size());
+    for (const vector<size_t>& wave : waves)
+    {
+        vector<vector<descriptor::Input*>> connections(wave.size());
+        parallel_for(0, wave.size(), [&](size_t i) {
+            size_t index = wave[i];
+            SerializedOp& op = ops[index];
+            descriptor::DeferredConnections deferred_connections;
+            try
             {
-                auto window_shape = node_js.at("window_shape").get<vector<size_t>>();
-                auto window_movement_strides =
-                    node_js.at("window_movement_strides").get<vector<size_t>>();
-                // For backwards compatibility, both (but not just one) of the padding_ fields may be
-                // omitted.
-                auto padding_below_maybe = node_js["padding_below"];
-                auto padding_above_maybe = node_js["padding_above"];
-                if (padding_below_maybe.empty() && !padding_above_maybe.empty())
-                {
-                    throw runtime_error(
-                        "MaxPool: padding_below is absent but padding_above is present");
-                }
-                else if (!padding_below_maybe.empty() && padding_above_maybe.empty())
+                vector<shared_ptr<Node>> args;
+                for (size_t input : op.inputs)
                 {
-                    throw runtime_error(
-                        "MaxPool: padding_below is present but padding_above is absent");
+                    args.push_back(nodes[input]);
                 }
-                else if (!padding_below_maybe.empty() && !padding_above_maybe.empty())
+                shared_ptr<Node> node;
+                if (op.typed_attributes_begin)
                 {
-                    auto padding_below = padding_below_maybe.get<vector<size_t>>();
-                    auto padding_above = padding_above_maybe.get<vector<size_t>>();
-                    node = make_shared<op::MaxPool>(args[0],
-                                                    window_shape,
-                                                    window_movement_strides,
-                                                    padding_below,
-                                                    padding_above);
+                    BinaryReader reader(op.typed_attributes_begin, op.typed_attributes_end);
+                    node = reader.read_op(op.type_id, op.name, op.op, args, const_data_callback);
+                    if (!reader.at_end())
+                    {
+                        throw ngraph_error("Unread attributes");
+                    }
                 }
                 else
                 {
-                    node = make_shared<op::MaxPool>(args[0], window_shape, window_movement_strides);
+                    node = read_node(
+                        op.attributes, op.type_id, op.name, op.op, args, const_data_callback);
                 }
-                break;
-            }
-            case OP_TYPEID::MaxPoolBackprop:
-            {
-                auto window_shape = node_js.at("window_shape").get<vector<size_t>>();
-                auto window_movement_strides =
-                    node_js.at("window_movement_strides").get<vector<size_t>>();
-                auto padding_below = node_js.at("padding_below").get<vector<size_t>>();
-                auto padding_above = node_js.at("padding_above").get<vector<size_t>>();
-                if (args.size() == 3)
+                if (node == nullptr)
                 {
-                    node = make_shared<op::MaxPoolBackprop>(args[0],
-                                                            args[1],
-                                                            args[2],
-                                                            window_shape,
-                                                            window_movement_strides,
-                                                            padding_below,
-                                                            padding_above);
+                    throw ngraph_error("No data for " + op.name);
                 }
-                else
+                if (hooks && hooks->read)
                 {
-                    node = make_shared<op::MaxPoolBackprop>(args[0],
-                                                            args[1],
-                                                            window_shape,
-                                                            window_movement_strides,
-                                                            padding_below,
-                                                            padding_above);
+                    hooks->read(*node, op.attributes);
                 }
-                break;
-            }
-            case OP_TYPEID::Maximum:
-            {
-                node = make_shared<op::Maximum>(args[0], args[1]);
-                break;
-            }
-            case OP_TYPEID::Min:
-            {
-                auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
-                node = make_shared<op::Min>(args[0], reduction_axes);
-                break;
-            }
-            case OP_TYPEID::Minimum:
-            {
-                node = make_shared<op::Minimum>(args[0], args[1]);
-                break;
-            }
-            case OP_TYPEID::Multiply:
-            {
-                node = make_shared<op::Multiply>(args[0], args[1]);
-                break;
-            }
-            case OP_TYPEID::Negative:
-            {
-                node = make_shared<op::Negative>(args[0]);
-                break;
-            }
-            case OP_TYPEID::NotEqual:
-            {
-                node = make_shared<op::NotEqual>(args[0], args[1]);
-                break;
-            }
-            case OP_TYPEID::Not:
-            {
-                node = make_shared<op::Not>(args[0]);
-                break;
-            }
-            case OP_TYPEID::OneHot:
-            {
-                auto shape = node_js.at("shape").get<vector<size_t>>();
-                auto one_hot_axis = node_js.at("one_hot_axis").get<size_t>();
-                node = make_shared<op::OneHot>(args[0], read_partial_shape(shape), one_hot_axis);
-                break;
-            }
-            case OP_TYPEID::Or:
-            {
-                node = make_shared<op::Or>(args[0], args[1]);
-                break;
-            }
-            case OP_TYPEID::Pad:
-            {
-                auto padding_below = node_js.at("padding_below").get<vector<size_t>>();
-                auto padding_above = node_js.at("padding_above").get<vector<size_t>>();
-                auto padding_interior = node_js.at("padding_interior").get<vector<size_t>>();
-                node = make_shared<op::Pad>(
-                    args[0], args[1], padding_below, padding_above, padding_interior);
-                break;
-            }
-            case OP_TYPEID::Parameter:
-            {
-                auto type_node_js =
-                    node_js.count("element_type") == 0 ? node_js.at("value_type") : node_js;
-                auto element_type = read_element_type(type_node_js.at("element_type"));
-                auto shape = type_node_js.at("shape");
-                auto cacheable = get_or_default<bool>(node_js, "cacheable", false);
-                node =
-                    make_shared<op::Parameter>(element_type, read_partial_shape(shape), cacheable);
-                break;
-            }
-            case OP_TYPEID::Power:
-            {
-                node = make_shared<op::Power>(args[0], args[1]);
-                break;
-            }
-            case OP_TYPEID::Product:
-            {
-                auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
-                node = make_shared<op::Product>(args[0], reduction_axes);
-                break;
-            }
-            case OP_TYPEID::Quantize:
-            {
-                auto type = read_element_type(node_js.at("type"));
-                auto axes = node_js.at("axes").get<set<size_t>>();
-                auto round_mode = node_js.at("round_mode").get<op::Quantize::RoundMode>();
-                node = make_shared<op::Quantize>(args[0], args[1], args[2], type, axes, round_mode);
-                break;
-            }
-            case OP_TYPEID::Relu:
-            {
-                node = make_shared<op::Relu>(args[0]);
-                break;
-            }
-            case OP_TYPEID::ReluBackprop:
-            {
-                node = make_shared<op::ReluBackprop>(args[0], args[1]);
-                break;
-            }
-            case OP_TYPEID::ReplaceSlice:
-            {
-                auto lower_bounds = node_js.at("lower_bounds").get<vector<size_t>>();
-                auto upper_bounds = node_js.at("upper_bounds").get<vector<size_t>>();
-                auto strides = node_js.at("strides").get<vector<size_t>>();
-                node = make_shared<op::ReplaceSlice>(
-                    args[0], args[1], lower_bounds, upper_bounds, strides);
-                break;
-            }
-            case OP_TYPEID::Reshape:
-            {
-                auto input_order = node_js.at("input_order").get<vector<size_t>>();
-                auto output_shape = node_js.at("output_shape").get<vector<size_t>>();
-                node = make_shared<op::Reshape>(args[0], input_order, output_shape);
-                break;
-            }
-            case OP_TYPEID::Result:
-            {
-                node = make_shared<op::Result>(args[0]);
-                break;
-            }
-            case OP_TYPEID::Reverse:
-            {
-                auto reversed_axes = node_js.at("reversed_axes").get<set<size_t>>();
-                node = make_shared<op::Reverse>(args[0], reversed_axes);
-                break;
-            }
-            case OP_TYPEID::ReverseSequence:
-            {
-                auto batch_axis = node_js.at("batch_axis").get<size_t>();
-                auto sequence_axis = node_js.at("sequence_axis").get<size_t>();
-                node =
-                    make_shared<op::ReverseSequence>(args[0], args[1], batch_axis, sequence_axis);
-                break;
-            }
-            case OP_TYPEID::ScalarConstantLike:
-            {
-                double value = node_js.at("value").get<double>();
-                node = make_shared<op::ScalarConstantLike>(args[0], value);
-                break;
-            }
-            case OP_TYPEID::Select:
-            {
-                node = make_shared<op::Select>(args[0], args[1], args[2]);
-                break;
-            }
-            case OP_TYPEID::ShapeOf:
-            {
-                node = make_shared<op::ShapeOf>(args[0]);
-                break;
-            }
-            case OP_TYPEID::Sigmoid:
-            {
-                node = make_shared<op::Sigmoid>(args[0]);
-                break;
-            }
-            case OP_TYPEID::SigmoidBackprop:
-            {
-                node = make_shared<op::SigmoidBackprop>(args[0], args[1]);
-                break;
-            }
-            case OP_TYPEID::Sign:
-            {
-                node = make_shared<op::Sign>(args[0]);
-                break;
-            }
-            case OP_TYPEID::Sin:
-            {
-                node = make_shared<op::Sin>(args[0]);
-                break;
-            }
-            case OP_TYPEID::Sinh:
-            {
-                node = make_shared<op::Sinh>(args[0]);
-                break;
-            }
-            case OP_TYPEID::Slice:
-            {
-                auto lower_bounds = node_js.at("lower_bounds").get<vector<size_t>>();
-                auto upper_bounds = node_js.at("upper_bounds").get<vector<size_t>>();
-                auto strides = node_js.at("strides").get<vector<size_t>>();
-                node = make_shared<op::Slice>(args[0], lower_bounds, upper_bounds, strides);
-                break;
-            }
-            case OP_TYPEID::Softmax:
-            {
-                auto softmax_axes = node_js.at("softmax_axes").get<set<size_t>>();
-                node = make_shared<op::Softmax>(args[0], softmax_axes);
-                break;
-            }
-            case OP_TYPEID::Sqrt:
-            {
-                node = make_shared<op::Sqrt>(args[0]);
-                break;
-            }
-            case OP_TYPEID::Subtract:
-            {
-                node = make_shared<op::Subtract>(args[0], args[1]);
-                break;
-            }
-            case OP_TYPEID::Sum:
-            {
-                auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
-                node = make_shared<op::Sum>(args[0], reduction_axes);
-                break;
-            }
-            case OP_TYPEID::Tan:
-            {
-                node = make_shared<op::Tan>(args[0]);
-                break;
-            }
-            case OP_TYPEID::Tanh:
-            {
-                node = make_shared<op::Tanh>(args[0]);
-                break;
-            }
-            case OP_TYPEID::TopK:
-            {
-                auto top_k_axis = node_js.at("top_k_axis").get<size_t>();
-                auto k = node_js.at("k").get<size_t>();
-                auto compute_max = node_js.at("compute_max").get<bool>();
-                auto target_type = read_element_type(node_js.at("index_element_type"));
-                node = make_shared<op::TopK>(args[0], top_k_axis, target_type, k, compute_max);
-                break;
-            }
-            case OP_TYPEID::StopGradient:
-            {
-                node = make_shared<op::StopGradient>(args[0]);
-                break;
-            }
-            case OP_TYPEID::UnknownOp:
-            {
-                stringstream ss;
-                ss << "unsupported op " << node_op;
-                throw runtime_error(ss.str());
-            }
-            }
-#pragma GCC diagnostic pop
+                nodes[index] = node;
+                op.attributes = nullptr;
 
-            for (const string& name : control_deps_inputs)
+                // Typically, it could be unsafe to change the name of a node since it may break
+                // nameing uniqueness. However, it could sometimes be helpful to use the original
+                // name from the serialization for debugging.
+                // node->set_name(op.name);
+            }
+            catch (...)
             {
-                node->add_control_dependency(node_map.at(name));
+                throw runtime_error("Error parsing " + format + " at node '" + op.name + "'");
             }
-
-            node_map[node_name] = node;
-
-            // Typically, it could be unsafe to change the name of a node since it may break nameing
-            // uniqueness. However, it could sometimes be helpful to use the original name from
-            // the serialization for debugging.
-            // node->set_name(node_name);
-        }
-        catch (...)
+            connections[i] = deferred_connections.release();
+        });
+        for (size_t i = 0; i < wave.size(); i++)
         {
-            string node_name;
-            try
+            for (descriptor::Input* input : connections[i])
             {
-                node_name = node_js.at("name").get<string>();
+                input->connect();
             }
-            catch (...)
+            for (size_t cdep : ops[wave[i]].control_deps)
             {
-                node_name = "UNKNOWN";
+                nodes[wave[i]]->add_control_dependency(nodes[cdep]);
             }
-            throw runtime_error("Error parsing json at node '" + node_name + "'");
         }
     }
+    return nodes;
+}
 
+// Creates a deserialized function from its output and parameter nodes
+static shared_ptr<ngraph::Function>
+    make_function(const string& func_name, const NodeVector& outputs, const NodeVector& parameters)
+{
     // This handles both graphs w/ `op::Result` and legacy graphs w/o it
     // If we are dealing w/ a legacy graph, add op::Result for each output node
     ResultVector result;
     size_t results = 0;
-    for (auto result_name : func_result)
+    for (auto fr : outputs)
     {
-        auto fr = node_map.at(result_name);
         if (auto res = std::dynamic_pointer_cast<op::Result>(fr))
         {
             result.push_back(res);
@@ -1152,24 +2940,94 @@ static shared_ptr<ngraph::Function>
         }
     }
 
-    if (results != 0 && results != func_result.size())
+    if (results != 0 && results != outputs.size())
     {
         throw ngraph_error(
             " Graph serialization is inconsistent. Some op::Results appear to be missing");
     }
 
     std::vector<std::shared_ptr<op::Parameter>> params;
+    for (auto param : parameters)
+    {
+        params.push_back(dynamic_pointer_cast<op::Parameter>(param));
+    }
+
+    return make_shared<Function>(result, params, func_name);
+}
+
+static shared_ptr<ngraph::Function>
+    read_function(const json& func_js,
+                  unordered_map<string, shared_ptr<Function>>& function_map,
+                  function<const_data_callback_t> const_data_callback,
+                  const serializer::NodeHooks* hooks)
+{
+    shared_ptr<ngraph::Function> rc;
+
+    string func_name = func_js.at("name").get<string>();
+    vector<string> func_parameters = func_js.at("parameters").get<vector<string>>();
+    vector<string> func_result = func_js.at("result").get<vector<string>>();
+    unordered_map<string, size_t> op_map;
+    vector<SerializedOp> ops;
+    for (json node_js : func_js.at("ops"))
+    {
+        SerializedOp op;
+        try
+        {
+            op.name = node_js.at("name").get<string>();
+            op.op = node_js.at("op").get<string>();
+            op.type_id = get_typeid(op.op);
+            for (const string& name : node_js.at("inputs").get<vector<string>>())
+            {
+                op.inputs.push_back(op_map.at(name));
+            }
+            for (const string& name :
+                 get_or_default<vector<string>>(node_js, "control_deps", vector<string>{}))
+            {
+                op.control_deps.push_back(op_map.at(name));
+            }
+        }
+        catch (...)
+        {
+            if (op.name.empty())
+            {
+                op.name = "UNKNOWN";
+            }
+            throw runtime_error("Error parsing json at node '" + op.name + "'");
+        }
+        op_map[op.name] = ops.size();
+        op.attributes = move(node_js);
+        ops.push_back(move(op));
+    }
+    vector<shared_ptr<Node>> nodes = build_nodes(ops, const_data_callback, "json", hooks);
+
+    NodeVector outputs;
+    for (auto result_name : func_result)
+    {
+        outputs.push_back(nodes.at(op_map.at(result_name)));
+    }
+    NodeVector parameters;
     for (auto param_name : func_parameters)
     {
-        params.push_back(dynamic_pointer_cast<op::Parameter>(node_map.at(param_name)));
+        parameters.push_back(nodes.at(op_map.at(param_name)));
     }
 
-    rc = make_shared<Function>(result, params, func_name);
+    rc = make_function(func_name, outputs, parameters);
     function_map[func_name] = rc;
 
     return rc;
 }
 
+// Everything in the json of a node other than its name and connections is an attribute of the op
+static json write_attributes(const Node& n)
+{
+    json attributes = write(n, true);
+    for (const char* key : {"name", "op", "inputs", "control_deps", "outputs", "output_shapes"})
+    {
+        attributes.erase(key);
+    }
+    return attributes;
+}
+
 static json write(const Node& n, bool binary_constant_data)
 {
     json node;
@@ -1602,7 +3460,13 @@ static json write(const Node& n, bool binary_constant_data)
         node["compute_max"] = tmp->get_compute_max();
         break;
     }
-    case OP_TYPEID::UnknownOp: { break;
+    case OP_TYPEID::UnknownOp:
+    {
+        if (const RegisteredOp* registered_op = find_registered_op(node_op))
+        {
+            registered_op->writer(n, node);
+        }
+        break;
     }
     }
 #pragma GCC diagnostic pop
@@ -30,23 +30,31 @@ namespace ngraph
     ///    indent level specified.
     std::string serialize(std::shared_ptr<ngraph::Function> func, size_t indent = 0);
 
-    /// \brief Serialize a Function to as a json file
+    /// \brief Serialize a Function to a file with all constant data stored as binary
     /// \param path The path to the output file
     /// \param func The Function to serialize
-    /// \param indent If 0 then there is no formatting applied and the resulting string is the
-    ///    most compact representation. If non-zero then the json string is formatted with the
-    ///    indent level specified.
+    /// \param indent If 0 then the graph is stored in the compact binary format, unless the
+    ///    NGRAPH_SERIALIZER_JSON environment variable is set. If non-zero then the graph is
+    ///    stored as json formatted with the indent level specified.
+    /// \param alignment If non-zero, constant data is aligned to this many bytes within the
+    ///    file. Use the page size to allow deserialize_mapped to map constants without copying.
     void serialize(const std::string& path,
                    std::shared_ptr<ngraph::Function> func,
-                   size_t indent = 0);
+                   size_t indent = 0,
+                   size_t alignment = 0);
 
-    /// \brief Serialize a Function to a CPIO file with all constant data stored as binary
+    /// \brief Serialize a Function to a stream with all constant data stored as binary
     /// \param out The output stream to which the data is serialized.
     /// \param func The Function to serialize
-    /// \param indent If 0 then there is no formatting applied and the json is the
-    ///    most compact representation. If non-zero then the json is formatted with the
-    ///    indent level specified.
-    void serialize(std::ostream& out, std::shared_ptr<ngraph::Function> func, size_t indent = 0);
+    /// \param indent If 0 then the graph is stored in the compact binary format, unless the
+    ///    NGRAPH_SERIALIZER_JSON environment variable is set. If non-zero then the graph is
+    ///    stored as json formatted with the indent level specified.
+    /// \param alignment If non-zero, constant data is aligned to this many bytes from the
+    ///    start of the stream.
+    void serialize(std::ostream& out,
+                   std::shared_ptr<ngraph::Function> func,
+                   size_t indent = 0,
+                   size_t alignment = 0);
 
     /// \brief Deserialize a Function
     /// \param in An isteam to the input data
@@ -55,4 +63,13 @@ namespace ngraph
     /// \brief Deserialize a Function
     /// \param str The json formatted string to deseriailze.
     std::shared_ptr<ngraph::Function> deserialize(const std::string& str);
+
+    /// \brief Deserialize a Function from a CPIO file without copying its constant data.
+    ///        The file is mapped read-only and constants point directly into the mapping,
+    ///        so pages are loaded lazily and shared between processes loading the same
+    ///        model. The mapping stays alive as long as any of the constants do. Constants
+    ///        whose data is not aligned to their element size are copied. Files written
+    ///        with serialize and a page size alignment map every constant.
+    /// \param path The path of the CPIO file.
+    std::shared_ptr<ngraph::Function> deserialize_mapped(const std::string& path);
 }
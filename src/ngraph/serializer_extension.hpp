@@ -0,0 +1,80 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "ngraph/function.hpp"
+#include "ngraph/node.hpp"
+#include "nlohmann/json.hpp"
+
+namespace ngraph
+{
+    namespace serializer
+    {
+        /// \brief Writes the attributes of an op to its json
+        using OpWriter = std::function<void(const Node&, nlohmann::json&)>;
+
+        /// \brief Builds an op from its json attributes and arguments
+        using OpReader =
+            std::function<std::shared_ptr<Node>(const nlohmann::json&, const NodeVector&)>;
+
+        /// \brief Registers the serialization of an op the serializer does not know, such as
+        ///        the ops backends add to a graph. Ops are matched by their description.
+        ///        Registration should happen before functions containing the op are
+        ///        serialized or deserialized.
+        void register_op(const std::string& description, OpWriter writer, OpReader reader);
+
+        /// \brief Returns true if nodes with this description can be serialized
+        bool is_supported_op(const std::string& description);
+
+        /// \brief Hooks called for every node of a function, used to save state attached to
+        ///        nodes and their tensors, such as backend annotations and layouts. write adds
+        ///        to a json object that read is given back, which only holds the attributes of
+        ///        the op for registered ops. read is called once the node is built and may run
+        ///        concurrently for different nodes.
+        struct NodeHooks
+        {
+            std::function<void(const Node&, nlohmann::json&)> write;
+            std::function<void(Node&, const nlohmann::json&)> read;
+        };
+
+        /// \brief Serialize a Function to a stream in the binary format, calling hooks.write
+        ///        for every node.
+        void serialize(std::ostream& out,
+                       std::shared_ptr<ngraph::Function> func,
+                       const NodeHooks& hooks,
+                       size_t alignment = 0);
+
+        /// \brief Deserialize a Function from a stream, calling hooks.read for every node.
+        std::shared_ptr<ngraph::Function> deserialize(std::istream& in, const NodeHooks& hooks);
+
+        /// \brief Returns a byte string describing the ops, attributes, connections and
+        ///        constant data of a function and the functions it calls, with constant data
+        ///        reduced to a hash. Node names do not contribute, so identical graphs built
+        ///        separately have the same signature. Throws if the function contains an op
+        ///        that cannot be serialized.
+        std::string signature(std::shared_ptr<ngraph::Function> func);
+
+        /// \brief Returns a hash of the signature of a function
+        uint64_t hash(std::shared_ptr<ngraph::Function> func);
+    }
+}
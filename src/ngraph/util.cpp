@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <deque>
 #include <forward_list>
 #include <iomanip>
@@ -160,6 +161,26 @@ size_t ngraph::hash_combine(const std::vector<size_t>& list)
     return seed;
 }
 
+uint64_t ngraph::hash_bytes(const void* data, size_t size)
+{
+    // FNV-1a, consuming eight bytes per step
+    const uint64_t prime = 0x100000001b3ULL;
+    uint64_t rc = 0xcbf29ce484222325ULL ^ size;
+    const char* p = static_cast<const char*>(data);
+    size_t words = size / sizeof(uint64_t);
+    for (size_t i = 0; i < words; i++)
+    {
+        uint64_t word;
+        memcpy(&word, p + i * sizeof(uint64_t), sizeof(uint64_t));
+        rc = (rc ^ word) * prime;
+    }
+    for (size_t i = words * sizeof(uint64_t); i < size; i++)
+    {
+        rc = (rc ^ static_cast<uint8_t>(p[i])) * prime;
+    }
+    return rc;
+}
+
 void* ngraph::aligned_alloc(size_t alignment, size_t size)
 {
 #ifdef __APPLE__
@@ -71,6 +71,8 @@ namespace ngraph
     }
 
     size_t hash_combine(const std::vector<size_t>& list);
+    /// \brief Returns a 64 bit FNV-1a style hash of size bytes starting at data
+    uint64_t hash_bytes(const void* data, size_t size);
     void dump(std::ostream& out, const void*, size_t);
 
     std::string to_lower(const std::string& s);
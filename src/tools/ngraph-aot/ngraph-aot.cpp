@@ -0,0 +1,273 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+// Tool to compile a serialized model ahead of time into a shared library.
+// The CPU backend passes and code emitter generate the source, which is then built by the
+// system compiler. The library exports extern "C" void entry(void** inputs, void** outputs)
+// and only needs libngraph and libcpu_kernels at runtime, not the CPU backend or codegen.
+// Both are found in the install prefix of the tool, the library looks for them next to itself
+// first.
+
+#include <climits>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+
+#include "ngraph/file_util.hpp"
+#include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/serializer.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+void help()
+{
+    cout << R"###(
+DESCRIPTION
+    Compile a serialized model ahead of time into a shared library
+
+SYNOPSIS
+        ngraph-aot [-i|--input <input file>] [-o|--output <output directory>]
+                   [-n|--name <name>] [-e|--entry <symbol>] [-s|--source-only]
+                   [--cxx <compiler>] [--cxxflags <flags>] [--prefix <directory>]
+                   [--include-dir <directory>] [--lib-dir <directory>]
+
+OPTIONS
+        -i or --input       input serialized model
+        -o or --output      directory receiving <name>.cpp, <name>.hpp and lib<name>.so
+        -n or --name        base name of the generated files, defaults to model
+        -e or --entry       name of the exported function, defaults to entry
+        -s or --source-only only generate the source and header
+        --cxx               compiler building the library, defaults to $CXX or c++
+        --cxxflags          extra flags for the compiler, defaults to -O3 -march=native
+        --prefix            nGraph install prefix, defaults to the parent of the directory
+                            holding ngraph-aot
+        --include-dir       directory holding the nGraph headers, defaults to
+                            <prefix>/)###" NGRAPH_INSTALL_INCLUDE_DIR R"###(
+        --lib-dir           directory holding libngraph and libcpu_kernels, defaults to
+                            <prefix>/)###" NGRAPH_INSTALL_LIB_DIR R"###(
+)###";
+}
+
+static string describe(const descriptor::Tensor& tensor)
+{
+    stringstream ss;
+    ss << tensor.get_element_type().c_type_string() << " " << tensor.get_shape();
+    return ss.str();
+}
+
+static string emit_header(const Function& function, const string& entry)
+{
+    stringstream ss;
+    ss << "// Generated by ngraph-aot\n";
+    ss << "#pragma once\n\n";
+    ss << "#ifdef __cplusplus\n";
+    ss << "extern \"C\" {\n";
+    ss << "#endif\n\n";
+    ss << "// Buffers are dense and in row-major order\n";
+    for (size_t i = 0; i < function.get_parameters().size(); i++)
+    {
+        const descriptor::Tensor& tensor = function.get_parameters()[i]->get_output_tensor(0);
+        ss << "//     inputs[" << i << "]: " << describe(tensor) << "\n";
+    }
+    for (size_t i = 0; i < function.get_output_size(); i++)
+    {
+        const descriptor::Tensor& tensor = function.get_output_op(i)->get_output_tensor(0);
+        ss << "//     outputs[" << i << "]: " << describe(tensor) << "\n";
+    }
+    ss << "// May be called from several threads at once\n";
+    ss << "void " << entry << "(void** inputs, void** outputs);\n\n";
+    ss << "#ifdef __cplusplus\n";
+    ss << "}\n";
+    ss << "#endif\n";
+    return ss.str();
+}
+
+// Returns the parent of the directory holding this executable
+static string get_install_prefix()
+{
+    char path[PATH_MAX];
+    ssize_t size = readlink("/proc/self/exe", path, sizeof(path) - 1);
+    if (size <= 0)
+    {
+        return "..";
+    }
+    path[size] = 0;
+    return file_util::get_directory(file_util::get_directory(path));
+}
+
+static string compile_command(const string& cxx,
+                              const string& cxxflags,
+                              const string& include_dir,
+                              const string& lib_dir,
+                              const string& source,
+                              const string& library)
+{
+    vector<string> include_paths;
+#ifdef EIGEN_HEADERS_PATH
+    include_paths.push_back(EIGEN_HEADERS_PATH);
+#endif
+#ifdef MKLDNN_HEADERS_PATH
+    include_paths.push_back(MKLDNN_HEADERS_PATH);
+#endif
+#ifdef TBB_HEADERS_PATH
+    include_paths.push_back(TBB_HEADERS_PATH);
+#endif
+    include_paths.push_back(include_dir);
+
+    stringstream ss;
+    ss << cxx << " -std=c++11 -shared -fPIC -DEIGEN_MPL2_ONLY " << cxxflags;
+    for (const string& path : include_paths)
+    {
+        ss << " -I\"" << path << "\"";
+    }
+    ss << " \"" << source << "\" -o \"" << library << "\"";
+    ss << " -L\"" << lib_dir << "\" -Wl,-rpath,'$ORIGIN' -Wl,-rpath,\"" << lib_dir << "\"";
+    ss << " -lcpu_kernels -lngraph";
+    return ss.str();
+}
+
+int main(int argc, char** argv)
+{
+    string input;
+    string output = ".";
+    string name = "model";
+    string entry = "entry";
+    string cxx = getenv("CXX") ? getenv("CXX") : "c++";
+    string cxxflags = "-O3 -march=native";
+    bool source_only = false;
+    string prefix;
+    string include_dir;
+    string lib_dir;
+    for (size_t i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg == "-o" || arg == "--output")
+        {
+            output = argv[++i];
+        }
+        else if (arg == "-i" || arg == "--input")
+        {
+            input = argv[++i];
+        }
+        else if (arg == "-n" || arg == "--name")
+        {
+            name = argv[++i];
+        }
+        else if (arg == "-e" || arg == "--entry")
+        {
+            entry = argv[++i];
+        }
+        else if (arg == "-s" || arg == "--source-only")
+        {
+            source_only = true;
+        }
+        else if (arg == "--cxx")
+        {
+            cxx = argv[++i];
+        }
+        else if (arg == "--cxxflags")
+        {
+            cxxflags = argv[++i];
+        }
+        else if (arg == "--prefix")
+        {
+            prefix = argv[++i];
+        }
+        else if (arg == "--include-dir")
+        {
+            include_dir = argv[++i];
+        }
+        else if (arg == "--lib-dir")
+        {
+            lib_dir = argv[++i];
+        }
+        else if (arg == "-h" || arg == "--help")
+        {
+            help();
+            return 0;
+        }
+    }
+
+    ifstream f(input);
+    if (!f)
+    {
+        cout << "failed to open '" << input << "' for input\n";
+        return 2;
+    }
+    shared_ptr<Function> function = deserialize(f);
+
+    // The header describes the function as given, before the passes rewrite it
+    string header = emit_header(*function, entry);
+
+    string source;
+    try
+    {
+        stopwatch timer;
+        timer.start();
+        auto external_function = make_shared<runtime::cpu::CPU_ExternalFunction>(function);
+        source = external_function->emit_standalone_source(entry);
+        timer.stop();
+        cout << "code generation took " << timer.get_milliseconds() << "ms\n";
+    }
+    catch (const exception& e)
+    {
+        cout << "failed to generate code: " << e.what() << "\n";
+        return 1;
+    }
+
+    file_util::make_directory(output);
+    string source_path = file_util::path_join(output, name + ".cpp");
+    string header_path = file_util::path_join(output, name + ".hpp");
+    string library_path = file_util::path_join(output, "lib" + name + ".so");
+    ofstream(source_path) << source;
+    ofstream(header_path) << header;
+    cout << "wrote " << source_path << " and " << header_path << "\n";
+
+    if (!source_only)
+    {
+        if (prefix.empty())
+        {
+            prefix = get_install_prefix();
+        }
+        if (include_dir.empty())
+        {
+            include_dir = file_util::path_join(prefix, NGRAPH_INSTALL_INCLUDE_DIR);
+        }
+        if (lib_dir.empty())
+        {
+            lib_dir = file_util::path_join(prefix, NGRAPH_INSTALL_LIB_DIR);
+        }
+        string command =
+            compile_command(cxx, cxxflags, include_dir, lib_dir, source_path, library_path);
+        stopwatch timer;
+        timer.start();
+        int rc = system(command.c_str());
+        timer.stop();
+        if (rc != 0)
+        {
+            cout << "failed to compile the library with:\n" << command << "\n";
+            return 1;
+        }
+        cout << "compiling " << library_path << " took " << timer.get_milliseconds() << "ms\n";
+    }
+
+    return 0;
+}
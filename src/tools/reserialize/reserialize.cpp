@@ -20,6 +20,7 @@
 // env LD_LIBRARY_PATH=$HOME/ngraph_dist/lib env NGRAPH_INTERPRETER_EMIT_TIMING=1 ./nbench
 // sample models are under ../../test/models
 
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
 #include <string>
@@ -36,11 +37,14 @@ DESCRIPTION
     Reserialize a serialized model
 
 SYNOPSIS
-        reserialize [-i|--input <input file>] [-o|--output <output file>]
+        reserialize [-i|--input <input file>] [-o|--output <output file>] [-a|--align <bytes>]
+                    [-j|--json]
 
 OPTIONS
         -i or --input  input serialized model
         -o or --output output serialized model
+        -a or --align  align constant data in the output, use 4096 for memory mapped loading
+        -j or --json   store the graph as formatted json instead of the binary format
 )###";
 }
 
@@ -48,6 +52,8 @@ int main(int argc, char** argv)
 {
     string input;
     string output;
+    size_t alignment = 0;
+    size_t indent = 0;
     for (size_t i = 1; i < argc; i++)
     {
         string arg = argv[i];
@@ -59,6 +65,14 @@ int main(int argc, char** argv)
         {
             input = argv[++i];
         }
+        else if (arg == "-a" || arg == "--align")
+        {
+            alignment = strtoul(argv[++i], nullptr, 10);
+        }
+        else if (arg == "-j" || arg == "--json")
+        {
+            indent = 2;
+        }
         else if (arg == "-h" || arg == "--help")
         {
             help();
@@ -76,7 +90,7 @@ int main(int argc, char** argv)
         cout << "deserialize took " << timer.get_milliseconds() << "ms\n";
 
         timer.start();
-        ngraph::serialize(output, function, 2);
+        ngraph::serialize(output, function, indent, alignment);
         timer.stop();
         cout << "serialize took   " << timer.get_milliseconds() << "ms\n";
     }
@@ -0,0 +1,146 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <sstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ngraph/archive.hpp"
+#include "ngraph/file_util.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+TEST(archive, write_read)
+{
+    const string test_file = "test1.ngar";
+    string s1 = "this is a test";
+    string s2 = "the quick brown fox jumps over the lazy dog";
+    {
+        archive::Writer writer(test_file, 128);
+        writer.add("file1.txt", s1.data(), s1.size());
+        writer.add("file.txt", s2.data(), s2.size());
+    }
+    EXPECT_TRUE(archive::is_archive(test_file));
+    {
+        archive::Reader reader(test_file);
+        auto records = reader.get_records();
+        ASSERT_EQ(2, records.size());
+        EXPECT_FALSE(reader.has_checksums());
+        EXPECT_EQ(reader.get_alignment(), 128);
+
+        EXPECT_STREQ(records[0].get_name().c_str(), "file1.txt");
+        EXPECT_STREQ(records[1].get_name().c_str(), "file.txt");
+        EXPECT_EQ(records[0].get_size(), 14);
+        EXPECT_EQ(records[1].get_size(), 43);
+        EXPECT_EQ(records[0].get_offset() % 128, 0);
+        EXPECT_EQ(records[1].get_offset() % 128, 0);
+
+        for (size_t i = 0; i < records.size(); i++)
+        {
+            string content(records[i].get_size(), 0);
+            reader.read(records[i], &content[0]);
+            EXPECT_STREQ(content.c_str(), (i == 0 ? s1 : s2).c_str());
+        }
+    }
+    file_util::remove_file(test_file);
+}
+
+TEST(archive, find)
+{
+    stringstream ss;
+    vector<int> values(1000);
+    {
+        archive::Writer writer(ss);
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            values[i] = static_cast<int>(i);
+            writer.add("record_" + to_string(i), &values[i], sizeof(int));
+        }
+    }
+    archive::Reader reader(ss);
+    EXPECT_EQ(reader.find("missing"), nullptr);
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        const archive::Record* record = reader.find("record_" + to_string(i));
+        ASSERT_NE(record, nullptr);
+        EXPECT_EQ(record->get_name(), "record_" + to_string(i));
+        int value;
+        reader.read(*record, &value);
+        EXPECT_EQ(value, i);
+    }
+}
+
+TEST(archive, checksum)
+{
+    stringstream ss;
+    string s1 = "checksummed data";
+    {
+        archive::Writer writer(ss, 64, true);
+        writer.add("data", s1.data(), s1.size());
+    }
+    {
+        archive::Reader reader(ss);
+        EXPECT_TRUE(reader.has_checksums());
+        string content(s1.size(), 0);
+        reader.read(*reader.find("data"), &content[0]);
+        EXPECT_EQ(content, s1);
+    }
+
+    // Corrupt the data
+    string bytes = ss.str();
+    bytes[bytes.size() - 1] ^= 1;
+    stringstream corrupt(bytes);
+    archive::Reader reader(corrupt);
+    string content(s1.size(), 0);
+    EXPECT_THROW(reader.read(*reader.find("data"), &content[0]), runtime_error);
+}
+
+TEST(archive, read_parallel)
+{
+    const string test_file = "test_parallel.ngar";
+    vector<vector<int>> contents(100);
+    {
+        archive::Writer writer(test_file, 64, true);
+        for (size_t i = 0; i < contents.size(); i++)
+        {
+            contents[i].assign(i * 100, static_cast<int>(i));
+            writer.add(
+                "data" + to_string(i), contents[i].data(), contents[i].size() * sizeof(int));
+        }
+    }
+    archive::Reader reader(test_file);
+    vector<const archive::Record*> records;
+    vector<vector<int>> results(contents.size());
+    vector<void*> data;
+    for (size_t i = 0; i < contents.size(); i++)
+    {
+        records.push_back(reader.find("data" + to_string(i)));
+        results[i].resize(contents[i].size());
+        data.push_back(results[i].data());
+    }
+    reader.read(records, data);
+    EXPECT_EQ(results, contents);
+    file_util::remove_file(test_file);
+}
+
+TEST(archive, not_an_archive)
+{
+    stringstream ss("not an archive at all, just some text");
+    EXPECT_FALSE(archive::is_archive(ss));
+    EXPECT_THROW(archive::Reader reader(ss), runtime_error);
+}
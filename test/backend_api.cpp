@@ -14,10 +14,15 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <numeric>
+
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/batching_executor.hpp"
+#include "ngraph/runtime/specialization_cache.hpp"
 #include "ngraph/util.hpp"
+#include "util/test_tools.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -34,3 +39,167 @@ TEST(backend_api, invalid_name)
 {
     ASSERT_ANY_THROW(ngraph::runtime::Backend::create("COMPLETELY-BOGUS-NAME"));
 }
+
+TEST(backend_api, specialization_cache)
+{
+    auto A = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 3});
+    auto f = make_shared<Function>(make_shared<op::Sum>(A * A, AxisSet{1}), ParameterVector{A});
+    EXPECT_TRUE(runtime::SpecializationCache::is_dynamic(*f));
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::SpecializationCache cache(f, 2);
+
+    auto a = backend->create_tensor(element::f32, Shape{2, 3});
+    copy_data(a, vector<float>{1, 2, 3, 4, 5, 6});
+    auto result = backend->create_tensor(element::f32, Shape{2});
+    cache.call(*backend, {result}, {a});
+    EXPECT_EQ((vector<float>{14, 77}), read_vector<float>(result));
+
+    a = backend->create_tensor(element::f32, Shape{1, 3});
+    copy_data(a, vector<float>{1, 1, 1});
+    result = backend->create_tensor(element::f32, Shape{1});
+    cache.call(*backend, {result}, {a});
+    EXPECT_EQ((vector<float>{3}), read_vector<float>(result));
+    EXPECT_EQ(2, cache.size());
+
+    // The least recently used shape is evicted
+    a = backend->create_tensor(element::f32, Shape{3, 3});
+    copy_data(a, vector<float>{1, 0, 0, 0, 2, 0, 0, 0, 3});
+    result = backend->create_tensor(element::f32, Shape{3});
+    cache.call(*backend, {result}, {a});
+    EXPECT_EQ((vector<float>{1, 4, 9}), read_vector<float>(result));
+    EXPECT_EQ(2, cache.size());
+
+    a = backend->create_tensor(element::f32, Shape{2, 4});
+    result = backend->create_tensor(element::f32, Shape{2});
+    EXPECT_THROW(cache.call(*backend, {result}, {a}), ngraph_error);
+}
+
+TEST(backend_api, specialization_cache_buckets)
+{
+    auto A = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 2});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto B_batch = make_shared<op::Broadcast>(B, Shape{4, 2}, AxisSet{0});
+    auto f = make_shared<Function>(NodeVector{A + A, B_batch}, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::SpecializationCache cache(f);
+    cache.set_buckets(0, 0, {4, 8});
+    // Only dynamic axes can be bucketed
+    EXPECT_THROW(cache.set_buckets(0, 1, {4}), ngraph_error);
+    EXPECT_THROW(cache.set_buckets(1, 0, {4}), ngraph_error);
+    EXPECT_EQ((vector<Shape>{Shape{4, 2}, Shape{2}}),
+              cache.get_specialized_shapes({Shape{3, 2}, Shape{2}}));
+    EXPECT_EQ((vector<Shape>{Shape{9, 2}, Shape{2}}),
+              cache.get_specialized_shapes({Shape{9, 2}, Shape{2}}));
+
+    auto b = backend->create_tensor(element::f32, Shape{2});
+    copy_data(b, vector<float>{7, 8});
+    auto broadcast = backend->create_tensor(element::f32, Shape{4, 2});
+    for (size_t batch = 1; batch <= 4; batch++)
+    {
+        auto a = backend->create_tensor(element::f32, Shape{batch, 2});
+        vector<float> data(batch * 2);
+        iota(data.begin(), data.end(), 1);
+        copy_data(a, data);
+        auto result = backend->create_tensor(element::f32, Shape{batch, 2});
+        cache.call(*backend, {result, broadcast}, {a, b});
+        for (float& x : data)
+        {
+            x *= 2;
+        }
+        EXPECT_EQ(data, read_vector<float>(result));
+        EXPECT_EQ((vector<float>{7, 8, 7, 8, 7, 8, 7, 8}), read_vector<float>(broadcast));
+    }
+    // Batches one through four share the specialization for four
+    EXPECT_EQ(1, cache.size());
+}
+
+TEST(backend_api, specialization_cache_buckets_reduction)
+{
+    auto A = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 2});
+    auto f = make_shared<Function>(NodeVector{make_shared<op::Sum>(A, AxisSet{0}),
+                                              make_shared<op::Sum>(A, AxisSet{1})},
+                                   ParameterVector{A});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto a = backend->create_tensor(element::f32, Shape{3, 2});
+    copy_data(a, vector<float>{1, 2, 3, 4, 5, 6});
+    auto columns = backend->create_tensor(element::f32, Shape{2});
+    auto rows = backend->create_tensor(element::f32, Shape{3});
+
+    // Without buckets the reduced axis is not padded
+    runtime::SpecializationCache exact(f);
+    exact.call(*backend, {columns, rows}, {a});
+    EXPECT_EQ((vector<float>{9, 12}), read_vector<float>(columns));
+    EXPECT_EQ((vector<float>{3, 7, 11}), read_vector<float>(rows));
+
+    // Padding the axis the first result reduces is refused
+    runtime::SpecializationCache bucketed(f);
+    bucketed.set_buckets(0, 0, {4});
+    EXPECT_THROW(bucketed.call(*backend, {columns, rows}, {a}), ngraph_error);
+    EXPECT_EQ(0, bucketed.size());
+}
+
+TEST(backend_api, batching_executor)
+{
+    auto A = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 2});
+    auto W = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    // Only A is batched, W is shared by the requests
+    auto f = make_shared<Function>(make_shared<op::Dot>(A * A, W), ParameterVector{A, W});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::BatchingExecutor executor(*backend, f, 4, chrono::seconds(10));
+
+    auto w = backend->create_tensor(element::f32, Shape{2, 2});
+    copy_data(w, vector<float>{1, 2, 3, 4});
+    vector<shared_ptr<runtime::Tensor>> inputs;
+    vector<shared_ptr<runtime::Tensor>> outputs;
+    vector<future<runtime::BatchingExecutor::Latency>> latencies;
+    // Four rows fill the batch, so it runs without waiting for the delay
+    for (size_t rows : {1, 2, 1})
+    {
+        inputs.push_back(backend->create_tensor(element::f32, Shape{rows, 2}));
+        vector<float> data(rows * 2);
+        iota(data.begin(), data.end(), inputs.size());
+        copy_data(inputs.back(), data);
+        outputs.push_back(backend->create_tensor(element::f32, Shape{rows, 2}));
+        latencies.push_back(executor.submit({outputs.back()}, {inputs.back(), w}));
+    }
+    for (size_t i = 0; i < latencies.size(); i++)
+    {
+        runtime::BatchingExecutor::Latency latency = latencies[i].get();
+        EXPECT_EQ(4, latency.m_batch_rows);
+        EXPECT_LE(latency.m_queue_microseconds, latency.m_total_microseconds);
+        vector<float> a = read_vector<float>(inputs[i]);
+        vector<float> expected;
+        for (size_t row = 0; row < a.size(); row += 2)
+        {
+            float x = a[row] * a[row];
+            float y = a[row + 1] * a[row + 1];
+            expected.push_back(x + 3 * y);
+            expected.push_back(2 * x + 4 * y);
+        }
+        EXPECT_EQ(expected, read_vector<float>(outputs[i]));
+    }
+
+    auto wrong = backend->create_tensor(element::f32, Shape{5, 2});
+    EXPECT_THROW(executor.submit({wrong}, {wrong, w}), ngraph_error);
+}
+
+TEST(backend_api, batching_executor_delay)
+{
+    auto A = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 3});
+    auto f = make_shared<Function>(NodeVector{-A}, ParameterVector{A});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::BatchingExecutor executor(*backend, f, 8, chrono::milliseconds(1));
+
+    // A lone request runs once the delay has passed
+    auto a = backend->create_tensor(element::f32, Shape{1, 3});
+    copy_data(a, vector<float>{1, 2, 3});
+    auto result = backend->create_tensor(element::f32, Shape{1, 3});
+    runtime::BatchingExecutor::Latency latency = executor.call({result}, {a});
+    EXPECT_EQ(1, latency.m_batch_rows);
+    EXPECT_EQ((vector<float>{-1, -2, -3}), read_vector<float>(result));
+}
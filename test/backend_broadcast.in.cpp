@@ -18,6 +18,7 @@
 #include <cinttypes>
 #include <cmath>
 #include <cstdlib>
+#include <numeric>
 #include <random>
 #include <string>
 
@@ -441,6 +442,37 @@ NGRAPH_TEST(${BACKEND_NAME}, broadcast_matrix_2)
     EXPECT_EQ((vector<float>{1, 1, 2, 2, 3, 3, 4, 4}), read_vector<float>(result));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, broadcast_merged_axes_large)
+{
+    // Large enough to be split between threads. The two leading broadcast axes and the two
+    // input axes are each merged, the trailing broadcast axis repeats every element.
+    Shape shape_a{3, 5};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    Shape shape_r{8, 16, 3, 5, 60};
+    auto r = make_shared<op::Broadcast>(A, shape_r, AxisSet{0, 1, 4});
+    auto f = make_shared<Function>(r, ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    vector<float> a_data(shape_size(shape_a));
+    iota(a_data.begin(), a_data.end(), 1);
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, a_data);
+    auto result = backend->create_tensor(element::f32, shape_r);
+
+    auto handle = backend->compile(f);
+    backend->call_with_validate(handle, {result}, {a});
+    vector<float> expected;
+    for (size_t i = 0; i < 8 * 16; i++)
+    {
+        for (float x : a_data)
+        {
+            expected.insert(expected.end(), 60, x);
+        }
+    }
+    EXPECT_EQ(expected, read_vector<float>(result));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, constant_broadcast)
 {
     const string js =
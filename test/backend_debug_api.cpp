@@ -17,12 +17,14 @@
 #include <random>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "gtest/gtest.h"
 #include "ngraph/log.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/runtime/interpreter/int_backend.hpp"
+#include "util/random.hpp"
 #include "util/test_tools.hpp"
 
 using namespace std;
@@ -75,3 +77,164 @@ TEST(INTERPRETER, nan_check_output)
     ibackend->set_nan_check(handle, true);
     EXPECT_ANY_THROW(ibackend->call_with_validate(handle, {result}, {a, b}));
 }
+
+TEST(INTERPRETER, call_rebinds_tensors)
+{
+    Shape shape{4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = op::Constant::create(element::f32, shape, {1, 1, 1, 1});
+    auto sum = make_shared<op::Add>(make_shared<op::Multiply>(A, B), C);
+    auto f = make_shared<Function>(NodeVector{sum, A}, ParameterVector{A, B});
+
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("INTERPRETER");
+
+    auto a0 = backend->create_tensor(element::f32, shape);
+    copy_data(a0, vector<float>{1, 2, 3, 4});
+    auto a1 = backend->create_tensor(element::f32, shape);
+    copy_data(a1, vector<float>{5, 6, 7, 8});
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{2, 2, 2, 2});
+    auto r0 = backend->create_tensor(element::f32, shape);
+    auto r1 = backend->create_tensor(element::f32, shape);
+    auto s0 = backend->create_tensor(element::f32, shape);
+    auto s1 = backend->create_tensor(element::f32, shape);
+
+    auto handle = backend->compile(f);
+    backend->call_with_validate(handle, {r0, s0}, {a0, b});
+    backend->call_with_validate(handle, {r1, s1}, {a1, b});
+    EXPECT_EQ((vector<float>{3, 5, 7, 9}), read_vector<float>(r0));
+    EXPECT_EQ((vector<float>{1, 2, 3, 4}), read_vector<float>(s0));
+    EXPECT_EQ((vector<float>{11, 13, 15, 17}), read_vector<float>(r1));
+    EXPECT_EQ((vector<float>{5, 6, 7, 8}), read_vector<float>(s1));
+}
+
+TEST(INTERPRETER, parallel_matches_sequential)
+{
+    Shape shape_x{4, 3, 9, 9};
+    Shape shape_w{5, 3, 3, 3};
+    Shape shape_m{45, 7};
+    auto X = make_shared<op::Parameter>(element::f32, shape_x);
+    auto W = make_shared<op::Parameter>(element::f32, shape_w);
+    auto M = make_shared<op::Parameter>(element::f32, shape_m);
+
+    auto conv = make_shared<op::Relu>(make_shared<op::Convolution>(X, W, Strides{2, 2}));
+    auto max_pool = make_shared<op::MaxPool>(conv, Shape{2, 2});
+    auto avg_pool = make_shared<op::AvgPool>(conv, Shape{3, 3});
+    auto pooled = make_shared<op::Reshape>(max_pool, AxisVector{0, 1, 2, 3}, Shape{4, 45});
+    auto dot = make_shared<op::Dot>(pooled, M);
+    auto row = make_shared<op::Slice>(dot, Coordinate{0, 0}, Coordinate{1, 7});
+    auto transposed = make_shared<op::Reshape>(M, AxisVector{1, 0}, Shape{7, 45});
+    auto f = make_shared<Function>(
+        NodeVector{dot,
+                   make_shared<op::Dot>(row, make_shared<op::Negative>(transposed)),
+                   make_shared<op::Sum>(conv, AxisSet{0, 2, 3}),
+                   make_shared<op::Max>(conv, AxisSet{1, 3}),
+                   make_shared<op::Min>(X, AxisSet{0, 3}),
+                   make_shared<op::Product>(avg_pool, AxisSet{0})},
+        ParameterVector{X, W, M});
+
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("INTERPRETER");
+    shared_ptr<runtime::interpreter::INTBackend> ibackend =
+        static_pointer_cast<runtime::interpreter::INTBackend>(backend);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<shared_ptr<runtime::Tensor>> args;
+    for (shared_ptr<op::Parameter> param : f->get_parameters())
+    {
+        args.push_back(rng.initialize(backend->create_tensor(element::f32, param->get_shape())));
+    }
+
+    auto handle = backend->compile(f);
+    vector<vector<shared_ptr<runtime::Tensor>>> results(2);
+    for (size_t mode = 0; mode < 2; mode++)
+    {
+        ibackend->set_parallel(handle, mode == 1);
+        for (size_t i = 0; i < f->get_output_size(); i++)
+        {
+            results[mode].push_back(backend->create_tensor(element::f32, f->get_output_shape(i)));
+        }
+        backend->call_with_validate(handle, results[mode], args);
+    }
+
+    for (size_t i = 0; i < f->get_output_size(); i++)
+    {
+        // Bitwise equality, not a tolerance
+        EXPECT_EQ(read_vector<float>(results[0][i]), read_vector<float>(results[1][i]));
+    }
+}
+
+TEST(INTERPRETER, views_and_in_place_concat)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    // Both inputs are written straight into the concat, the reshape and slices are views
+    auto concat = make_shared<op::Concat>(
+        NodeVector{make_shared<op::Add>(A, B), make_shared<op::Multiply>(A, B)}, 0);
+    auto flat = make_shared<op::Reshape>(concat, AxisVector{0, 1}, Shape{12});
+    auto middle = make_shared<op::Slice>(flat, Coordinate{3}, Coordinate{9});
+    auto row = make_shared<op::Slice>(A, Coordinate{1, 0}, Coordinate{2, 3});
+    auto f = make_shared<Function>(NodeVector{middle, make_shared<op::Negative>(row), concat},
+                                   ParameterVector{A, B});
+
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("INTERPRETER");
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{6, 5, 4, 3, 2, 1});
+    auto r0 = backend->create_tensor(element::f32, Shape{6});
+    auto r1 = backend->create_tensor(element::f32, Shape{1, 3});
+    auto r2 = backend->create_tensor(element::f32, Shape{4, 3});
+
+    auto handle = backend->compile(f);
+    copy_data(a, vector<float>{1, 2, 3, 4, 5, 6});
+    backend->call_with_validate(handle, {r0, r1, r2}, {a, b});
+    EXPECT_EQ((vector<float>{7, 7, 7, 6, 10, 12}), read_vector<float>(r0));
+    EXPECT_EQ((vector<float>{-4, -5, -6}), read_vector<float>(r1));
+    EXPECT_EQ((vector<float>{7, 7, 7, 7, 7, 7, 6, 10, 12, 12, 10, 6}), read_vector<float>(r2));
+
+    copy_data(a, vector<float>{0, 0, 0, 1, 1, 1});
+    backend->call_with_validate(handle, {r0, r1, r2}, {a, b});
+    EXPECT_EQ((vector<float>{4, 3, 2, 0, 0, 0}), read_vector<float>(r0));
+    EXPECT_EQ((vector<float>{-1, -1, -1}), read_vector<float>(r1));
+}
+
+TEST(INTERPRETER, concurrent_calls)
+{
+    Shape shape{100000};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto sum = make_shared<op::Add>(make_shared<op::Multiply>(A, B), B);
+    auto f = make_shared<Function>(sum, ParameterVector{A, B});
+
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("INTERPRETER");
+    auto handle = backend->compile(f);
+
+    // Each thread binds its own tensors; the product lives in the plan's shared temporaries
+    vector<thread> threads;
+    vector<bool> correct(4, true);
+    for (size_t t = 0; t < correct.size(); t++)
+    {
+        threads.push_back(thread([&, t]() {
+            auto a = backend->create_tensor(element::f32, shape);
+            copy_data(a, vector<float>(shape_size(shape), t));
+            auto b = backend->create_tensor(element::f32, shape);
+            copy_data(b, vector<float>(shape_size(shape), 2));
+            auto result = backend->create_tensor(element::f32, shape);
+            for (size_t i = 0; i < 20; i++)
+            {
+                backend->call(handle, {result}, {a, b});
+                if (read_vector<float>(result) != vector<float>(shape_size(shape), 2 * t + 2))
+                {
+                    correct[t] = false;
+                }
+            }
+        }));
+    }
+    for (thread& t : threads)
+    {
+        t.join();
+    }
+    EXPECT_EQ(vector<bool>(correct.size(), true), correct);
+}
@@ -665,6 +665,58 @@ NGRAPH_TEST(${BACKEND_NAME}, dot_matrix_vector_int64)
 // array([ 2938.,  3016.,  3094.,  3172.,  3250.,  7042.,  7264.,  7486.,
 //         7708.,  7930.])
 //
+NGRAPH_TEST(${BACKEND_NAME}, dot_matrix_large)
+{
+    // Large enough for the rows of the product to be split between threads. Small integers
+    // keep the sums exact.
+    Shape shape_a{256, 64};
+    Shape shape_b{64, 48};
+    Shape shape_r{256, 48};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    auto B = make_shared<op::Parameter>(element::f32, shape_b);
+    auto f = make_shared<Function>(make_shared<op::Dot>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    vector<float> a_data;
+    for (size_t i = 0; i < shape_a[0]; i++)
+    {
+        for (size_t k = 0; k < shape_a[1]; k++)
+        {
+            a_data.push_back((i + k) % 7);
+        }
+    }
+    vector<float> b_data;
+    for (size_t k = 0; k < shape_b[0]; k++)
+    {
+        for (size_t j = 0; j < shape_b[1]; j++)
+        {
+            b_data.push_back(static_cast<float>((k * j) % 5) - 2);
+        }
+    }
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, a_data);
+    auto b = backend->create_tensor(element::f32, shape_b);
+    copy_data(b, b_data);
+    auto result = backend->create_tensor(element::f32, shape_r);
+
+    auto handle = backend->compile(f);
+    backend->call_with_validate(handle, {result}, {a, b});
+    vector<float> expected(shape_size(shape_r), 0);
+    for (size_t i = 0; i < shape_r[0]; i++)
+    {
+        for (size_t j = 0; j < shape_r[1]; j++)
+        {
+            for (size_t k = 0; k < shape_a[1]; k++)
+            {
+                expected[i * shape_r[1] + j] +=
+                    a_data[i * shape_a[1] + k] * b_data[k * shape_b[1] + j];
+            }
+        }
+    }
+    EXPECT_EQ(expected, read_vector<float>(result));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, dot_3d_multi_axis)
 {
     vector<float> a_data(2 * 3 * 4);
@@ -18,6 +18,7 @@
 #include <cinttypes>
 #include <cmath>
 #include <cstdlib>
+#include <numeric>
 #include <random>
 #include <string>
 
@@ -515,6 +516,37 @@ NGRAPH_TEST(${BACKEND_NAME}, reshape_transposed_shape_change)
 //         198.,  270.,  206.,  278.,  214.,  286.,  199.,  271.,  207.,
 //         279.,  215.,  287.,  200.,  272.,  208.,  280.,  216.,  288.])
 //
+NGRAPH_TEST(${BACKEND_NAME}, reshape_transpose_merged_axes_large)
+{
+    // Large enough to be split between threads. The transpose only swaps two pairs of axes
+    // that are each contiguous, so it is copied as a transpose of a matrix.
+    Shape shape_a{6, 7, 8, 100};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    Shape shape_r{8, 100, 6, 7};
+    auto r = make_shared<op::Reshape>(A, AxisVector{2, 3, 0, 1}, shape_r);
+    auto f = make_shared<Function>(r, ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    vector<float> a_data(shape_size(shape_a));
+    iota(a_data.begin(), a_data.end(), 0);
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, a_data);
+    auto result = backend->create_tensor(element::f32, shape_r);
+
+    auto handle = backend->compile(f);
+    backend->call_with_validate(handle, {result}, {a});
+    vector<float> expected;
+    for (size_t i = 0; i < 8 * 100; i++)
+    {
+        for (size_t j = 0; j < 6 * 7; j++)
+        {
+            expected.push_back(a_data[j * 8 * 100 + i]);
+        }
+    }
+    EXPECT_EQ(expected, read_vector<float>(result));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, reshape_6d)
 {
     vector<float> a_data(2 * 2 * 3 * 3 * 2 * 4);
@@ -19,6 +19,7 @@
 #include <cinttypes>
 #include <cmath>
 #include <cstdlib>
+#include <numeric>
 #include <random>
 #include <string>
 #include "gtest/gtest.h"
@@ -1714,6 +1715,41 @@ NGRAPH_TEST(${BACKEND_NAME}, slice_3d_strided_different_strides)
     EXPECT_EQ((vector<float>{0, 3, 8, 11, 32, 35, 40, 43}), read_vector<float>(result));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, slice_3d_strided_large)
+{
+    // Large enough to be split between threads. The first two axes step through the input
+    // evenly and are copied as one.
+    Shape shape_a{64, 64, 64};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    Shape shape_r{63, 32, 20};
+    auto r =
+        make_shared<op::Slice>(A, Coordinate{1, 0, 2}, Coordinate{64, 64, 62}, Strides{1, 2, 3});
+    auto f = make_shared<Function>(r, ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    vector<float> a_data(shape_size(shape_a));
+    iota(a_data.begin(), a_data.end(), 0);
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, a_data);
+    auto result = backend->create_tensor(element::f32, shape_r);
+
+    auto handle = backend->compile(f);
+    backend->call_with_validate(handle, {result}, {a});
+    vector<float> expected;
+    for (size_t i = 0; i < shape_r[0]; i++)
+    {
+        for (size_t j = 0; j < shape_r[1]; j++)
+        {
+            for (size_t k = 0; k < shape_r[2]; k++)
+            {
+                expected.push_back(a_data[((1 + i) * 64 + 2 * j) * 64 + 2 + 3 * k]);
+            }
+        }
+    }
+    EXPECT_EQ(expected, read_vector<float>(result));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, slice_3d_start_just_oob)
 {
     Shape shape_a{20, 10, 5};
@@ -2854,6 +2890,50 @@ NGRAPH_TEST(${BACKEND_NAME}, computation_reuse)
     EXPECT_EQ(rv_saved, rv);
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, cacheable_parameter_memoization)
+{
+    Shape shape{4};
+    auto W = make_shared<op::Parameter>(element::f32, shape, true);
+    auto X = make_shared<op::Parameter>(element::f32, shape);
+    auto two = op::Constant::create(element::f32, shape, {2, 2, 2, 2});
+    // W * 2 + 1 is computed once and kept until W changes
+    auto one = make_shared<op::Broadcast>(
+        op::Constant::create(element::f32, Shape{}, {1}), shape, AxisSet{0});
+    auto f = make_shared<Function>((W * two + one) * X, ParameterVector{W, X});
+
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    vector<float> w_data{1, 2, 3, 4};
+    auto w = backend->create_tensor(element::f32, shape, w_data.data());
+    auto x = backend->create_tensor(element::f32, shape);
+    copy_data(x, vector<float>{1, 1, 1, 1});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    auto handle = backend->compile(f);
+    backend->call_with_validate(handle, {result}, {w, x});
+    EXPECT_EQ((vector<float>{3, 5, 7, 9}), read_vector<float>(result));
+
+    // Changing the caller's memory behind the tensor's back keeps the cached values
+    w_data[0] = 10;
+    copy_data(x, vector<float>{2, 2, 2, 2});
+    backend->call_with_validate(handle, {result}, {w, x});
+    EXPECT_EQ((vector<float>{6, 10, 14, 18}), read_vector<float>(result));
+
+    w->mark_modified();
+    backend->call_with_validate(handle, {result}, {w, x});
+    EXPECT_EQ((vector<float>{42, 10, 14, 18}), read_vector<float>(result));
+
+    copy_data(w, vector<float>{0, 0, 0, 0});
+    backend->call_with_validate(handle, {result}, {w, x});
+    EXPECT_EQ((vector<float>{2, 2, 2, 2}), read_vector<float>(result));
+
+    // So does binding another tensor
+    auto w2 = backend->create_tensor(element::f32, shape);
+    copy_data(w2, vector<float>{1, 1, 1, 1});
+    backend->call_with_validate(handle, {result}, {w2, x});
+    EXPECT_EQ((vector<float>{6, 6, 6, 6}), read_vector<float>(result));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, pad_interior_1d)
 {
     Shape shape_a{6};
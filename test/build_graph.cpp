@@ -22,6 +22,7 @@
 #include "util/test_tools.hpp"
 
 #include <memory>
+#include <sys/resource.h>
 using namespace std;
 using namespace ngraph;
 
@@ -131,3 +132,161 @@ TEST(build_graph, function_undeclared_parameters)
         FAIL() << "Function construction failed for unexpected reason";
     }
 }
+
+static bool is_valid_order(const shared_ptr<Function>& f, const NodeVector& order)
+{
+    auto ops = f->get_ops();
+    if (ops.size() != order.size())
+    {
+        return false;
+    }
+    set<Node*> seen;
+    for (auto& node : order)
+    {
+        for (auto& arg : node->get_arguments())
+        {
+            if (seen.count(arg.get()) == 0)
+            {
+                return false;
+            }
+        }
+        seen.insert(node.get());
+    }
+    for (auto& node : ops)
+    {
+        if (seen.count(node.get()) == 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST(build_graph, ordered_ops_cache)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto add = make_shared<op::Add>(A, B);
+    auto mul = make_shared<op::Multiply>(add, B);
+    auto neg = make_shared<op::Negative>(mul);
+    auto f = make_shared<Function>(neg, ParameterVector{A, B});
+
+    auto view = f->get_ordered_ops_view();
+    EXPECT_EQ(view, f->get_ordered_ops_view());
+    EXPECT_TRUE(is_valid_order(f, *view));
+
+    // Function::replace_node patches the cached order
+    auto sub = make_shared<op::Subtract>(A, make_shared<op::Abs>(B));
+    f->replace_node(add, sub);
+    auto patched = f->get_ordered_ops_view();
+    EXPECT_NE(view, patched);
+    EXPECT_EQ(patched, f->get_ordered_ops_view());
+    EXPECT_TRUE(is_valid_order(f, *patched));
+    EXPECT_EQ(count(patched->begin(), patched->end(), add), 0);
+    EXPECT_EQ(count(patched->begin(), patched->end(), sub), 1);
+
+    // The old snapshot is unaffected by the edit
+    EXPECT_EQ(count(view->begin(), view->end(), add), 1);
+
+    // ngraph::replace_node patches the cached order too
+    auto div = make_shared<op::Divide>(sub, B);
+    replace_node(mul, div);
+    auto recomputed = f->get_ordered_ops_view();
+    EXPECT_NE(patched, recomputed);
+    EXPECT_TRUE(is_valid_order(f, *recomputed));
+    EXPECT_EQ(count(recomputed->begin(), recomputed->end(), mul), 0);
+
+    // Replacing with a node that is ordered after the target falls back to recomputation
+    auto C = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto g_add = make_shared<op::Add>(C, C);
+    auto g_abs = make_shared<op::Abs>(C);
+    auto g_mul = make_shared<op::Multiply>(g_add, g_abs);
+    auto g = make_shared<Function>(g_mul, ParameterVector{C});
+    auto g_view = g->get_ordered_ops_view();
+    g->replace_node(g_add, g_abs);
+    EXPECT_TRUE(is_valid_order(g, *g->get_ordered_ops_view()));
+    EXPECT_EQ(g->get_ordered_ops().size(), g->get_ops().size());
+
+    // Edits to other graphs keep the cached order
+    g_view = g->get_ordered_ops_view();
+    recomputed = f->get_ordered_ops_view();
+    auto D = op::Constant::create(element::f32, Shape{2}, {1, 2});
+    auto d_abs = make_shared<op::Abs>(D);
+    auto d_neg = make_shared<op::Negative>(d_abs);
+    d_neg->add_control_dependency(D);
+    replace_node(d_abs, make_shared<op::Negative>(D));
+    EXPECT_EQ(recomputed, f->get_ordered_ops_view());
+    EXPECT_EQ(g_view, g->get_ordered_ops_view());
+
+    // Until they are connected to the function
+    replace_node(sub, make_shared<op::Add>(d_neg, B));
+    EXPECT_NE(recomputed, f->get_ordered_ops_view());
+    EXPECT_TRUE(is_valid_order(f, *f->get_ordered_ops_view()));
+    EXPECT_EQ(f->get_ordered_ops().size(), f->get_ops().size());
+}
+
+TEST(build_graph, deferred_validation)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{3});
+    {
+        DeferredValidation deferred_validation;
+        auto bad = make_shared<op::Add>(A, B);
+        EXPECT_THROW(make_shared<Function>(bad, ParameterVector{A, B}), NodeValidationError);
+
+        auto C = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+        auto add = make_shared<op::Add>(A, C);
+        auto neg = make_shared<op::Negative>(add);
+        auto topk = make_shared<op::TopK>(neg, 1, element::i32, 2, true);
+        // Output types are inferred on first use
+        EXPECT_EQ(topk->get_output_shape(1), (Shape{2, 2}));
+        EXPECT_EQ(topk->get_output_element_type(0), element::i32);
+        EXPECT_EQ(add->get_shape(), (Shape{2, 3}));
+    }
+
+    auto D = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto f = make_shared<Function>(make_shared<op::Multiply>(make_shared<op::Add>(A, D), D),
+                                   ParameterVector{A, D});
+    auto g = clone_function(*f);
+    EXPECT_FALSE(DeferredValidation::is_active());
+    EXPECT_EQ(g->get_output_shape(0), (Shape{2, 3}));
+    EXPECT_EQ(g->get_output_element_type(0), element::f32);
+}
+
+// Builds and clones a graph of one million nodes, reporting time and peak memory. Run it with
+// --gtest_also_run_disabled_tests.
+TEST(build_graph, DISABLED_build_and_clone_1m_nodes)
+{
+    const size_t chain_count = 1000;
+    const size_t chain_length = 1000;
+    auto peak_rss_mb = []() {
+        struct rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        return usage.ru_maxrss / 1024;
+    };
+
+    stopwatch timer;
+    timer.start();
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{2});
+    NodeVector results;
+    for (size_t i = 0; i < chain_count; i++)
+    {
+        shared_ptr<Node> x = A;
+        for (size_t j = 0; j < chain_length; j += 2)
+        {
+            x = make_shared<op::Negative>(make_shared<op::Add>(x, B));
+        }
+        results.push_back(x);
+    }
+    auto f = make_shared<Function>(results, ParameterVector{A, B});
+    timer.stop();
+    cout << "build: " << timer.get_milliseconds() << "ms, peak rss " << peak_rss_mb() << "MB\n";
+
+    timer.start();
+    auto g = clone_function(*f);
+    timer.stop();
+    cout << "clone: " << timer.get_milliseconds() << "ms, peak rss " << peak_rss_mb() << "MB\n";
+
+    EXPECT_EQ(g->get_ops().size(), f->get_ops().size());
+}
@@ -285,3 +285,58 @@ TEST(constant_folding, const_quantize)
     vector<output_c_type> values_quantize{2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5};
     ASSERT_EQ(values_quantize, values_out);
 }
+
+TEST(constant_folding, constant_subgraph_on_backend)
+{
+    auto A = op::Constant::create(element::f32, Shape{2, 3}, {1, 2, 3, 4, 5, 6});
+    auto B = op::Constant::create(element::f32, Shape{3, 2}, {1, 0, 0, 1, 1, 1});
+    auto dot = make_shared<op::Dot>(A, B);
+    auto concat = make_shared<op::Concat>(NodeVector{dot, dot}, 0);
+    auto slice = make_shared<op::Slice>(concat, Coordinate{1, 0}, Coordinate{3, 2});
+    auto sum = make_shared<op::Sum>(slice, AxisSet{1});
+    auto convert = make_shared<op::Convert>(sum, element::i32);
+    auto P = make_shared<op::Parameter>(element::i32, Shape{2});
+    auto f = make_shared<Function>(make_shared<op::Add>(convert, P), ParameterVector{P});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>("INTERPRETER");
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Dot>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Convert>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 1);
+
+    auto new_const = std::dynamic_pointer_cast<op::Constant>(
+        f->get_results().at(0)->get_argument(0)->get_argument(0));
+    ASSERT_TRUE(new_const);
+    EXPECT_EQ(new_const->get_vector<int32_t>(), (vector<int32_t>{21, 9}));
+}
+
+TEST(constant_folding, constant_subgraph_size_cap)
+{
+    auto indices = op::Constant::create(element::i32, Shape{4}, {0, 1, 2, 3});
+    auto one_hot = make_shared<op::OneHot>(indices, Shape{4, 256}, 1);
+    auto P = make_shared<op::Parameter>(element::i32, Shape{4, 256});
+    auto f = make_shared<Function>(make_shared<op::Add>(one_hot, P), ParameterVector{P});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>("INTERPRETER", 1024);
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::OneHot>(f), 1);
+}
+
+TEST(constant_folding, constant_allreduce_not_folded)
+{
+    // Every process has to take part in a collective, so it must run on every call
+    auto A = op::Constant::create(element::f32, Shape{2}, {1, 2});
+    auto allreduce = make_shared<op::AllReduce>(A);
+    auto P = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto f = make_shared<Function>(make_shared<op::Add>(allreduce, P), ParameterVector{P});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>("INTERPRETER");
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::AllReduce>(f), 1);
+}
@@ -0,0 +1,145 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <sstream>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/constant_store.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/serializer.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(constant_store, intern_deduplicates)
+{
+    auto& store = ConstantStore::get_instance();
+    vector<float> values{1, 2, 3, 4, 5};
+    vector<float> same_values{1, 2, 3, 4, 5};
+    vector<float> other_values{1, 2, 3, 4, 6};
+    size_t size = values.size() * sizeof(float);
+
+    auto a = store.intern(values.data(), size);
+    auto b = store.intern(same_values.data(), size);
+    auto c = store.intern(other_values.data(), size);
+    EXPECT_EQ(a.get(), b.get());
+    EXPECT_NE(a.get(), c.get());
+    EXPECT_NE(a.get(), static_cast<void*>(values.data()));
+}
+
+TEST(constant_store, intern_constants)
+{
+    Shape shape{2, 3};
+    vector<float> values{1, 2, 3, 4, 5, 6};
+    auto A = op::Constant::create(element::f32, shape, values);
+    auto B = op::Constant::create(element::f32, shape, values);
+    EXPECT_NE(A->get_data_ptr(), B->get_data_ptr());
+
+    auto f = make_shared<Function>(A + B, ParameterVector{});
+    ConstantStore::get_instance().intern(f);
+    EXPECT_EQ(A->get_data_ptr(), B->get_data_ptr());
+    EXPECT_EQ(values, A->get_vector<float>());
+}
+
+TEST(constant_store, clone_shares_data)
+{
+    Shape shape{2, 2};
+    auto A = op::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto P = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(A * P, ParameterVector{P});
+    auto g = clone_function(*f);
+
+    shared_ptr<op::Constant> cloned;
+    for (auto node : g->get_ops())
+    {
+        if (auto c = dynamic_pointer_cast<op::Constant>(node))
+        {
+            cloned = c;
+        }
+    }
+    ASSERT_NE(cloned, nullptr);
+    EXPECT_NE(cloned, A);
+    EXPECT_EQ(cloned->get_data_ptr(), A->get_data_ptr());
+}
+
+TEST(constant_store, deserialize_shares_data)
+{
+    Shape shape{3};
+    auto A = op::Constant::create(element::f32, shape, {7, 8, 9});
+    auto P = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(A + P, ParameterVector{P});
+
+    stringstream ss;
+    serialize(ss, f);
+    string model = ss.str();
+
+    vector<const void*> data;
+    for (size_t i = 0; i < 2; i++)
+    {
+        stringstream in(model);
+        auto g = deserialize(in);
+        for (auto node : g->get_ops())
+        {
+            if (auto c = dynamic_pointer_cast<op::Constant>(node))
+            {
+                EXPECT_EQ((vector<float>{7, 8, 9}), c->get_vector<float>());
+                data.push_back(c->get_data_ptr());
+            }
+        }
+        // Keep the first copy alive so the second load can share it
+        if (i == 0)
+        {
+            f = g;
+        }
+    }
+    ASSERT_EQ(data.size(), 2);
+    EXPECT_EQ(data[0], data[1]);
+}
+
+TEST(constant_store, transformed_computed_once)
+{
+    auto& store = ConstantStore::get_instance();
+    vector<int32_t> values{1, 2, 3, 4};
+    size_t size = values.size() * sizeof(int32_t);
+    auto source = store.intern(values.data(), size);
+
+    size_t calls = 0;
+    auto negate = [&](const void* in, void* out) {
+        calls++;
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            static_cast<int32_t*>(out)[i] = -static_cast<const int32_t*>(in)[i];
+        }
+    };
+
+    auto t1 = store.get_transformed(source, "negate", size, negate);
+    auto t2 = store.get_transformed(source, "negate", size, negate);
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(t1.get(), t2.get());
+    EXPECT_EQ(-3, static_cast<int32_t*>(t1.get())[2]);
+
+    auto t3 = store.get_transformed(source, "other", size, negate);
+    EXPECT_EQ(calls, 2);
+    EXPECT_NE(t1.get(), t3.get());
+
+    // Once released the transformation is recomputed
+    t1.reset();
+    t2.reset();
+    store.get_transformed(source, "negate", size, negate);
+    EXPECT_EQ(calls, 3);
+}
@@ -305,6 +305,98 @@ TEST(DISABLED_coordinate, dilation)
     EXPECT_TRUE(it == ct.end());
 }
 
+TEST(coordinate, iterator_jump_ahead)
+{
+    auto ct = CoordinateTransform({2, 3, 4});
+    auto it = ct.begin();
+    it += 5;
+    EXPECT_EQ(*it, Coordinate({0, 1, 1}));
+    it += 13;
+    EXPECT_EQ(*it, Coordinate({1, 1, 2}));
+    it += 5;
+    EXPECT_EQ(*it, Coordinate({1, 2, 3}));
+    it += 1;
+    EXPECT_TRUE(it == ct.end());
+}
+
+TEST(coordinate, index_matches_source_coordinate)
+{
+    Shape source_shape{5, 4, 6};
+    auto ct = CoordinateTransform(source_shape,
+                                  Coordinate{0, 1, 0},
+                                  Coordinate{6, 8, 14},
+                                  Strides{2, 1, 3},
+                                  AxisVector{0, 1, 2},
+                                  CoordinateDiff{1, 0, 1},
+                                  CoordinateDiff{0, 1, 2},
+                                  Strides{1, 2, 2});
+    size_t checked = 0;
+    for (const Coordinate& c : ct)
+    {
+        if (ct.has_source_coordinate(c))
+        {
+            EXPECT_EQ(ct.index(c), ct.index_source(ct.to_source_coordinate(c)));
+            checked++;
+        }
+    }
+    EXPECT_GT(checked, 0);
+}
+
+TEST(coordinate, source_index_walker)
+{
+    auto ct = CoordinateTransform(Shape{4, 5, 6},
+                                  Coordinate{1, 0, 2},
+                                  Coordinate{4, 5, 6},
+                                  Strides{2, 3, 1},
+                                  AxisVector{2, 0, 1});
+    auto walker = ct.source_index_walker();
+    EXPECT_EQ(walker.size(), shape_size(ct.get_target_shape()));
+    for (const Coordinate& c : ct)
+    {
+        ASSERT_FALSE(walker.at_end());
+        EXPECT_EQ(*walker, ct.index(c));
+        ++walker;
+    }
+    EXPECT_TRUE(walker.at_end());
+
+    // Jumping ahead lands on the same index as stepping there
+    auto it = ct.begin();
+    auto jumped = ct.source_index_walker();
+    for (size_t n : {0, 3, 1, 7, 5})
+    {
+        it += n;
+        jumped += n;
+        EXPECT_EQ(*jumped, ct.index(*it));
+    }
+
+    auto padded = CoordinateTransform(Shape{3},
+                                      Coordinate{0},
+                                      Coordinate{4},
+                                      Strides{1},
+                                      AxisVector{0},
+                                      CoordinateDiff{1},
+                                      CoordinateDiff{0});
+    EXPECT_THROW(padded.source_index_walker(), std::domain_error);
+}
+
+TEST(coordinate, projected_index_walker)
+{
+    Shape shape{3, 2, 4};
+    AxisSet projected_axes{1};
+    auto reduced = CoordinateTransform(reduce(shape, projected_axes));
+    auto walker = IndexWalker(shape, projected_axes);
+    for (const Coordinate& c : CoordinateTransform(shape))
+    {
+        EXPECT_EQ(*walker, reduced.index(reduce(c, projected_axes)));
+        ++walker;
+    }
+    EXPECT_TRUE(walker.at_end());
+
+    walker.seek(13);
+    EXPECT_EQ(walker.get_position(), 13);
+    EXPECT_EQ(*walker, 5);
+}
+
 TEST(benchmark, coordinate)
 {
     Shape source_shape{128, 3, 2000, 1000};
@@ -335,3 +427,44 @@ TEST(benchmark, coordinate)
     timer.stop();
     cout << "time: " << timer.get_milliseconds() << endl;
 }
+
+TEST(benchmark, coordinate_index_walker)
+{
+    // A transposing reshape, as walked by the reference reshape kernel
+    Shape source_shape{64, 32, 64, 32};
+    auto ct = CoordinateTransform(source_shape,
+                                  Coordinate(4, 0),
+                                  source_shape,
+                                  Strides(4, 1),
+                                  AxisVector{3, 1, 2, 0});
+
+    size_t expected = 0;
+    stopwatch timer;
+    timer.start();
+    for (const Coordinate& c : ct)
+    {
+        expected += ct.index_source(ct.to_source_coordinate(c));
+    }
+    timer.stop();
+    cout << "to_source_coordinate + index_source: " << timer.get_milliseconds() << "ms" << endl;
+
+    size_t actual = 0;
+    timer.start();
+    for (const Coordinate& c : ct)
+    {
+        actual += ct.index(c);
+    }
+    timer.stop();
+    cout << "index: " << timer.get_milliseconds() << "ms" << endl;
+    EXPECT_EQ(actual, expected);
+
+    actual = 0;
+    timer.start();
+    for (auto walker = ct.source_index_walker(); !walker.at_end(); ++walker)
+    {
+        actual += *walker;
+    }
+    timer.stop();
+    cout << "source_index_walker: " << timer.get_milliseconds() << "ms" << endl;
+    EXPECT_EQ(actual, expected);
+}
@@ -26,6 +26,7 @@
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/op/experimental/quantized_conv.hpp"
 #include "ngraph/op/relu.hpp"
 #include "ngraph/op/reshape.hpp"
 #include "ngraph/op/softmax.hpp"
@@ -310,3 +311,178 @@ TEST(core_fusion, reshape_softmax_reshape)
 
     EXPECT_TRUE(test::all_close(baseline_results.at(0), optimized_results.at(0)));
 }
+
+TEST(core_fusion, folded_batch_norm_dot)
+{
+    Shape shape_input{4, 3};
+    Shape shape_weights{3, 5};
+    Shape shape_norm{5};
+
+    auto make_function = [shape_input, shape_weights, shape_norm]() {
+        auto input = make_shared<op::Parameter>(element::f32, shape_input);
+        auto weights = make_shared<op::Parameter>(element::f32, shape_weights);
+        auto dot = make_shared<op::Dot>(input, weights);
+        auto gamma = op::Constant::create(element::f32, shape_norm, {1.0, 0.5, 2.0, -1.5, 0.25});
+        auto beta = op::Constant::create(element::f32, shape_norm, {0.1, -0.2, 0.3, 0.0, 1.0});
+        auto mean = op::Constant::create(element::f32, shape_norm, {0.5, 1.0, -0.5, 2.0, 0.0});
+        auto var = op::Constant::create(element::f32, shape_norm, {1.0, 0.25, 4.0, 0.5, 2.0});
+        auto bn = make_shared<op::BatchNormInference>(0.001, gamma, beta, dot, mean, var);
+        return make_shared<Function>(bn, ParameterVector{input, weights});
+    };
+
+    auto baseline_f = make_function();
+    auto optimized_f = make_function();
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CoreFusion>();
+    pass_manager.run_passes(optimized_f);
+    ASSERT_EQ(count_ops_of_type<op::BatchNormInference>(optimized_f), 0);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : baseline_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    auto baseline_results = execute(baseline_f, args, "INTERPRETER");
+    auto optimized_results = execute(optimized_f, args, "INTERPRETER");
+    EXPECT_TRUE(test::all_close(baseline_results.at(0), optimized_results.at(0)));
+}
+
+TEST(core_fusion, dot_affine_folding)
+{
+    Shape shape_input{4, 3};
+    Shape shape_weights{3, 5};
+    Shape shape_dot{4, 5};
+    Shape shape_norm{5};
+
+    // ((x . W + b1) * a + b2) * s, with a per-column and s a LayerScale scalar
+    auto make_function = [shape_input, shape_weights, shape_dot, shape_norm]() {
+        auto input = make_shared<op::Parameter>(element::f32, shape_input);
+        auto weights = make_shared<op::Parameter>(element::f32, shape_weights);
+        auto b1 = make_shared<op::Parameter>(element::f32, shape_norm);
+        auto a = make_shared<op::Parameter>(element::f32, shape_norm);
+        auto b2 = make_shared<op::Parameter>(element::f32, shape_norm);
+        auto s = op::Constant::create(element::f32, Shape{}, {0.5});
+
+        auto dot = make_shared<op::Dot>(input, weights);
+        auto bias =
+            make_shared<op::Add>(dot, make_shared<op::Broadcast>(b1, shape_dot, AxisSet{0}));
+        auto scaled =
+            make_shared<op::Multiply>(make_shared<op::Broadcast>(a, shape_dot, AxisSet{0}), bias);
+        auto shifted =
+            make_shared<op::Add>(scaled, make_shared<op::Broadcast>(b2, shape_dot, AxisSet{0}));
+        auto out = make_shared<op::Multiply>(
+            shifted, make_shared<op::Broadcast>(s, shape_dot, AxisSet{0, 1}));
+        return make_shared<Function>(out, ParameterVector{input, weights, b1, a, b2});
+    };
+
+    auto baseline_f = make_function();
+    auto optimized_f = make_function();
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CoreFusion>();
+    pass_manager.run_passes(optimized_f);
+
+    // Only the bias add on the Dot output should remain at the activation shape
+    for (auto node : optimized_f->get_ordered_ops())
+    {
+        if (node->is_op() && !node->is_output() && node->get_shape() == shape_dot)
+        {
+            EXPECT_TRUE(std::dynamic_pointer_cast<op::Dot>(node) ||
+                        std::dynamic_pointer_cast<op::Broadcast>(node) ||
+                        std::dynamic_pointer_cast<op::Add>(node))
+                << node->get_name();
+        }
+    }
+    auto result_arg = optimized_f->get_results().at(0)->get_argument(0);
+    ASSERT_TRUE(std::dynamic_pointer_cast<op::Add>(result_arg));
+    EXPECT_TRUE(std::dynamic_pointer_cast<op::Dot>(result_arg->get_argument(0)));
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : baseline_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    auto baseline_results = execute(baseline_f, args, "INTERPRETER");
+    auto optimized_results = execute(optimized_f, args, "INTERPRETER");
+    EXPECT_TRUE(test::all_close(baseline_results.at(0), optimized_results.at(0)));
+}
+
+TEST(core_fusion, quantized_conv_scale_folding)
+{
+    auto input = make_shared<op::Parameter>(element::u8, Shape{1, 2, 3, 3});
+    auto filters = make_shared<op::Parameter>(element::i8, Shape{2, 2, 1, 1});
+    auto requantization_scale = op::Constant::create(element::f32, Shape{}, {0.1});
+    auto qconv = make_shared<op::QuantizedConvolution>(input,
+                                                       filters,
+                                                       Strides{1, 1},
+                                                       Strides{1, 1},
+                                                       CoordinateDiff{0, 0},
+                                                       CoordinateDiff{0, 0},
+                                                       Strides{1, 1},
+                                                       requantization_scale);
+    auto scale = op::Constant::create(element::f32, Shape{}, {0.25});
+    auto offset = op::Constant::create(element::i8, Shape{}, {0});
+    auto dequantize = make_shared<op::Dequantize>(qconv, scale, offset, element::f32, AxisSet{});
+    auto A = op::Constant::create(element::f32, Shape{}, {3.0});
+    auto out = make_shared<op::Multiply>(
+        make_shared<op::Broadcast>(A, dequantize->get_shape(), AxisSet{0, 1, 2, 3}), dequantize);
+    auto f = make_shared<Function>(out, ParameterVector{input, filters});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CoreFusion>();
+    pass_manager.run_passes(f);
+
+    auto dequantize_n =
+        std::dynamic_pointer_cast<op::Dequantize>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(dequantize_n);
+    EXPECT_EQ(dequantize_n->get_argument(0), qconv);
+    auto scale_n = std::dynamic_pointer_cast<op::Constant>(dequantize_n->get_argument(1));
+    ASSERT_TRUE(scale_n);
+    EXPECT_EQ(scale_n->get_vector<float>(), vector<float>{0.75f});
+}
+
+TEST(core_fusion, quantize_scale_folding)
+{
+    Shape shape{2, 4};
+
+    auto make_function = [shape]() {
+        auto input = make_shared<op::Parameter>(element::f32, shape);
+        auto A = op::Constant::create(element::f32, shape, vector<float>(8, 4.0f));
+        auto scale = op::Constant::create(element::f32, Shape{}, {2.0});
+        auto offset = op::Constant::create(element::u8, Shape{}, {10});
+        auto round_mode = op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN;
+        auto quantize = make_shared<op::Quantize>(make_shared<op::Multiply>(input, A),
+                                                  scale,
+                                                  offset,
+                                                  element::u8,
+                                                  AxisSet{},
+                                                  round_mode);
+        return make_shared<Function>(quantize, ParameterVector{input});
+    };
+
+    auto baseline_f = make_function();
+    auto optimized_f = make_function();
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CoreFusion>();
+    pass_manager.run_passes(optimized_f);
+    ASSERT_EQ(count_ops_of_type<op::Multiply>(optimized_f), 0);
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto input = backend->create_tensor(element::f32, shape);
+    copy_data(input, vector<float>{0.0f, 0.5f, 1.0f, 1.25f, 3.0f, 5.5f, 7.0f, 20.0f});
+    auto baseline_result = backend->create_tensor(element::u8, shape);
+    auto optimized_result = backend->create_tensor(element::u8, shape);
+    backend->call_with_validate(backend->compile(baseline_f), {baseline_result}, {input});
+    backend->call_with_validate(backend->compile(optimized_f), {optimized_result}, {input});
+    EXPECT_EQ(read_vector<uint8_t>(baseline_result), read_vector<uint8_t>(optimized_result));
+}
@@ -105,3 +105,32 @@ TEST(cpio, write)
         }
     }
 }
+
+TEST(cpio, write_aligned)
+{
+    const string test_file = "test_aligned.cpio";
+    const size_t alignment = 64;
+    string s1 = "this is a test";
+    string s2 = "the quick brown fox jumps over the lazy dog";
+    {
+        cpio::Writer writer(test_file);
+        writer.set_alignment(alignment);
+        writer.write("file1.txt", s1.data(), static_cast<uint32_t>(s1.size()));
+        writer.write("file.txt", s2.data(), static_cast<uint32_t>(s2.size()));
+    }
+    {
+        cpio::Reader reader(test_file);
+        auto file_info = reader.get_file_info();
+        ASSERT_EQ(2, file_info.size());
+
+        EXPECT_STREQ(file_info[0].get_name().c_str(), "file1.txt");
+        EXPECT_STREQ(file_info[1].get_name().c_str(), "file.txt");
+        EXPECT_EQ(file_info[0].get_offset() % alignment, 0);
+        EXPECT_EQ(file_info[1].get_offset() % alignment, 0);
+
+        string content(file_info[1].get_size(), 0);
+        reader.read(file_info[1].get_name(), &content[0], content.size());
+        EXPECT_STREQ(content.c_str(), s2.c_str());
+    }
+    file_util::remove_file(test_file);
+}
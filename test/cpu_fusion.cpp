@@ -60,6 +60,7 @@
 #include "ngraph/runtime/cpu/op/loop_kernel.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
+#include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
 #include "ngraph/runtime/cpu/op/update_slice.hpp"
@@ -1445,6 +1446,39 @@ TEST(cpu_fusion, max_pool_with_indices)
     ASSERT_EQ(maxpool_goe_indices->get_n(), 1);
 }
 
+TEST(cpu_fusion, clone_multi_output_ops)
+{
+    auto src_layer = make_shared<op::Parameter>(element::f32, Shape{10, 100});
+    auto src_iter = make_shared<op::Parameter>(element::f32, Shape{20, 100});
+    auto weights_layer = make_shared<op::Parameter>(element::f32, Shape{100, 400});
+    auto weights_iter = make_shared<op::Parameter>(element::f32, Shape{100, 400});
+    auto bias = make_shared<op::Parameter>(element::f32, Shape{400});
+    auto lstm = make_shared<op::Lstm>(src_layer, src_iter, weights_layer, weights_iter, bias);
+    auto input = make_shared<op::Parameter>(element::f32, Shape{10, 3, 28, 28});
+    auto max_pool = make_shared<op::MaxPoolWithIndices>(
+        input, Shape{2, 2}, Strides{1, 1}, Shape{0, 0}, Shape{0, 0});
+    auto f = make_shared<Function>(NodeVector{make_shared<op::GetOutputElement>(lstm, 0),
+                                              make_shared<op::GetOutputElement>(lstm, 1),
+                                              make_shared<op::GetOutputElement>(max_pool, 0),
+                                              make_shared<op::GetOutputElement>(max_pool, 1)},
+                                   ParameterVector{src_layer,
+                                                   src_iter,
+                                                   weights_layer,
+                                                   weights_iter,
+                                                   bias,
+                                                   input});
+
+    auto g = clone_function(*f);
+    ASSERT_EQ(g->get_output_size(), f->get_output_size());
+    for (size_t i = 0; i < f->get_output_size(); i++)
+    {
+        EXPECT_EQ(g->get_output_shape(i), f->get_output_shape(i));
+        EXPECT_EQ(g->get_output_element_type(i), f->get_output_element_type(i));
+    }
+    EXPECT_EQ(get_ops_of_type<op::Lstm>(g).size(), 1);
+    EXPECT_EQ(get_ops_of_type<op::MaxPoolWithIndices>(g).size(), 1);
+}
+
 TEST(cpu_fusion, backwards_maxpool_with_indices_n4_c1_hw4_2x2_max)
 {
     Shape shape_a{1, 4, 4, 4};
@@ -2042,6 +2076,89 @@ TEST(cpu_fusion, convbias_affine_folding)
     EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0)));
 }
 
+TEST(cpu_fusion, matmulbias_affine_folding)
+{
+    Shape shape_w{2, 4};
+    Shape shape_x{4, 3};
+    Shape shape_dot{2, 3};
+    Shape shape_norm{3};
+
+    auto make_function = [shape_w, shape_x, shape_dot, shape_norm]() {
+        auto W = std::make_shared<op::Parameter>(element::f32, shape_w);
+        auto x = std::make_shared<op::Parameter>(element::f32, shape_x);
+        auto bias = std::make_shared<op::Parameter>(element::f32, shape_norm);
+        auto a = std::make_shared<op::Parameter>(element::f32, shape_norm);
+        auto b = std::make_shared<op::Parameter>(element::f32, shape_norm);
+
+        auto dot = std::make_shared<op::Dot>(W, x);
+        auto dotbias = dot + std::make_shared<op::Broadcast>(bias, shape_dot, AxisSet{0});
+        auto out = std::make_shared<op::Add>(
+            std::make_shared<op::Multiply>(
+                dotbias, std::make_shared<op::Broadcast>(a, shape_dot, AxisSet{0})),
+            std::make_shared<op::Broadcast>(b, shape_dot, AxisSet{0}));
+        return make_shared<Function>(NodeVector{out}, ParameterVector{W, x, bias, a, b});
+    };
+
+    {
+        auto f = make_function();
+        pass::Manager pass_manager;
+        pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+        pass_manager.run_passes(f);
+        auto mmb =
+            std::dynamic_pointer_cast<op::MatmulBias>(f->get_results().at(0)->get_argument(0));
+        ASSERT_TRUE(mmb);
+        EXPECT_EQ(mmb->get_arguments().size(), 3);
+    }
+
+    auto int_f = make_function();
+    auto cpu_f = make_function();
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0)));
+}
+
+TEST(cpu_fusion, groupconv_affine_folding)
+{
+    Shape shape_in{1, 4, 3, 3};
+    Shape shape_weights{4, 2, 1, 1};
+    Shape shape_out{1, 4, 3, 3};
+
+    auto input = make_shared<op::Parameter>(element::f32, shape_in);
+    auto weights = make_shared<op::Parameter>(element::f32, shape_weights);
+    auto a = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto group_conv = make_shared<op::GroupConvolution>(input,
+                                                        weights,
+                                                        Strides{1, 1},
+                                                        Strides{1, 1},
+                                                        CoordinateDiff{0, 0},
+                                                        CoordinateDiff{0, 0},
+                                                        Strides{1, 1},
+                                                        2,
+                                                        shape_out);
+    auto out = std::make_shared<op::Multiply>(
+        group_conv, std::make_shared<op::Broadcast>(a, shape_out, AxisSet{0, 2, 3}));
+    auto f = make_shared<Function>(NodeVector{out}, ParameterVector{input, weights, a});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+    pass_manager.run_passes(f);
+    auto group_conv_n =
+        std::dynamic_pointer_cast<op::GroupConvolution>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(group_conv_n);
+    EXPECT_EQ(group_conv_n->get_groups(), 2);
+    EXPECT_TRUE(std::dynamic_pointer_cast<op::Multiply>(group_conv_n->get_argument(1)));
+}
+
 TEST(cpu_fusion, group_convolution_fusion)
 {
     Shape shape_a{1, 32, 2, 2};
@@ -16,9 +16,11 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <list>
 #include <memory>
+#include <numeric>
 
 #include "gtest/gtest.h"
 #include "ngraph/autodiff/adjoints.hpp"
@@ -31,6 +33,8 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
+#include "ngraph/runtime/cpu/cpu_backend.hpp"
+#include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
@@ -667,3 +671,203 @@ TEST(cpu_test, convolution_large_padding)
     auto cpu_f = make_function();
     compare_backends(int_f, cpu_f, "INTERPRETER", "CPU", 1e-4, 1e-4);
 }
+
+TEST(cpu_test, model_cache)
+{
+    const string cache_dir = file_util::path_join(file_util::get_temp_directory_path(),
+                                                  "ngraph_cpu_model_cache_test");
+    file_util::remove_directory(cache_dir);
+    file_util::make_directory(cache_dir);
+    setenv("NGRAPH_CPU_CACHE_DIR", cache_dir.c_str(), 1);
+
+    // Convolution, bias and relu are fused and given MKLDNN layouts by the CPU passes
+    auto make_function = []() {
+        auto data = make_shared<op::Parameter>(element::f32, Shape{2, 3, 8, 8});
+        auto filters = make_shared<op::Parameter>(element::f32, Shape{4, 3, 3, 3});
+        auto bias = make_shared<op::Parameter>(element::f32, Shape{4});
+        auto conv = make_shared<op::Convolution>(data, filters, Strides{1, 1}, Strides{1, 1});
+        auto conv_bias =
+            conv + make_shared<op::Broadcast>(bias, conv->get_shape(), AxisSet{0, 2, 3});
+        auto relu = make_shared<op::Relu>(conv_bias);
+        return make_shared<Function>(NodeVector{relu}, ParameterVector{data, filters, bias});
+    };
+
+    // The first compile stores the function and the second one loads it
+    for (size_t i = 0; i < 2; i++)
+    {
+        auto int_f = make_function();
+        auto cpu_f = make_function();
+        compare_backends(int_f, cpu_f, "INTERPRETER", "CPU");
+    }
+    unsetenv("NGRAPH_CPU_CACHE_DIR");
+
+    size_t entries = 0;
+    file_util::iterate_files(cache_dir, [&](const string&, bool) { entries++; });
+    file_util::remove_directory(cache_dir);
+    EXPECT_EQ(entries, 1);
+}
+
+TEST(cpu_test, model_cache_signature_mismatch)
+{
+    const string cache_dir = file_util::path_join(file_util::get_temp_directory_path(),
+                                                  "ngraph_cpu_model_cache_mismatch_test");
+    file_util::remove_directory(cache_dir);
+    file_util::make_directory(cache_dir);
+    setenv("NGRAPH_CPU_CACHE_DIR", cache_dir.c_str(), 1);
+
+    auto make_function = [](size_t rows) {
+        auto data = make_shared<op::Parameter>(element::f32, Shape{rows, 3});
+        auto relu = make_shared<op::Relu>(data + data);
+        return make_shared<Function>(NodeVector{relu}, ParameterVector{data});
+    };
+    auto compile_and_compare = [&](size_t rows) {
+        auto int_f = make_function(rows);
+        auto cpu_f = make_function(rows);
+        compare_backends(int_f, cpu_f, "INTERPRETER", "CPU");
+    };
+    compile_and_compare(4);
+    compile_and_compare(5);
+
+    // Store the entry of one function under the key of the other, as a key collision would
+    vector<string> entries;
+    file_util::iterate_files(cache_dir, [&](const string& file, bool) { entries.push_back(file); });
+    ASSERT_EQ(entries.size(), 2);
+    {
+        ifstream in(entries[0], ios_base::binary);
+        ofstream out(entries[1], ios_base::binary | ios_base::trunc);
+        out << in.rdbuf();
+    }
+
+    // The mismatching entry is ignored and the function is compiled again
+    compile_and_compare(4);
+    compile_and_compare(5);
+    unsetenv("NGRAPH_CPU_CACHE_DIR");
+    file_util::remove_directory(cache_dir);
+}
+
+namespace
+{
+    // Sets an environment variable for the lifetime of the guard and then restores it
+    class EnvironmentGuard
+    {
+    public:
+        EnvironmentGuard(const string& name, const string& value)
+            : m_name(name)
+        {
+            const char* old_value = getenv(name.c_str());
+            m_was_set = old_value != nullptr;
+            if (m_was_set)
+            {
+                m_old_value = old_value;
+            }
+            setenv(name.c_str(), value.c_str(), 1);
+        }
+
+        ~EnvironmentGuard()
+        {
+            if (m_was_set)
+            {
+                setenv(m_name.c_str(), m_old_value.c_str(), 1);
+            }
+            else
+            {
+                unsetenv(m_name.c_str());
+            }
+        }
+
+    private:
+        string m_name;
+        string m_old_value;
+        bool m_was_set;
+    };
+}
+
+TEST(cpu_test, codegen_shards)
+{
+    // Each pair of adds on the same shape shares an emitted function, giving enough of them
+    // for codegen to compile the shared functions in separate modules
+    NodeVector results;
+    ParameterVector params;
+    for (size_t i = 1; i <= 32; i++)
+    {
+        auto a = make_shared<op::Parameter>(element::f32, Shape{i});
+        auto b = make_shared<op::Parameter>(element::f32, Shape{i});
+        results.push_back(make_shared<op::Add>(a, b) * make_shared<op::Add>(b, a));
+        params.push_back(a);
+        params.push_back(b);
+    }
+    auto f = make_shared<Function>(results, params);
+
+    EnvironmentGuard codegen("NGRAPH_CODEGEN", "1");
+    auto external_function = make_shared<runtime::cpu::CPU_ExternalFunction>(f);
+    // Independent of NGRAPH_PARALLELISM
+    external_function->set_max_codegen_shards(3);
+    auto call_frame = external_function->make_call_frame();
+    EXPECT_EQ(3, external_function->get_codegen_shard_count());
+
+    auto backend = runtime::Backend::create("CPU");
+    vector<shared_ptr<runtime::Tensor>> inputs;
+    vector<shared_ptr<runtime::Tensor>> outputs;
+    for (size_t i = 1; i <= 32; i++)
+    {
+        vector<float> a(i);
+        iota(a.begin(), a.end(), 0);
+        inputs.push_back(backend->create_tensor(element::f32, Shape{i}));
+        copy_data(inputs.back(), a);
+        inputs.push_back(backend->create_tensor(element::f32, Shape{i}));
+        copy_data(inputs.back(), vector<float>(i, 1));
+        outputs.push_back(backend->create_tensor(element::f32, Shape{i}));
+    }
+    call_frame->call(outputs, inputs);
+    for (size_t i = 1; i <= 32; i++)
+    {
+        vector<float> expected;
+        for (size_t j = 0; j < i; j++)
+        {
+            expected.push_back((j + 1) * (j + 1));
+        }
+        EXPECT_EQ(expected, read_vector<float>(outputs[i - 1]));
+    }
+}
+
+TEST(cpu_test, dynamic_batch_buckets)
+{
+    auto A = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 3});
+    auto W = make_shared<op::Parameter>(element::f32, Shape{3, 2});
+    auto f = make_shared<Function>(make_shared<op::Dot>(A, W), ParameterVector{A, W});
+
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("CPU");
+    auto cpu_backend = dynamic_pointer_cast<runtime::cpu::CPU_Backend>(backend);
+    cpu_backend->set_shape_buckets(f, 0, 0, {2, 4});
+    cpu_backend->set_specialization_capacity(f, 1);
+    auto handle = backend->compile(f);
+
+    auto w = backend->create_tensor(element::f32, Shape{3, 2});
+    copy_data(w, vector<float>{1, 0, 0, 1, 1, 1});
+    for (size_t batch = 1; batch <= 5; batch++)
+    {
+        auto a = backend->create_tensor(element::f32, Shape{batch, 3});
+        vector<float> data(batch * 3, 1);
+        copy_data(a, data);
+        auto result = backend->create_tensor(element::f32, Shape{batch, 2});
+        backend->call_with_validate(handle, {result}, {a, w});
+        EXPECT_EQ(vector<float>(batch * 2, 2), read_vector<float>(result));
+    }
+}
+
+TEST(cpu_test, emit_standalone_source)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto B = op::Constant::create(element::f32, Shape{2, 2}, {1, 2, 3, 4});
+    auto f = make_shared<Function>(A * B + A, ParameterVector{A});
+
+    auto external_function = make_shared<runtime::cpu::CPU_ExternalFunction>(f);
+    string source = external_function->emit_standalone_source("model_entry");
+    EXPECT_NE(string::npos,
+              source.find("extern \"C\" void model_entry(void** inputs, void** outputs)"));
+    // Constants are compiled into the library instead of being passed in when it is loaded
+    EXPECT_NE(string::npos, source.find("_data[] = {"));
+    EXPECT_EQ(string::npos, source.find("set_constants"));
+    EXPECT_EQ(string::npos, source.find("__dso_handle"));
+    EXPECT_THROW(external_function->emit_standalone_source("model_entry"), ngraph_error);
+}
@@ -18,7 +18,9 @@
 #include <vector>
 
 #include "gtest/gtest.h"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/gpu/op/batch_norm.hpp"
 #include "ngraph/runtime/gpu/gpu_primitive_emitter.hpp"
 #include "ngraph/runtime/gpu/gpu_util.hpp"
 #include "ngraph/runtime/gpu/nvshape.hpp"
@@ -301,3 +303,20 @@ TEST(gpu_test, maxpool_bprop_larger_than_cache)
     }
     EXPECT_EQ(expected_dx, read_vector<float>(dx_t));
 }
+
+TEST(gpu_test, clone_batch_norm_training_with_stats)
+{
+    auto input = make_shared<op::Parameter>(element::f32, Shape{2, 3, 4, 4});
+    auto gamma = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto beta = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto bn = make_shared<op::gpu::BatchNormTrainingWithStats>(0.001, gamma, beta, input);
+    auto f = make_shared<Function>(NodeVector{make_shared<op::GetOutputElement>(bn, 0),
+                                              make_shared<op::GetOutputElement>(bn, 4)},
+                                   ParameterVector{input, gamma, beta});
+
+    // The stats outputs are added after the BatchNormTraining outputs; validating the clone
+    // must not drop them again
+    auto g = clone_function(*f);
+    EXPECT_EQ(g->get_output_shape(0), (Shape{2, 3, 4, 4}));
+    EXPECT_EQ(g->get_output_shape(1), (Shape{3}));
+}
@@ -15,14 +15,18 @@
 //*****************************************************************************
 
 #include <memory>
+#include <sstream>
 
 #include "gtest/gtest.h"
 
 #include "ngraph/log.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/pass/manager.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
+#include "ngraph/runtime/hybrid/cost_model.hpp"
 #include "ngraph/runtime/hybrid/hybrid_backend.hpp"
+#include "ngraph/runtime/hybrid/pass/assign_placement.hpp"
 #include "ngraph/runtime/interpreter/int_backend.hpp"
 #include "util/all_close.hpp"
 #include "util/all_close_f.hpp"
@@ -77,3 +81,175 @@ TEST(HYBRID, abc)
     backend->call_with_validate(handle, {result}, {a, b, c, d});
     EXPECT_EQ(read_vector<float>(result), (vector<float>{145, 552, 1113, 1408}));
 }
+
+TEST(HYBRID, pipelined_calls)
+{
+    const string backend_name = "H1";
+    runtime::BackendManager::register_backend(backend_name, hybrid_creator);
+
+    // Alternates between the two backends, so the requests overlap
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto t1 = A * B;
+    auto t2 = t1 + A;
+    auto t3 = t2 * B;
+    auto f = make_shared<Function>(t3 + t1, ParameterVector{A, B});
+
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("H1");
+    auto hybrid = static_pointer_cast<runtime::hybrid::HybridBackend>(backend);
+    auto handle = backend->compile(f);
+
+    vector<vector<shared_ptr<runtime::Tensor>>> inputs;
+    vector<vector<shared_ptr<runtime::Tensor>>> outputs;
+    vector<vector<float>> expected;
+    for (size_t i = 0; i < 5; i++)
+    {
+        float x = static_cast<float>(i);
+        vector<float> a{1 + x, 2, 3, 4};
+        vector<float> b{5, 6 - x, 7, 8};
+        vector<float> r(4);
+        for (size_t j = 0; j < 4; j++)
+        {
+            r[j] = (a[j] * b[j] + a[j]) * b[j] + a[j] * b[j];
+        }
+        expected.push_back(r);
+
+        auto ta = backend->create_tensor(element::f32, shape);
+        auto tb = backend->create_tensor(element::f32, shape);
+        copy_data(ta, a);
+        copy_data(tb, b);
+        inputs.push_back({ta, tb});
+        outputs.push_back({backend->create_tensor(element::f32, shape)});
+    }
+
+    hybrid->call_pipelined(handle, outputs, inputs);
+    for (size_t i = 0; i < 5; i++)
+    {
+        EXPECT_EQ(read_vector<float>(outputs[i][0]), expected[i]);
+    }
+
+    // Single calls reuse the boundary tensors of the pipelined run
+    for (size_t i = 0; i < 5; i++)
+    {
+        auto result = backend->create_tensor(element::f32, shape);
+        backend->call_with_validate(handle, {result}, inputs[i]);
+        EXPECT_EQ(read_vector<float>(result), expected[i]);
+    }
+}
+
+TEST(HYBRID, cacheable_parameter_memoization)
+{
+    const string backend_name = "H1";
+    runtime::BackendManager::register_backend(backend_name, hybrid_creator);
+
+    // W * 2 and the following + 1 run on different backends and are computed once, until W
+    // changes
+    Shape shape{4};
+    auto W = make_shared<op::Parameter>(element::f32, shape, true);
+    auto X = make_shared<op::Parameter>(element::f32, shape);
+    auto two = op::Constant::create(element::f32, shape, {2, 2, 2, 2});
+    auto one = op::Constant::create(element::f32, shape, {1, 1, 1, 1});
+    auto f = make_shared<Function>((W * two + one) * X, ParameterVector{W, X});
+
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("H1");
+
+    vector<float> w_data{1, 2, 3, 4};
+    auto w = backend->create_tensor(element::f32, shape, w_data.data());
+    auto x = backend->create_tensor(element::f32, shape);
+    copy_data(x, vector<float>{1, 1, 1, 1});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    auto handle = backend->compile(f);
+    backend->call_with_validate(handle, {result}, {w, x});
+    EXPECT_EQ((vector<float>{3, 5, 7, 9}), read_vector<float>(result));
+
+    // Changing the caller's memory behind the tensor's back keeps the cached values
+    w_data[0] = 10;
+    copy_data(x, vector<float>{2, 2, 2, 2});
+    backend->call_with_validate(handle, {result}, {w, x});
+    EXPECT_EQ((vector<float>{6, 10, 14, 18}), read_vector<float>(result));
+
+    w->mark_modified();
+    backend->call_with_validate(handle, {result}, {w, x});
+    EXPECT_EQ((vector<float>{42, 10, 14, 18}), read_vector<float>(result));
+
+    // So does binding another tensor
+    auto w2 = backend->create_tensor(element::f32, shape);
+    copy_data(w2, vector<float>{1, 1, 1, 1});
+    backend->call_with_validate(handle, {result}, {w2, x});
+    EXPECT_EQ((vector<float>{6, 6, 6, 6}), read_vector<float>(result));
+}
+
+static vector<size_t> place(const shared_ptr<Function>& f,
+                            const runtime::hybrid::CostModel& cost_model,
+                            const NodeVector& nodes)
+{
+    vector<shared_ptr<runtime::Backend>> backend_list = {
+        make_shared<runtime::interpreter::INTBackend>(),
+        make_shared<runtime::interpreter::INTBackend>()};
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::hybrid::pass::AssignPlacement>(backend_list, cost_model);
+    pass_manager.run_passes(f);
+
+    vector<size_t> placements;
+    for (auto node : nodes)
+    {
+        placements.push_back(node->get_placement_index());
+    }
+    return placements;
+}
+
+TEST(HYBRID, cost_model_placement)
+{
+    Shape shape{256, 256};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto t1 = make_shared<op::Multiply>(A, B);
+    auto t2 = make_shared<op::Add>(t1, A);
+    auto t3 = make_shared<op::Multiply>(t2, B);
+    auto t4 = make_shared<op::Add>(t3, t1);
+    auto f = make_shared<Function>(t4, ParameterVector{A, B});
+    NodeVector ops{t1, t2, t3, t4};
+
+    // Multiply is a bit cheaper on backend 1 and Add a bit cheaper on backend 0, not enough
+    // to pay for moving tensors back and forth, so nothing is split
+    runtime::hybrid::CostModel cost_model(2);
+    cost_model.set_op_cost(1, "Multiply", 0.0009);
+    cost_model.set_op_cost(0, "Add", 0.0009);
+    EXPECT_EQ(place(f, cost_model, ops), (vector<size_t>{0, 0, 0, 0}));
+    auto estimate = cost_model.estimate(*f);
+    EXPECT_EQ(estimate.m_boundary_count, 0);
+
+    // When Multiply is much slower on backend 0 the transfers are worth it, and the Adds in
+    // between follow rather than leaving one-op sub-functions behind
+    cost_model.set_op_cost(0, "Multiply", 0.1);
+    EXPECT_EQ(place(f, cost_model, ops), (vector<size_t>{1, 1, 1, 1}));
+    estimate = cost_model.estimate(*f);
+    EXPECT_LT(estimate.m_total_cost, shape_size(shape) * (2 * 0.1 + 2 * 0.0009));
+    stringstream report;
+    report << estimate;
+    EXPECT_NE(report.str().find("total"), string::npos);
+}
+
+TEST(HYBRID, cost_model_from_performance_data)
+{
+    Shape shape{100};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto t1 = make_shared<op::Multiply>(A, B);
+    auto f = make_shared<Function>(t1, ParameterVector{A, B});
+
+    runtime::hybrid::CostModel cost_model(2);
+    EXPECT_DOUBLE_EQ(cost_model.get_op_cost(*t1, 1), 0.1);
+    cost_model.add_performance_data(
+        1, f, {runtime::PerformanceCounter(t1->get_name().c_str(), 50, 10)});
+    EXPECT_DOUBLE_EQ(cost_model.get_op_cost(*t1, 1), 5);
+    EXPECT_DOUBLE_EQ(cost_model.get_op_cost(*t1, 0), 0.1);
+    EXPECT_DOUBLE_EQ(cost_model.get_op_cost(*A, 1), 0);
+
+    // An op averaging under a microsecond per call is still not free
+    cost_model.add_performance_data(
+        0, f, {runtime::PerformanceCounter(t1->get_name().c_str(), 3, 10)});
+    EXPECT_DOUBLE_EQ(cost_model.get_op_cost(*t1, 0), 0.3);
+}
@@ -0,0 +1,120 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/parallel.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(parallel, parallel_for)
+{
+    vector<atomic<size_t>> counts(1000);
+    for (auto& count : counts)
+    {
+        count = 0;
+    }
+    parallel_for(0, counts.size(), [&](size_t i) { counts[i]++; });
+    for (auto& count : counts)
+    {
+        EXPECT_EQ(count, 1);
+    }
+}
+
+TEST(parallel, nested)
+{
+    atomic<size_t> total(0);
+    parallel_for(0, 10, [&](size_t i) {
+        parallel_for(0, 10, [&](size_t j) { total += i * 10 + j; });
+    });
+    EXPECT_EQ(total, 4950);
+}
+
+TEST(parallel, nested_calls_share_the_pool)
+{
+    if (get_parallelism() < 2)
+    {
+        return;
+    }
+    // The two indices of the inner call wait for each other, which only succeeds if the
+    // inner call gets a second thread
+    atomic<size_t> arrived(0);
+    atomic<bool> met(true);
+    parallel_for(0, 2, [&](size_t i) {
+        if (i == 0)
+        {
+            parallel_for(0, 2, [&](size_t j) {
+                arrived++;
+                auto deadline = chrono::steady_clock::now() + chrono::seconds(10);
+                while (arrived < 2 && chrono::steady_clock::now() < deadline)
+                {
+                    this_thread::yield();
+                }
+                met = met && arrived == 2;
+            });
+        }
+    });
+    EXPECT_TRUE(met);
+}
+
+TEST(parallel, concurrent_callers)
+{
+    vector<size_t> totals(4);
+    vector<thread> threads;
+    for (size_t t = 0; t < totals.size(); t++)
+    {
+        threads.emplace_back([&totals, t]() {
+            atomic<size_t> total(0);
+            parallel_for(0, 10, [&](size_t i) {
+                parallel_for(0, 10, [&](size_t j) { total += i * 10 + j; });
+            });
+            totals[t] = total;
+        });
+    }
+    for (thread& t : threads)
+    {
+        t.join();
+    }
+    EXPECT_EQ(totals, vector<size_t>(totals.size(), 4950));
+}
+
+TEST(parallel, exception)
+{
+    atomic<size_t> calls(0);
+    EXPECT_THROW(parallel_for(0,
+                              100,
+                              [&](size_t i) {
+                                  calls++;
+                                  if (i == 3)
+                                  {
+                                      throw runtime_error("failed");
+                                  }
+                              }),
+                 runtime_error);
+    EXPECT_GE(calls, 4);
+
+    // The pool is usable after an exception
+    calls = 0;
+    parallel_for(0, 100, [&](size_t i) { calls++; });
+    EXPECT_EQ(calls, 100);
+}
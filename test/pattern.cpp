@@ -680,6 +680,80 @@ TEST(pattern, recurrent_graph_rewrite)
     }
 }
 
+TEST(pattern, recurrent_graph_rewrite_many_chains)
+{
+    Shape shape{};
+    pass::Manager pass_manager;
+    pass_manager.register_pass<TestRecurrentGraphRewrite>();
+
+    // Each chain of additions of zero is removed by its own rewrite
+    auto iconst0 = construct_constant_node(0);
+    ParameterVector params;
+    NodeVector abs_nodes;
+    for (size_t i = 0; i < 8; i++)
+    {
+        auto param = make_shared<op::Parameter>(element::i32, shape);
+        shared_ptr<Node> chain = param;
+        for (size_t j = 0; j <= i; j++)
+        {
+            chain = chain + iconst0;
+        }
+        params.push_back(param);
+        abs_nodes.push_back(make_shared<op::Abs>(chain));
+    }
+    auto f = make_shared<Function>(abs_nodes, params);
+    pass_manager.run_passes(f);
+
+    for (size_t i = 0; i < abs_nodes.size(); i++)
+    {
+        ASSERT_EQ(abs_nodes[i]->get_argument(0), params[i]);
+    }
+}
+
+// Replaces `marker` with a zero the first time it visits an Abs of `trigger`, a rewrite that
+// changes the graph away from the node it matched
+class MarkerRecurrentGraphRewrite : public TestRecurrentGraphRewrite
+{
+public:
+    MarkerRecurrentGraphRewrite(const shared_ptr<Node>& trigger, const shared_ptr<Node>& marker)
+    {
+        auto rpattern = std::make_shared<pattern::op::Label>(element::i32, Shape{});
+        auto fired = make_shared<bool>(false);
+        ngraph::pattern::recurrent_graph_rewrite_callback callback =
+            [trigger, marker, fired](pattern::RecurrentMatcher& rm) {
+                if (*fired || rm.get_match_root()->get_argument(0) != trigger)
+                {
+                    return false;
+                }
+                *fired = true;
+                ngraph::replace_node(marker, construct_constant_node(0));
+                return true;
+            };
+
+        std::set<std::shared_ptr<pattern::op::Label>> empty_correlated_matches;
+        this->add_matcher(make_shared<pattern::RecurrentMatcher>(
+            make_shared<op::Abs>(rpattern), rpattern, empty_correlated_matches, callback));
+    }
+};
+
+TEST(pattern, recurrent_graph_rewrite_rescans)
+{
+    Shape shape{};
+    auto trigger = make_shared<op::Parameter>(element::i32, shape);
+    auto b = make_shared<op::Parameter>(element::i32, shape);
+    auto neg = make_shared<op::Negative>(make_shared<op::Abs>(trigger));
+    auto marker = make_shared<op::Negative>(b);
+    auto abs_add = make_shared<op::Abs>(neg + marker);
+    auto f = make_shared<Function>(abs_add, ParameterVector{trigger, b});
+
+    // The rewrite of the Abs of trigger, two nodes below the add, turns the add into an
+    // addition of zero
+    pass::Manager pass_manager;
+    pass_manager.register_pass<MarkerRecurrentGraphRewrite>(trigger, marker);
+    pass_manager.run_passes(f);
+    ASSERT_EQ(abs_add->get_argument(0), neg);
+}
+
 TEST(pattern, label_on_skip)
 {
     Shape shape{2, 2};
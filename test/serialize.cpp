@@ -15,13 +15,19 @@
 //*****************************************************************************
 
 #include <fstream>
+#include <mutex>
+#include <set>
 #include <sstream>
 
 #include "gtest/gtest.h"
 
+#include "ngraph/archive.hpp"
+#include "ngraph/cpio.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/op/util/unary_elementwise_arithmetic.hpp"
 #include "ngraph/serializer.hpp"
+#include "ngraph/serializer_extension.hpp"
 #include "ngraph/util.hpp"
 #include "nlohmann/json.hpp"
 #include "util/test_tools.hpp"
@@ -45,6 +51,24 @@ T get_or_default(nlohmann::json& j, const std::string& key, const T& default_val
     return rc;
 }
 
+// Node names are not preserved so functions are compared by their ops and output shapes
+static vector<string> summarize(shared_ptr<Function> func)
+{
+    vector<string> rc;
+    for (shared_ptr<Node> node : func->get_ordered_ops())
+    {
+        stringstream op;
+        op << node->description();
+        for (size_t i = 0; i < node->get_output_size(); i++)
+        {
+            op << " " << node->get_output_element_type(i) << node->get_output_shape(i);
+        }
+        rc.push_back(op.str());
+    }
+    sort(rc.begin(), rc.end());
+    return rc;
+}
+
 #if defined(NGRAPH_INTERPRETER_ENABLE)
 TEST(serialize, main)
 {
@@ -139,6 +163,295 @@ TEST(serialize, constant)
     EXPECT_TRUE(found);
 }
 
+TEST(serialize, constant_mapped)
+{
+    const string tmp_file = "serialize_constant_mapped.cpio";
+    const size_t alignment = 4096;
+    Shape shape{2, 3};
+    auto A = op::Constant::create(element::f32, shape, {1, 2, 3, 4, 5, 6});
+    auto B = op::Constant::create(element::i8, Shape{3}, {-1, 0, 1});
+    auto f = make_shared<Function>(NodeVector{A, B}, ParameterVector{});
+
+    serialize(tmp_file, f, 0, alignment);
+    {
+        archive::Reader reader(tmp_file);
+        auto records = reader.get_records();
+        ASSERT_EQ(records.size(), 3);
+        EXPECT_EQ(records[1].get_offset() % alignment, 0);
+        EXPECT_EQ(records[2].get_offset() % alignment, 0);
+    }
+
+    auto g = deserialize_mapped(tmp_file);
+    ASSERT_NE(g, nullptr);
+    size_t found = 0;
+    for (shared_ptr<Node> node : g->get_ops())
+    {
+        if (auto c = dynamic_pointer_cast<op::Constant>(node))
+        {
+            found++;
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(c->get_data_ptr()) % alignment, 0);
+            if (c->get_element_type() == element::f32)
+            {
+                EXPECT_EQ((vector<float>{1, 2, 3, 4, 5, 6}), c->get_vector<float>());
+            }
+            else
+            {
+                EXPECT_EQ((vector<int8_t>{-1, 0, 1}), c->get_vector<int8_t>());
+            }
+        }
+    }
+    EXPECT_EQ(found, 2);
+
+    // The mapping outlives the file name
+    file_util::remove_file(tmp_file);
+    g = nullptr;
+}
+
+TEST(serialize, legacy_cpio)
+{
+    const string tmp_file = "serialize_legacy.cpio";
+    Shape shape{2, 2};
+    auto A = op::Constant::create(element::f64, shape, {1, 2, 3, 4});
+    auto f = make_shared<Function>(A, ParameterVector{});
+
+    // Repackage the records of the current format as a CPIO file
+    stringstream ss;
+    serialize(ss, f);
+    {
+        archive::Reader reader(ss);
+        cpio::Writer writer(tmp_file);
+        for (const archive::Record& record : reader.get_records())
+        {
+            vector<char> data(record.get_size());
+            reader.read(record, data.data());
+            writer.write(record.get_name(), data.data(), static_cast<uint32_t>(data.size()));
+        }
+    }
+
+    for (auto g : {deserialize(tmp_file), deserialize_mapped(tmp_file)})
+    {
+        ASSERT_NE(g, nullptr);
+        bool found = false;
+        for (shared_ptr<Node> node : g->get_ops())
+        {
+            if (auto c = dynamic_pointer_cast<op::Constant>(node))
+            {
+                found = true;
+                EXPECT_EQ((vector<double>{1, 2, 3, 4}), c->get_vector<double>());
+            }
+        }
+        EXPECT_TRUE(found);
+    }
+    file_util::remove_file(tmp_file);
+}
+
+TEST(serialize, binary_model)
+{
+    vector<string> models = {"mxnet/mnist_mlp_forward.json", "mxnet/LSTM_backward.json"};
+    for (const string& model : models)
+    {
+        const string json_path = file_util::path_join(SERIALIZED_ZOO, model);
+        shared_ptr<Function> f = deserialize(file_util::read_file_to_string(json_path));
+
+        stringstream ss;
+        serialize(ss, f);
+        {
+            archive::Reader reader(ss);
+            const archive::Record& record = reader.get_records().at(0);
+            vector<char> data(record.get_size());
+            reader.read(record, data.data());
+            EXPECT_EQ(string(data.data(), 4), "NGBM");
+        }
+        shared_ptr<Function> g = deserialize(ss);
+        ASSERT_NE(g, nullptr);
+
+        EXPECT_EQ(summarize(f), summarize(g));
+    }
+}
+
+TEST(serialize, binary_model_attributes)
+{
+    auto A = make_shared<op::Parameter>(element::f32, PartialShape{1, Dimension::dynamic(), 4});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{1, 3, 2, 2});
+    auto lrn = make_shared<op::LRN>(B, 0.0001, 0.75, 2.5, 3);
+    auto f = make_shared<Function>(NodeVector{A, lrn}, ParameterVector{A, B});
+
+    for (size_t indent : {0, 2})
+    {
+        stringstream ss;
+        serialize(ss, f, indent);
+        shared_ptr<Function> g = deserialize(ss);
+        ASSERT_NE(g, nullptr);
+        auto params = g->get_parameters();
+        ASSERT_EQ(params.size(), 2);
+        EXPECT_TRUE(params[0]->get_output_partial_shape(0).same_scheme(
+            PartialShape{1, Dimension::dynamic(), 4}));
+        auto g_lrn = dynamic_pointer_cast<op::LRN>(g->get_results().at(1)->get_argument(0));
+        ASSERT_NE(g_lrn, nullptr);
+        EXPECT_EQ(g_lrn->get_alpha(), 0.0001);
+        EXPECT_EQ(g_lrn->get_beta(), 0.75);
+        EXPECT_EQ(g_lrn->get_bias(), 2.5);
+        EXPECT_EQ(g_lrn->get_nsize(), 3);
+    }
+}
+
+TEST(serialize, binary_model_typed_attributes)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{1, 2, 5, 5});
+    auto W = make_shared<op::Parameter>(element::f32, Shape{3, 2, 2, 2});
+    auto C = make_shared<op::Parameter>(element::i32, PartialShape::dynamic(), true);
+    auto conv = make_shared<op::Convolution>(A,
+                                             W,
+                                             Strides{2, 1},
+                                             Strides{1, 2},
+                                             CoordinateDiff{-1, 0},
+                                             CoordinateDiff{0, 1},
+                                             Strides{1, 1});
+    auto reshape = make_shared<op::Reshape>(conv, AxisVector{0, 1, 3, 2}, Shape{1, 3, 4, 2});
+    auto topk = make_shared<op::TopK>(reshape, 3, element::i64, 1, false);
+    auto values = make_shared<op::GetOutputElement>(topk, 1);
+    auto convert = make_shared<op::Convert>(C, element::f64);
+    auto f = make_shared<Function>(NodeVector{values, convert}, ParameterVector{A, W, C});
+
+    stringstream ss;
+    serialize(ss, f);
+    shared_ptr<Function> g = deserialize(ss);
+    ASSERT_NE(g, nullptr);
+
+    auto g_values =
+        dynamic_pointer_cast<op::GetOutputElement>(g->get_results().at(0)->get_argument(0));
+    ASSERT_NE(g_values, nullptr);
+    EXPECT_EQ(g_values->get_n(), 1);
+    EXPECT_EQ(g_values->get_shape(), (Shape{1, 3, 4, 1}));
+    auto g_topk =
+        dynamic_pointer_cast<op::TopK>(g_values->get_inputs().at(0).get_output().get_node());
+    ASSERT_NE(g_topk, nullptr);
+    EXPECT_EQ(g_topk->get_top_k_axis(), 3);
+    EXPECT_EQ(g_topk->get_index_element_type(), element::i64);
+    EXPECT_EQ(g_topk->get_k(), 1);
+    EXPECT_FALSE(g_topk->get_compute_max());
+    auto g_reshape = dynamic_pointer_cast<op::Reshape>(g_topk->get_argument(0));
+    ASSERT_NE(g_reshape, nullptr);
+    EXPECT_EQ(g_reshape->get_input_order(), (AxisVector{0, 1, 3, 2}));
+    auto g_conv = dynamic_pointer_cast<op::Convolution>(g_reshape->get_argument(0));
+    ASSERT_NE(g_conv, nullptr);
+    EXPECT_EQ(g_conv->get_window_movement_strides(), (Strides{2, 1}));
+    EXPECT_EQ(g_conv->get_window_dilation_strides(), (Strides{1, 2}));
+    EXPECT_EQ(g_conv->get_padding_below(), (CoordinateDiff{-1, 0}));
+    EXPECT_EQ(g_conv->get_padding_above(), (CoordinateDiff{0, 1}));
+
+    auto g_convert = dynamic_pointer_cast<op::Convert>(g->get_results().at(1)->get_argument(0));
+    ASSERT_NE(g_convert, nullptr);
+    EXPECT_EQ(g_convert->get_convert_element_type(), element::f64);
+    auto g_c = g->get_parameters().at(2);
+    EXPECT_TRUE(g_c->get_output_partial_shape(0).rank().is_dynamic());
+    EXPECT_EQ(g_c->get_element_type(), element::i32);
+    EXPECT_TRUE(g_c->get_cacheable());
+}
+
+TEST(serialize, parallel_load)
+{
+    const string tmp_file = "serialize_parallel_load.ngar";
+    const string json_path = file_util::path_join(SERIALIZED_ZOO, "mxnet/LSTM_forward.json");
+    shared_ptr<Function> f = deserialize(file_util::read_file_to_string(json_path));
+
+    // Loading by file name reads constants in parallel
+    serialize(tmp_file, f);
+    shared_ptr<Function> g = deserialize(tmp_file);
+    file_util::remove_file(tmp_file);
+    ASSERT_NE(g, nullptr);
+    EXPECT_EQ(summarize(f), summarize(g));
+    for (shared_ptr<Node> node : g->get_ops())
+    {
+        if (auto c = dynamic_pointer_cast<op::Constant>(node))
+        {
+            EXPECT_NE(c->get_data_ptr(), nullptr);
+        }
+    }
+}
+
+namespace
+{
+    // An op the serializer does not know
+    class ScaleTestOp : public op::util::UnaryElementwiseArithmetic
+    {
+    public:
+        ScaleTestOp(const shared_ptr<Node>& arg, float scale)
+            : UnaryElementwiseArithmetic("ScaleTestOp", arg)
+            , m_scale(scale)
+        {
+            constructor_validate_and_infer_types();
+        }
+
+        float get_scale() const { return m_scale; }
+        shared_ptr<Node> copy_with_new_args(const NodeVector& new_args) const override
+        {
+            return make_shared<ScaleTestOp>(new_args.at(0), m_scale);
+        }
+
+    private:
+        float m_scale;
+    };
+}
+
+TEST(serialize, registered_op_and_hooks)
+{
+    serializer::register_op("ScaleTestOp",
+                            [](const Node& n, json& j) {
+                                j["scale"] = static_cast<const ScaleTestOp&>(n).get_scale();
+                            },
+                            [](const json& j, const NodeVector& args) {
+                                return make_shared<ScaleTestOp>(args.at(0),
+                                                                j.at("scale").get<float>());
+                            });
+    EXPECT_TRUE(serializer::is_supported_op("ScaleTestOp"));
+    EXPECT_TRUE(serializer::is_supported_op("Add"));
+    EXPECT_FALSE(serializer::is_supported_op("NoSuchTestOp"));
+
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto scale = make_shared<ScaleTestOp>(A, 2.5f);
+    auto f = make_shared<Function>(NodeVector{scale}, ParameterVector{A});
+
+    // The hooks save and restore state attached to each node
+    mutex tags_mutex;
+    multiset<string> tags;
+    serializer::NodeHooks hooks;
+    hooks.write = [](const Node& n, json& j) { j["test_tag"] = n.description() + " tag"; };
+    hooks.read = [&](Node& n, const json& j) {
+        lock_guard<mutex> lock(tags_mutex);
+        EXPECT_EQ(j.at("test_tag").get<string>(), n.description() + " tag");
+        tags.insert(n.description());
+    };
+
+    stringstream ss;
+    serializer::serialize(ss, f, hooks);
+    shared_ptr<Function> g = serializer::deserialize(ss, hooks);
+    ASSERT_NE(g, nullptr);
+    auto g_scale = dynamic_pointer_cast<ScaleTestOp>(g->get_results().at(0)->get_argument(0));
+    ASSERT_NE(g_scale, nullptr);
+    EXPECT_EQ(g_scale->get_scale(), 2.5f);
+    EXPECT_EQ(g_scale->get_shape(), (Shape{2, 3}));
+    EXPECT_EQ(tags, (multiset<string>{"Parameter", "ScaleTestOp", "Result"}));
+}
+
+TEST(serialize, hash)
+{
+    auto make_function = [](float value) {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+        auto B = op::Constant::create(element::f32, Shape{2, 2}, {1.0f, 2.0f, 3.0f, value});
+        return make_shared<Function>(make_shared<op::Multiply>(A + B, A), ParameterVector{A});
+    };
+    // Functions built separately have different node names but the same hash
+    EXPECT_EQ(serializer::hash(make_function(4)), serializer::hash(make_function(4)));
+    EXPECT_NE(serializer::hash(make_function(4)), serializer::hash(make_function(5)));
+
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto f = make_shared<Function>(A - B, ParameterVector{A, B});
+    auto g = make_shared<Function>(A - B, ParameterVector{B, A});
+    EXPECT_NE(serializer::hash(f), serializer::hash(g));
+}
+
 TEST(benchmark, serialize)
 {
     stopwatch timer;
@@ -153,4 +466,11 @@ TEST(benchmark, serialize)
     shared_ptr<Function> f = ngraph::deserialize(json_string);
     timer.stop();
     cout << "deserialize took " << timer.get_milliseconds() << "ms\n";
+
+    stringstream ss;
+    ngraph::serialize(ss, f);
+    timer.start();
+    f = ngraph::deserialize(ss);
+    timer.stop();
+    cout << "binary deserialize took " << timer.get_milliseconds() << "ms\n";
 }
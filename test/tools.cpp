@@ -14,12 +14,16 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <dlfcn.h>
 #include <gtest/gtest.h>
 #include <sstream>
+#include <vector>
 
 #include "ngraph/cpio.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/serializer.hpp"
 
 using namespace ngraph;
 using namespace std;
@@ -53,3 +57,40 @@ TEST(tools, nbench_functional)
         FAIL();
     }
 }
+
+#ifdef NGRAPH_AOT_PATH
+TEST(tools, ngraph_aot)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto B = op::Constant::create(element::f32, Shape{2, 2}, {1, 2, 3, 4});
+    auto f = make_shared<Function>(A * B + A, ParameterVector{A});
+
+    const string directory =
+        file_util::path_join(file_util::get_temp_directory_path(), "ngraph_aot_test");
+    file_util::make_directory(directory);
+    const string model_path = file_util::path_join(directory, "model.json");
+    serialize(model_path, f);
+
+    // The build tree does not have the layout of an install prefix
+    stringstream ss;
+    ss << NGRAPH_AOT_PATH << " -i " << model_path << " -o " << directory << " -n aot_test"
+       << " --include-dir " << NGRAPH_AOT_INCLUDE_DIR << " --lib-dir " << NGRAPH_AOT_LIB_DIR;
+    ASSERT_EQ(0, system(ss.str().c_str())) << ss.str();
+
+    const string library_path = file_util::path_join(directory, "libaot_test.so");
+    void* library = dlopen(library_path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    ASSERT_NE(nullptr, library) << dlerror();
+    auto entry = reinterpret_cast<void (*)(void**, void**)>(dlsym(library, "entry"));
+    ASSERT_NE(nullptr, entry);
+
+    vector<float> a{1, 2, 3, 4};
+    vector<float> result(4);
+    void* inputs[] = {a.data()};
+    void* outputs[] = {result.data()};
+    entry(inputs, outputs);
+    EXPECT_EQ((vector<float>{2, 6, 12, 20}), result);
+
+    dlclose(library);
+    file_util::remove_directory(directory);
+}
+#endif